@@ -38,10 +38,14 @@ out VS_To_FS
 uniform mat4x4 uniform_transform_world;
 #endif
 
+POSITION_DEQUANTIZATION;
+
 uniform vec4 uniform_texture_scale_and_offset;
 
 void main()
 {
+    vec4 position_object_space = DEQUANTIZE( position );
+
 #ifdef INSTANCING_ENABLED
     mat4x4 world_view_transform = world_transform * _INTRINSIC_TRANSFORM_VIEW;
 #else
@@ -52,13 +56,13 @@ void main()
 
 #ifdef SHADOWS_ENABLED
     #ifdef INSTANCING_ENABLED
-        vs_out.position_light_directional_clip_space = vec4( position, 1.0 ) * world_transform * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
+        vs_out.position_light_directional_clip_space = position_object_space * world_transform * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
     #else
-        vs_out.position_light_directional_clip_space = vec4( position, 1.0 ) * uniform_transform_world * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
+        vs_out.position_light_directional_clip_space = position_object_space * uniform_transform_world * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
     #endif
 #endif
 
-    vs_out.position_view_space       = vec4( position, 1.0 ) * world_view_transform;
+    vs_out.position_view_space       = position_object_space * world_view_transform;
     vs_out.surface_normal_view_space = vec4( normalize( normal * world_view_transform_for_normals ), 0.0 );
     vs_out.tex_coords                = tex_coords * uniform_texture_scale_and_offset.xy + uniform_texture_scale_and_offset.zw;
 
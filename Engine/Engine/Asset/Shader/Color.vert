@@ -20,12 +20,14 @@ out vec4 varying_color;
 uniform mat4x4 uniform_transform_world;
 #endif
 
+POSITION_DEQUANTIZATION;
+
 void main()
 {
 #ifdef INSTANCING_ENABLED
-    gl_Position = vec4( position, 1.0 ) * world_transform * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
+    gl_Position = DEQUANTIZE( position ) * world_transform * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
     varying_color = color;
 #else
-    gl_Position = vec4( position, 1.0 ) * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
+    gl_Position = DEQUANTIZE( position ) * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
 #endif
 }
\ No newline at end of file
@@ -13,6 +13,7 @@ out vec4 varying_normal_view_space;
 out vec2 varying_tex_coords;
 
 uniform mat4x4 uniform_transform_world;
+POSITION_DEQUANTIZATION;
 uniform vec4 uniform_texture_scale_and_offset;
 
 uniform float uniform_outline_thickness;
@@ -27,7 +28,7 @@ void main()
     mat4x4 world_view_transform             = outline_thickness_scale_transform * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW;
     mat3x3 world_view_transform_for_normals = mat3x3( transpose( inverse( world_view_transform ) ) );
 
-    varying_position_view_space = vec4( position, 1.0 ) * world_view_transform;
+    varying_position_view_space = DEQUANTIZE( position ) * world_view_transform;
     varying_normal_view_space   = vec4( normalize( normal * world_view_transform_for_normals ), 0.0 );
     varying_tex_coords          = tex_coords * uniform_texture_scale_and_offset.xy + uniform_texture_scale_and_offset.zw;
     
@@ -16,11 +16,13 @@ INSTANCE_WORLD_TRANSFORM mat4 world_transform;
 uniform mat4x4 uniform_transform_world;
 #endif
 
+POSITION_DEQUANTIZATION;
+
 void main()
 {
 #ifdef INSTANCING_ENABLED
-    gl_Position = vec4( position, 1.0f ) * world_transform * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
+    gl_Position = DEQUANTIZE( position ) * world_transform * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
 #else
-    gl_Position = vec4( position, 1.0f ) * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
+    gl_Position = DEQUANTIZE( position ) * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
 #endif
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ NORMAL   vec3 normal;
 out vec4 varying_normal_view_space;
 
 uniform mat4x4 uniform_transform_world;
+POSITION_DEQUANTIZATION;
 
 void main()
 {
@@ -18,5 +19,5 @@ void main()
 
     varying_normal_view_space = vec4( normalize( normal * world_view_transform_for_normals ), 0.0 );
     
-    gl_Position = vec4( position, 1.0 ) * world_view_transform;
+    gl_Position = DEQUANTIZE( position ) * world_view_transform;
 }
\ No newline at end of file
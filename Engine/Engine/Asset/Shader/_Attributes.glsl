@@ -27,3 +27,13 @@
 /* Instanced: */
 #define INSTANCE_WORLD_TRANSFORM	layout (location = INSTANCE_WORLD_TRANSFORM_LOCATION ) in
 #define INSTANCE_COLOR				layout (location = INSTANCE_COLOR_LOCATION ) in
+
+/*
+ * Position Dequantization:
+ */
+
+/* Quantized positions (see Mesh::CompressedAttribute::Positions) are stored in [-1, +1]; The Renderer uploads each Mesh's dequantization transform
+ * (identity for float positions), which maps the positions back to object space, before any other transform is applied. */
+#define POSITION_DEQUANTIZATION		uniform mat4x4 uniform_transform_position_dequantization
+
+#define DEQUANTIZE( position )		( vec4( position, 1.0 ) * uniform_transform_position_dequantization )
@@ -6,6 +6,7 @@
 #include "ImGuiDrawer.hpp"
 #include "ImGuiSetup.h"
 #include "ImGuiUtility.h"
+#include "Math/FastMath.hpp"
 #include "Math/Math.hpp"
 
 // Vendor Includes.
@@ -152,10 +153,10 @@ namespace Engine
 		time_previous = time_current;
 		time_previous_since_start = time_since_start;
 
-		time_sin = Math::Sin( Radians( time_current ) );
-		time_cos = Math::Cos( Radians( time_current ) );
 		time_mod_1 = std::fmod( time_current, 1.0f );
 		time_mod_2_pi = std::fmod( time_current, Constants< float >::Two_Pi() );
+		/* Wrapped time keeps the fast approximation within its documented error, no matter how long the application runs. */
+		Math::Fast::SinCos( Radians( time_mod_2_pi ), time_sin, time_cos );
 
 		frame_count++;
 	}
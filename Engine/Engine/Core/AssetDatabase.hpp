@@ -6,6 +6,7 @@
 // std Includes.
 #include <map>
 #include <string>
+#include <utility>
 
 namespace Engine
 {
@@ -101,6 +102,28 @@ namespace Engine
 			}
 		}
 
+		/* For assets loaded in two steps, where the expensive part is done up front (e.g., Textures decoded on worker threads, see Model::Loader);
+		 * Constructs the asset from the arguments, which are passed after the name. Names the asset the same way as CreateAssetFromMemory(). */
+		template< typename ... Arguments >
+		static AssetType* CreateAsset( const std::string& name, Arguments&& ... arguments )
+		{
+			auto& instance = Instance();
+
+			if( name.empty() )
+			{
+				std::string new_name( "<unnamed>_" + std::to_string( ( int )instance.asset_map.size() ) );
+
+				instance.asset_map[ new_name ] = AssetType( new_name, std::forward< Arguments >( arguments )... );
+				return &instance.asset_map[ new_name ];
+			}
+
+			if( not instance.asset_map.contains( name ) )
+				instance.asset_map[ name ] = AssetType( name, std::forward< Arguments >( arguments )... );
+
+			/* Asset is already loaded, return the existing one. */
+			return &instance.asset_map[ name ];
+		}
+
 		static AssetType* AddAsset( AssetType&& asset,
 									const std::string& file_path = "<not-on-disk>" )
 		{
@@ -139,6 +162,18 @@ namespace Engine
 			return found_asset;
 		}
 
+		/* Returns nullptr if there is no asset with the given name. */
+		static AssetType* Find( const std::string& name )
+		{
+			auto& instance = Instance();
+
+			if( const auto iterator = instance.asset_map.find( name );
+				iterator != instance.asset_map.end() )
+				return &iterator->second;
+
+			return nullptr;
+		}
+
 		static const std::map< std::string, AssetType >& Assets()
 		{
 			auto& instance = Instance();
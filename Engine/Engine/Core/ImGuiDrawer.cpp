@@ -1056,14 +1056,14 @@ namespace Engine::ImGuiDrawer
 
 		is_modified |= Draw( point_light.data.ambient_and_attenuation_constant.color, "Ambient"  );
 		is_modified |= Draw( point_light.data.diffuse_and_attenuation_linear.color,	  "Diffuse"  );
-		is_modified |= Draw( point_light.data.specular_attenuation_quadratic.color,	  "Specular" );
+		is_modified |= Draw( point_light.data.specular_and_attenuation_quadratic.color,	  "Specular" );
 
 		if( !hide_position )
 			is_modified |= Draw( *point_light.transform, Transform::Mask::Translation, "Transform" );
 
 		is_modified |= ImGui::SliderFloat( "Attenuation: Constant",	 &point_light.data.ambient_and_attenuation_constant.scalar,	0.0f, 5.0f, "%.5g", ImGuiSliderFlags_Logarithmic );
 		is_modified |= ImGui::SliderFloat( "Attenuation: Linear",	 &point_light.data.diffuse_and_attenuation_linear.scalar,	0.0f, 1.0f, "%.5g", ImGuiSliderFlags_Logarithmic );
-		is_modified |= ImGui::SliderFloat( "Attenuation: Quadratic", &point_light.data.specular_attenuation_quadratic.scalar,	0.0f, 1.0f, "%.5g", ImGuiSliderFlags_Logarithmic );
+		is_modified |= ImGui::SliderFloat( "Attenuation: Quadratic", &point_light.data.specular_and_attenuation_quadratic.scalar,	0.0f, 1.0f, "%.5g", ImGuiSliderFlags_Logarithmic );
 
 		ImGui::PopID();
 
@@ -1081,7 +1081,7 @@ namespace Engine::ImGuiDrawer
 
 		Draw( point_light.data.ambient_and_attenuation_constant.color, "Ambient"  );
 		Draw( point_light.data.diffuse_and_attenuation_linear.color,   "Diffuse"  );
-		Draw( point_light.data.specular_attenuation_quadratic.color,   "Specular" );
+		Draw( point_light.data.specular_and_attenuation_quadratic.color,   "Specular" );
 
 		Draw( const_cast< const Transform& >( *point_light.transform ), Transform::Mask::Translation, "Transform" );
 
@@ -1089,7 +1089,7 @@ namespace Engine::ImGuiDrawer
 		/* Since the read-only flag is passed, the passed pointer will not be modified. So this hack is safe to use here. */
 		ImGui::InputFloat( "Attenuation: Constant",	 const_cast< float* >( &point_light.data.ambient_and_attenuation_constant.scalar ), 0, 0, "%.3f", ImGuiInputTextFlags_ReadOnly );
 		ImGui::InputFloat( "Attenuation: Linear",	 const_cast< float* >( &point_light.data.diffuse_and_attenuation_linear.scalar	 ), 0, 0, "%.3f", ImGuiInputTextFlags_ReadOnly );
-		ImGui::InputFloat( "Attenuation: Quadratic", const_cast< float* >( &point_light.data.specular_attenuation_quadratic.scalar	 ), 0, 0, "%.3f", ImGuiInputTextFlags_ReadOnly );
+		ImGui::InputFloat( "Attenuation: Quadratic", const_cast< float* >( &point_light.data.specular_and_attenuation_quadratic.scalar	 ), 0, 0, "%.3f", ImGuiInputTextFlags_ReadOnly );
 		ImGui::PopStyleColor();
 
 		ImGuiUtility::EndGroupPanel( &dummy_enabled );
@@ -558,6 +558,8 @@ namespace Platform
 
 	void CleanUp()
 	{
+		StopWatchingDirectories();
+
 		glfwTerminate();
 	}
 
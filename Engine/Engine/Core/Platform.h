@@ -4,9 +4,13 @@
 #include "Math/Vector.hpp"
 
 // std Includes.
+#include <cstddef>
+#include <filesystem>
 #include <functional>
 #include <optional>
+#include <span>
 #include <utility>
+#include <vector>
 
 /* Contains & abstracts away platform-specific services. */
 namespace Platform
@@ -217,6 +221,43 @@ namespace Platform
 	std::optional< std::string > BrowseFileName( const std::vector< std::string >& filters, const std::string& prompt = "" );
 	std::optional< std::string > BrowseDirectory( const std::string& title, const std::string& folder_path = "" );
 
+	/* File Watching; The OS reports modifications (via ReadDirectoryChangesW() on Windows & inotify on Linux) to background thread(s), which queue them. */
+	/* Watches the files directly inside the directory (i.e., not recursively). Returns false if the directory can not be watched (or the platform does not support it). */
+	bool WatchDirectory( const std::filesystem::path& directory_path );
+	/* Returns the files modified (written or renamed into place) since the last call, without duplicates; This is just an atomic load when there are none. */
+	std::vector< std::filesystem::path > PopModifiedFiles();
+	void StopWatchingDirectories();
+
+	/* Memory-mapped Files; A read-only view of a whole file, paged in by the OS on first access instead of being read up front. */
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		/* Check IsOpen() for success. An empty file opens successfully, with an empty view. */
+		MappedFile( const std::filesystem::path& file_path );
+
+		MappedFile( const MappedFile& ) = delete;
+		MappedFile& operator =( const MappedFile& ) = delete;
+
+		MappedFile( MappedFile&& donor );
+		MappedFile& operator =( MappedFile&& donor );
+
+		~MappedFile();
+
+		inline bool IsOpen() const { return is_open; }
+
+		inline std::span< const std::byte > Data() const { return { data, size }; }
+		inline std::size_t Size() const { return size; }
+
+	private:
+		void Close();
+
+	private:
+		const std::byte* data = nullptr;
+		std::size_t size      = 0;
+		bool is_open          = false;
+	};
+
 	/* Time-keeping Facilities. */
 	float CurrentTime();
 
@@ -0,0 +1,134 @@
+#if defined( _WIN32 )
+// Windows Includes.
+#define WIN32_LEAN_AND_MEAN // Exclude rarely-used stuff from Windows headers
+#include <Windows.h>
+#else
+// POSIX Includes.
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Engine Includes.
+#include "Platform.h"
+
+// std Includes.
+#include <utility>
+
+namespace Platform
+{
+#if defined( _WIN32 )
+
+	/* The view keeps the file & the mapping object alive on its own, so both handles are closed right away. */
+	MappedFile::MappedFile( const std::filesystem::path& file_path )
+	{
+		const HANDLE file_handle = CreateFileW( file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+		if( file_handle == INVALID_HANDLE_VALUE )
+			return;
+
+		LARGE_INTEGER file_size;
+		if( not GetFileSizeEx( file_handle, &file_size ) )
+		{
+			CloseHandle( file_handle );
+			return;
+		}
+
+		/* Mapping an empty file is an error on Windows. */
+		if( file_size.QuadPart == 0 )
+		{
+			CloseHandle( file_handle );
+			is_open = true;
+			return;
+		}
+
+		if( const HANDLE mapping_handle = CreateFileMappingW( file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+			mapping_handle != nullptr )
+		{
+			if( const void* view = MapViewOfFile( mapping_handle, FILE_MAP_READ, 0, 0, 0 );
+				view != nullptr )
+			{
+				data    = reinterpret_cast< const std::byte* >( view );
+				size    = ( std::size_t )file_size.QuadPart;
+				is_open = true;
+			}
+
+			CloseHandle( mapping_handle );
+		}
+
+		CloseHandle( file_handle );
+	}
+
+	void MappedFile::Close()
+	{
+		if( data )
+			UnmapViewOfFile( data );
+	}
+
+#else
+
+	/* The mapping keeps the file alive on its own, so the descriptor is closed right away. */
+	MappedFile::MappedFile( const std::filesystem::path& file_path )
+	{
+		const int file_descriptor = open( file_path.c_str(), O_RDONLY | O_CLOEXEC );
+		if( file_descriptor == -1 )
+			return;
+
+		struct stat file_status;
+		if( fstat( file_descriptor, &file_status ) == -1 )
+		{
+			close( file_descriptor );
+			return;
+		}
+
+		/* Mapping an empty file is an error. */
+		if( file_status.st_size == 0 )
+		{
+			close( file_descriptor );
+			is_open = true;
+			return;
+		}
+
+		if( void* view = mmap( nullptr, ( std::size_t )file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0 );
+			view != MAP_FAILED )
+		{
+			data    = reinterpret_cast< const std::byte* >( view );
+			size    = ( std::size_t )file_status.st_size;
+			is_open = true;
+		}
+
+		close( file_descriptor );
+	}
+
+	void MappedFile::Close()
+	{
+		if( data )
+			munmap( const_cast< std::byte* >( data ), size );
+	}
+
+#endif
+
+	MappedFile::MappedFile( MappedFile&& donor )
+		:
+		data( std::exchange( donor.data, nullptr ) ),
+		size( std::exchange( donor.size, 0 ) ),
+		is_open( std::exchange( donor.is_open, false ) )
+	{
+	}
+
+	MappedFile& MappedFile::operator=( MappedFile&& donor )
+	{
+		Close();
+
+		data    = std::exchange( donor.data,    nullptr );
+		size    = std::exchange( donor.size,    0 );
+		is_open = std::exchange( donor.is_open, false );
+
+		return *this;
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+}
@@ -0,0 +1,265 @@
+#if defined( _WIN32 )
+// Windows Includes.
+#define WIN32_LEAN_AND_MEAN // Exclude rarely-used stuff from Windows headers
+#include <Windows.h>
+#elif defined( __linux__ )
+// Linux Includes.
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Engine Includes.
+#include "Platform.h"
+
+// std Includes.
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace Platform
+{
+	/* Filled by the watcher thread(s), emptied by PopModifiedFiles(). */
+	std::mutex MODIFIED_FILES_MUTEX;
+	std::vector< std::filesystem::path > MODIFIED_FILES;
+	std::atomic_bool MODIFIED_FILES_ARE_PENDING = false;
+
+	void QueueModifiedFile( std::filesystem::path&& file_path )
+	{
+		std::lock_guard lock( MODIFIED_FILES_MUTEX );
+
+		/* Saving a file usually causes multiple notifications; One entry is enough. */
+		if( std::find( MODIFIED_FILES.cbegin(), MODIFIED_FILES.cend(), file_path ) == MODIFIED_FILES.cend() )
+			MODIFIED_FILES.push_back( std::move( file_path ) );
+
+		MODIFIED_FILES_ARE_PENDING.store( true, std::memory_order_release );
+	}
+
+	std::vector< std::filesystem::path > PopModifiedFiles()
+	{
+		if( not MODIFIED_FILES_ARE_PENDING.load( std::memory_order_acquire ) )
+			return {};
+
+		std::lock_guard lock( MODIFIED_FILES_MUTEX );
+
+		MODIFIED_FILES_ARE_PENDING.store( false, std::memory_order_relaxed );
+		return std::exchange( MODIFIED_FILES, {} );
+	}
+
+#if defined( _WIN32 )
+
+	/* One thread per directory, each waiting on an overlapped ReadDirectoryChangesW() & a stop event. */
+	struct DirectoryWatch
+	{
+		std::filesystem::path directory_path;
+		HANDLE directory_handle;
+		HANDLE stop_event;
+		std::thread thread;
+	};
+
+	std::vector< std::unique_ptr< DirectoryWatch > > DIRECTORY_WATCHES;
+
+	void WatchDirectory_ThreadMain( DirectoryWatch& watch )
+	{
+		alignas( DWORD ) std::byte buffer[ 16 * 1024 ]; // FILE_NOTIFY_INFORMATION entries have to be DWORD-aligned.
+
+		OVERLAPPED overlapped{};
+		overlapped.hEvent = CreateEventW( nullptr, TRUE, FALSE, nullptr );
+
+		const HANDLE events_to_wait[ 2 ] = { overlapped.hEvent, watch.stop_event };
+
+		while( ReadDirectoryChangesW( watch.directory_handle, buffer, sizeof( buffer ), FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+									  nullptr, &overlapped, nullptr ) )
+		{
+			DWORD byte_count = 0;
+
+			if( WaitForMultipleObjects( 2, events_to_wait, FALSE, INFINITE ) != WAIT_OBJECT_0 )
+			{
+				/* Stopping; The buffer is in use until the cancellation completes. */
+				CancelIoEx( watch.directory_handle, &overlapped );
+				GetOverlappedResult( watch.directory_handle, &overlapped, &byte_count, TRUE );
+				break;
+			}
+
+			if( not GetOverlappedResult( watch.directory_handle, &overlapped, &byte_count, FALSE ) )
+				break;
+
+			/* Zero bytes means the buffer overflowed & individual notifications are lost; Nothing sensible to do about it but to wait for the next ones. */
+			if( byte_count == 0 )
+				continue;
+
+			for( auto info = reinterpret_cast< const FILE_NOTIFY_INFORMATION* >( buffer ); ;
+				 info = reinterpret_cast< const FILE_NOTIFY_INFORMATION* >( reinterpret_cast< const std::byte* >( info ) + info->NextEntryOffset ) )
+			{
+				if( info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_ADDED || info->Action == FILE_ACTION_RENAMED_NEW_NAME )
+					QueueModifiedFile( watch.directory_path / std::wstring_view( info->FileName, info->FileNameLength / sizeof( WCHAR ) ) );
+
+				if( info->NextEntryOffset == 0 )
+					break;
+			}
+		}
+
+		CloseHandle( overlapped.hEvent );
+	}
+
+	bool WatchDirectory( const std::filesystem::path& directory_path )
+	{
+		const HANDLE directory_handle = CreateFileW( directory_path.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+													 OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr );
+		if( directory_handle == INVALID_HANDLE_VALUE )
+			return false;
+
+		auto& watch = *DIRECTORY_WATCHES.emplace_back( std::make_unique< DirectoryWatch >() );
+		watch.directory_path   = directory_path;
+		watch.directory_handle = directory_handle;
+		watch.stop_event       = CreateEventW( nullptr, TRUE, FALSE, nullptr );
+		watch.thread           = std::thread( WatchDirectory_ThreadMain, std::ref( watch ) );
+
+		return true;
+	}
+
+	void StopWatchingDirectories()
+	{
+		for( auto& watch : DIRECTORY_WATCHES )
+		{
+			SetEvent( watch->stop_event );
+			watch->thread.join();
+
+			CloseHandle( watch->stop_event );
+			CloseHandle( watch->directory_handle );
+		}
+
+		DIRECTORY_WATCHES.clear();
+	}
+
+#elif defined( __linux__ )
+
+	/* A single inotify instance for all directories, read by a single thread which also waits on an eventfd to be told to stop. */
+	int INOTIFY_FILE_DESCRIPTOR = -1;
+	int STOP_EVENT_FILE_DESCRIPTOR = -1;
+	std::thread WATCH_THREAD;
+
+	std::mutex WATCH_DESCRIPTOR_MUTEX;
+	std::unordered_map< int, std::filesystem::path > WATCH_DESCRIPTOR_MAP;
+
+	void WatchDirectory_ThreadMain()
+	{
+		alignas( inotify_event ) char buffer[ 16 * 1024 ];
+
+		pollfd file_descriptors_to_wait[ 2 ] = { { INOTIFY_FILE_DESCRIPTOR, POLLIN, 0 }, { STOP_EVENT_FILE_DESCRIPTOR, POLLIN, 0 } };
+
+		while( true )
+		{
+			if( poll( file_descriptors_to_wait, 2, -1 ) < 0 )
+			{
+				if( errno == EINTR )
+					continue;
+
+				break;
+			}
+
+			if( file_descriptors_to_wait[ 1 ].revents != 0 )
+				break;
+
+			const auto byte_count = read( file_descriptors_to_wait[ 0 ].fd, buffer, sizeof( buffer ) );
+			if( byte_count <= 0 )
+				continue;
+
+			std::lock_guard lock( WATCH_DESCRIPTOR_MUTEX );
+
+			for( const char* current = buffer; current < buffer + byte_count; )
+			{
+				const auto* event = reinterpret_cast< const inotify_event* >( current );
+
+				if( event->len > 0 )
+					if( const auto iterator = WATCH_DESCRIPTOR_MAP.find( event->wd );
+						iterator != WATCH_DESCRIPTOR_MAP.cend() )
+						QueueModifiedFile( iterator->second / event->name );
+
+				current += sizeof( inotify_event ) + event->len;
+			}
+		}
+	}
+
+	bool WatchDirectory( const std::filesystem::path& directory_path )
+	{
+		if( INOTIFY_FILE_DESCRIPTOR == -1 )
+		{
+			if( INOTIFY_FILE_DESCRIPTOR = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+				INOTIFY_FILE_DESCRIPTOR == -1 )
+				return false;
+
+			if( STOP_EVENT_FILE_DESCRIPTOR = eventfd( 0, EFD_CLOEXEC );
+				STOP_EVENT_FILE_DESCRIPTOR == -1 )
+			{
+				/* The watcher thread could never be stopped without it. */
+				close( INOTIFY_FILE_DESCRIPTOR );
+				INOTIFY_FILE_DESCRIPTOR = -1;
+				return false;
+			}
+
+			WATCH_THREAD = std::thread( WatchDirectory_ThreadMain );
+		}
+
+		/* Editors either write files in place (IN_CLOSE_WRITE) or write a temporary & rename it over the original (IN_MOVED_TO). */
+		const int watch_descriptor = inotify_add_watch( INOTIFY_FILE_DESCRIPTOR, directory_path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO );
+		if( watch_descriptor == -1 )
+			return false;
+
+		std::lock_guard lock( WATCH_DESCRIPTOR_MUTEX );
+		WATCH_DESCRIPTOR_MAP[ watch_descriptor ] = directory_path;
+
+		return true;
+	}
+
+	void StopWatchingDirectories()
+	{
+		if( INOTIFY_FILE_DESCRIPTOR == -1 )
+			return;
+
+		const std::uint64_t value = 1;
+		ssize_t written_byte_count;
+		do
+			written_byte_count = write( STOP_EVENT_FILE_DESCRIPTOR, &value, sizeof( value ) );
+		while( written_byte_count == -1 && errno == EINTR );
+
+		/* Joining would block forever if the watcher thread was never woken up; Leave it blocked on poll() instead & let process exit take care of it.
+		 * The file descriptors are kept open for the same reason, as the thread may still be using them. */
+		if( written_byte_count != sizeof( value ) )
+		{
+			WATCH_THREAD.detach();
+			INOTIFY_FILE_DESCRIPTOR = STOP_EVENT_FILE_DESCRIPTOR = -1;
+
+			std::lock_guard lock( WATCH_DESCRIPTOR_MUTEX );
+			WATCH_DESCRIPTOR_MAP.clear();
+			return;
+		}
+
+		WATCH_THREAD.join();
+
+		close( STOP_EVENT_FILE_DESCRIPTOR );
+		close( INOTIFY_FILE_DESCRIPTOR );
+		INOTIFY_FILE_DESCRIPTOR = STOP_EVENT_FILE_DESCRIPTOR = -1;
+
+		WATCH_DESCRIPTOR_MAP.clear();
+	}
+
+#else
+
+	bool WatchDirectory( [[maybe_unused]] const std::filesystem::path& directory_path )
+	{
+		return false;
+	}
+
+	void StopWatchingDirectories()
+	{
+	}
+
+#endif
+}
@@ -0,0 +1,92 @@
+// Engine Includes.
+#include "Serialization.h"
+
+// std Includes.
+#include <bit>
+
+namespace Engine::Serialization
+{
+	Hasher& Hasher::Add( const std::span< const std::byte > data )
+	{
+		constexpr std::uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+		auto Mix = [ & ]( const std::uint64_t word )
+		{
+			/* The rotation feeds the high bits (which the multiplication accumulates into) back into the low bits of the next step. */
+			hash = std::rotl( ( hash ^ word ) * MULTIPLIER, 29 );
+		};
+
+		const std::size_t word_count = data.size() / sizeof( std::uint64_t );
+
+		for( std::size_t word_index = 0; word_index < word_count; word_index++ )
+		{
+			std::uint64_t word;
+			std::memcpy( &word, data.data() + word_index * sizeof( std::uint64_t ), sizeof( std::uint64_t ) );
+			Mix( word );
+		}
+
+		std::uint64_t remainder = 0;
+		std::memcpy( &remainder, data.data() + word_count * sizeof( std::uint64_t ), data.size() % sizeof( std::uint64_t ) );
+		Mix( remainder );
+
+		/* The size too, so that ( "ab", "c" ) & ( "a", "bc" ) hash differently. */
+		Mix( data.size() );
+
+		return *this;
+	}
+
+	std::uint64_t Hasher::Get() const
+	{
+		/* MurmurHash3's finalizer. */
+		std::uint64_t result = hash;
+		result ^= result >> 33;
+		result *= 0xFF51AFD7ED558CCDull;
+		result ^= result >> 33;
+		result *= 0xC4CEB9FE1A85EC53ull;
+		result ^= result >> 33;
+		return result;
+	}
+
+	Writer& Writer::WriteString( const std::string_view string )
+	{
+		Write( ( std::uint32_t )string.size() );
+		const auto* bytes = reinterpret_cast< const std::byte* >( string.data() );
+		metadata.insert( metadata.end(), bytes, bytes + string.size() );
+		return *this;
+	}
+
+	Writer& Writer::WriteBlob( const std::span< const std::byte > data )
+	{
+		const std::uint64_t offset = AlignToBlob( blobs.size() );
+
+		blobs.resize( offset );
+		blobs.insert( blobs.end(), data.begin(), data.end() );
+
+		Write( offset );
+		Write( ( std::uint64_t )data.size() );
+
+		return *this;
+	}
+
+	bool Reader::ReadString( std::string& string )
+	{
+		std::uint32_t size;
+		if( not Read( size ) || metadata.size() - offset < size )
+			return false;
+
+		string.assign( reinterpret_cast< const char* >( metadata.data() + offset ), size );
+		offset += size;
+		return true;
+	}
+
+	bool Reader::ReadBlob( std::span< const std::byte >& data )
+	{
+		std::uint64_t blob_offset, blob_size;
+		if( not Read( blob_offset ) || not Read( blob_size ) ||
+			blob_offset % BLOB_ALIGNMENT != 0 || blob_offset > blobs.size() || blobs.size() - blob_offset < blob_size )
+			return false;
+
+		data = blobs.subspan( blob_offset, blob_size );
+		return true;
+	}
+}
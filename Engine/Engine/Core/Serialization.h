@@ -0,0 +1,127 @@
+#pragma once
+
+// std Includes.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Engine::Serialization
+{
+	/* Building blocks of the on-disk caches (see ProgramBinaryCache & ModelCache). */
+
+	constexpr std::size_t BLOB_ALIGNMENT = 64;
+
+	constexpr std::size_t AlignToBlob( const std::size_t offset )
+	{
+		return ( offset + BLOB_ALIGNMENT - 1 ) / BLOB_ALIGNMENT * BLOB_ALIGNMENT;
+	}
+
+	/* 64-bit, consumes 8 bytes per step, as it runs over whole source files; std::hash is not guaranteed to be stable across runs/implementations. */
+	class Hasher
+	{
+	public:
+		Hasher& Add( const std::span< const std::byte > data );
+
+		inline Hasher& Add( const std::string_view string )
+		{
+			return Add( std::as_bytes( std::span( string ) ) );
+		}
+
+		template< typename Value > requires( std::is_trivially_copyable_v< Value > && not std::is_pointer_v< Value > )
+		Hasher& Add( const Value& value )
+		{
+			return Add( std::as_bytes( std::span( &value, 1 ) ) );
+		}
+
+		std::uint64_t Get() const;
+
+	private:
+		std::uint64_t hash = 14695981039346656037ull;
+	};
+
+	/* Values are stored as they are in memory, as the output is only ever read back on the same machine.
+	 * Large arrays can be written as blobs: These go to a section of their own, each at a BLOB_ALIGNMENT aligned offset, so that they can be used in place once read back
+	 * (e.g., straight out of a memory mapped file). */
+	class Writer
+	{
+	public:
+		template< typename Value > requires( std::is_trivially_copyable_v< Value > && not std::is_pointer_v< Value > )
+		Writer& Write( const Value& value )
+		{
+			const auto* bytes = reinterpret_cast< const std::byte* >( &value );
+			metadata.insert( metadata.end(), bytes, bytes + sizeof( Value ) );
+			return *this;
+		}
+
+		Writer& WriteString( const std::string_view string );
+
+		/* Appends the data to the blob section (at the next aligned offset) & writes its location into the metadata. */
+		Writer& WriteBlob( const std::span< const std::byte > data );
+
+		template< typename Element > requires( std::is_trivially_copyable_v< Element > && alignof( Element ) <= BLOB_ALIGNMENT )
+		Writer& WriteBlob( const std::span< const Element > data )
+		{
+			return WriteBlob( std::as_bytes( data ) );
+		}
+
+		inline const std::vector< std::byte >& Metadata() const { return metadata; }
+		inline const std::vector< std::byte >& Blobs()    const { return blobs;	   }
+
+	private:
+		std::vector< std::byte > metadata;
+		std::vector< std::byte > blobs;
+	};
+
+	/* Every read is bounds-checked; Returns false instead of reading past the end.
+	 * Does not own the data; Spans returned by ReadBlob() point into the blob section it was given. */
+	class Reader
+	{
+	public:
+		Reader( const std::span< const std::byte > metadata, const std::span< const std::byte > blobs = {} )
+			:
+			metadata( metadata ),
+			blobs( blobs ),
+			offset( 0 )
+		{}
+
+		template< typename Value > requires( std::is_trivially_copyable_v< Value > && not std::is_pointer_v< Value > )
+		bool Read( Value& value )
+		{
+			if( metadata.size() - offset < sizeof( Value ) )
+				return false;
+
+			std::memcpy( &value, metadata.data() + offset, sizeof( Value ) );
+			offset += sizeof( Value );
+			return true;
+		}
+
+		bool ReadString( std::string& string );
+
+		/* Also fails if the blob is not aligned or lies (partially) outside of the blob section. */
+		bool ReadBlob( std::span< const std::byte >& data );
+
+		/* Also fails if the blob's size is not a multiple of the element size. */
+		template< typename Element > requires( std::is_trivially_copyable_v< Element > && alignof( Element ) <= BLOB_ALIGNMENT )
+		bool ReadBlob( std::span< const Element >& data )
+		{
+			std::span< const std::byte > bytes;
+			if( not ReadBlob( bytes ) || bytes.size() % sizeof( Element ) != 0 )
+				return false;
+
+			data = std::span( reinterpret_cast< const Element* >( bytes.data() ), bytes.size() / sizeof( Element ) );
+			return true;
+		}
+
+		inline bool IsAtEnd() const { return offset == metadata.size(); }
+
+	private:
+		std::span< const std::byte > metadata;
+		std::span< const std::byte > blobs;
+		std::size_t offset;
+	};
+}
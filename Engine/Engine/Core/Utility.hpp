@@ -1,6 +1,7 @@
 #pragma once
 
 // std Includes.
+#include <algorithm>
 #include <array>
 #include <optional>
 #include <string>
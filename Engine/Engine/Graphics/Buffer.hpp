@@ -45,6 +45,25 @@ namespace Engine
 
 			Create( nullptr, usage );
 
+#ifdef _DEBUG
+			if( not name.empty() )
+				ServiceLocator< GLLogger >::Get().SetLabel( GL_BUFFER, id.Get(), name );
+#endif // _DEBUG
+		}
+
+		/* Only allocate memory, for a buffer that will be filled via Map_Write() or Update(); See the count & span constructor below for why the count is needed. */
+		Buffer( const unsigned int count, const unsigned int size, const std::string& name = {}, const GLenum usage = GL_STATIC_DRAW )
+			:
+			id( ID( 0 ) ),
+			name( name ),
+			count( count ),
+			size( size )
+		{
+			ASSERT_DEBUG_ONLY( size > 0 && count > 0 && "'size' or 'count' parameter passed to "
+							   "Buffer::Buffer( const unsigned int count, const unsigned int size, const std::string& name, const GLenum usage ) is zero!" );
+
+			Create( nullptr, usage );
+
 #ifdef _DEBUG
 			if( not name.empty() )
 				ServiceLocator< GLLogger >::Get().SetLabel( GL_BUFFER, id.Get(), name );
@@ -165,6 +184,29 @@ namespace Engine
 			glBufferSubData( TargetType, ( GLintptr )offset_from_buffer_start, ( GLsizeiptr )data_span.size_bytes(), ( void* )data_span.data() );
 		}
 
+		/* Maps the whole buffer for writing, discarding its previous contents; Returns nullptr on failure. Has to be followed by Unmap() before the buffer is used. */
+		std::byte* Map_Write() const
+		{
+			Bind();
+			return reinterpret_cast< std::byte* >( glMapBufferRange( TargetType, 0, ( GLsizeiptr )size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT ) );
+		}
+
+		/* Returns false if the contents got corrupted while mapped (e.g., due to a display mode change) & have to be uploaded again. */
+		bool Unmap() const
+		{
+			Bind();
+			return glUnmapBuffer( TargetType ) == GL_TRUE;
+		}
+
+		/* Copies the whole buffer back to the CPU; destination has to be at least Size() bytes. Waits for the GPU, so it is not meant for per-frame use. */
+		void Read( const std::span< std::byte > destination ) const
+		{
+			ASSERT_DEBUG_ONLY( destination.size() >= size && "'destination' parameter passed to Buffer::Read() is smaller than the buffer!" );
+
+			Bind();
+			glGetBufferSubData( TargetType, 0, ( GLsizeiptr )size, destination.data() );
+		}
+
 	/* Queries: */
 
 		bool IsValid() const { return id.IsValid(); } // Use the size to implicitly define validness state.
@@ -23,6 +23,6 @@ namespace Engine
 		static void Initialize( Renderer& renderer );
 
 	private:
-		static std::unordered_map< std::string, Shader > SHADER_MAP;
+		static std::unordered_map< std::string, Shader* > SHADER_MAP;
 	};
 }
@@ -16,7 +16,7 @@ namespace Engine::Lighting
 
 	struct PointLightData : public Std140StructTag
 	{
-		Color3_AndScalar ambient_and_attenuation_constant, diffuse_and_attenuation_linear, specular_attenuation_quadratic;
+		Color3_AndScalar ambient_and_attenuation_constant, diffuse_and_attenuation_linear, specular_and_attenuation_quadratic;
 		Vector3_Padded position_view_space;
 	};
 
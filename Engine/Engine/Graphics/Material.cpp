@@ -24,11 +24,16 @@ namespace Engine
 		:
 		name( name ),
 		shader( shader ),
-		uniform_blob_default_block( shader->GetTotalUniformSize_DefaultBlockOnly() ),
-		uniform_info_map( &shader->GetUniformInfoMap() )
+		uniform_info_map( nullptr )
 	{
 		ASSERT_DEBUG_ONLY( HasShaderAssigned() && "Parameter 'shader' passed to Material::Material( const std::string& name, Shader* const shader ) is nullptr!" );
-		
+
+		/* Variants from the ShaderVariantCache are compiled on first use; Reflection data is needed right away. */
+		shader->CompileIfNeeded();
+
+		uniform_blob_default_block = Blob( shader->GetTotalUniformSize_DefaultBlockOnly() );
+		uniform_info_map           = &shader->GetUniformInfoMap();
+
 		const auto& uniform_buffer_info_map = shader->GetUniformBufferInfoMap_Regular();
 
 		for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map )
@@ -43,6 +48,8 @@ namespace Engine
 
 	const Shader* Material::Bind() const
 	{
+		/* Evicted variants (see ShaderVariantCache) are recompiled on their next use. */
+		shader->CompileIfNeeded();
 		shader->Bind(); 
 		return shader;
 	}
@@ -60,6 +67,8 @@ namespace Engine
 		/* Setting new data: */
 		this->shader = shader;
 
+		shader->CompileIfNeeded();
+
 		uniform_blob_default_block = Blob( shader->GetTotalUniformSize_DefaultBlockOnly() );
 
 		uniform_info_map = ( &shader->GetUniformInfoMap() );
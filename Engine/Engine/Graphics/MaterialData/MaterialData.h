@@ -13,6 +13,9 @@ namespace Engine::MaterialData
 		int has_texture_diffuse;
 
 		float shininess;
+
+		/* GLSL-side "vec3 padding" starts at the next vec4 boundary (offset 32) & the block is rounded up to 48 bytes. Whole block is uploaded via Set(), so the C++ side has to cover all of it. */
+		float padding[ 7 ];
 	};
 
 	struct BasicColorMaterialData : public Std140StructTag
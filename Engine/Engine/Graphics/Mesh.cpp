@@ -1,7 +1,11 @@
 // Engine Includes.
 #include "Mesh.h"
+#include "VertexCompression.h"
 #include "Asset/Shader/_Attributes.glsl"
 
+// std Includes.
+#include <algorithm>
+
 namespace Engine
 {
 	Mesh::Mesh()
@@ -13,26 +17,64 @@ namespace Engine
 				const std::string&				name,
 				std::vector< Vector3 >&&		normals,
 				std::vector< Vector2 >&&		uvs,
-				std::vector< std::uint32_t >&&	indices,
+				IndexData&&						indices,
+				std::vector< Vector3 >&&		tangents,
+				const PrimitiveType				primitive_type,
+				const GLenum					usage,
+				const BitFlags< CompressedAttribute > compressed_attributes,
+				const VertexLayout::Arrangement	arrangement )
+		:
+		name( name ),
+		indices( NarrowIndices( std::move( indices ), positions.size() ) ),
+		positions( std::move( positions ) ),
+		normals( std::move( normals ) ),
+		tangents( std::move( tangents ) ),
+		uvs( std::move( uvs ) ),
+		primitive_type( primitive_type ),
+		instance_count( 1 ),
+		compressed_attributes( compressed_attributes )
+	{
+		CreateVertexBufferAndLayout( usage, arrangement );
+
+		index_buffer  = std::visit( [ & ]( const auto& index_vector )
+									{
+										return index_vector.empty() ? std::nullopt : std::optional< IndexBuffer >( std::in_place, std::span( index_vector ), name + " Index Buffer", usage );
+									}, this->indices );
+		vertex_array  = VertexArray( vertex_buffer, vertex_layout, index_buffer, name + " VAO");
+	}
+
+	Mesh::Mesh( std::vector< Vector3 >&&		positions,
+				const std::string&				name,
+				std::vector< Vector3 >&&		normals,
+				std::vector< Vector2 >&&		uvs,
+				IndexData&&						indices,
 				std::vector< Vector3 >&&		tangents,
 				const PrimitiveType				primitive_type,
-				const GLenum					usage )
+				const GLenum					usage,
+				const BitFlags< CompressedAttribute > compressed_attributes,
+				const EncodedVertices&			encoded_vertices )
 		:
 		name( name ),
-		indices( indices ),
-		positions( positions ),
-		normals( normals ),
-		tangents( tangents ),
-		uvs( uvs ),
+		indices( NarrowIndices( std::move( indices ), positions.size() ) ),
+		positions( std::move( positions ) ),
+		normals( std::move( normals ) ),
+		tangents( std::move( tangents ) ),
+		uvs( std::move( uvs ) ),
 		primitive_type( primitive_type ),
-		instance_count( 1 )
+		instance_count( 1 ),
+		compressed_attributes( compressed_attributes ),
+		position_dequantization_transform( encoded_vertices.position_dequantization_transform )
 	{
-		unsigned int vertex_count_interleaved;
-		const auto interleaved_vertices = MeshUtility::Interleave( vertex_count_interleaved, positions, normals, uvs, tangents );
+		vertex_layout = VertexLayout( GatherAttributes( this->positions, this->normals, this->uvs, this->tangents, compressed_attributes ), encoded_vertices.arrangement );
 
-		vertex_buffer = VertexBuffer( vertex_count_interleaved, std::span( interleaved_vertices ), name + " Vertex Buffer", usage );
-		vertex_layout = VertexLayout( GatherAttributes( positions, normals, uvs, tangents ) );
-		index_buffer  = indices.empty() ? std::nullopt : std::optional< IndexBuffer >( std::in_place, std::span( indices ), name + " Index Buffer", usage );
+		ASSERT_DEBUG_ONLY( encoded_vertices.data.size() == this->positions.size() * vertex_layout.Stride_NonInstanced() &&
+						   "Mesh::Mesh(): Size of the encoded vertices does not match the vertex count & layout!" );
+
+		vertex_buffer = VertexBuffer( ( unsigned int )this->positions.size(), encoded_vertices.data, name + " Vertex Buffer", usage );
+		index_buffer  = std::visit( [ & ]( const auto& index_vector )
+									{
+										return index_vector.empty() ? std::nullopt : std::optional< IndexBuffer >( std::in_place, std::span( index_vector ), name + " Index Buffer", usage );
+									}, this->indices );
 		vertex_array  = VertexArray( vertex_buffer, vertex_layout, index_buffer, name + " VAO");
 	}
 
@@ -50,6 +92,8 @@ namespace Engine
 		uvs( other.uvs ),
 		primitive_type( other.primitive_type ),
 		instance_count( instance_count ),
+		compressed_attributes( other.compressed_attributes ),
+		position_dequantization_transform( other.position_dequantization_transform ),
 		vertex_buffer( other.vertex_buffer ),
 		vertex_layout( other.vertex_layout ),
 		index_buffer( other.index_buffer )
@@ -89,20 +133,125 @@ namespace Engine
 		instance_buffer->Update_Partial( data_span, offset_from_buffer_start );
 	}
 
+	std::vector< std::byte > Mesh::VertexData() const
+	{
+		std::vector< std::byte > data( vertex_buffer.Size() );
+		vertex_buffer.Read( data );
+		return data;
+	}
+
+	std::size_t Mesh::EncodedVerticesSize( const std::vector< Vector3 >& positions,
+										   const std::vector< Vector3 >& normals,
+										   const std::vector< Vector2 >& uvs,
+										   const std::vector< Vector3 >& tangents,
+										   const BitFlags< CompressedAttribute > compressed_attributes,
+										   const VertexLayout::Arrangement arrangement )
+	{
+		return positions.size() * VertexLayout( GatherAttributes( positions, normals, uvs, tangents, compressed_attributes ), arrangement ).Stride_NonInstanced();
+	}
+
+	Mesh::IndexData Mesh::NarrowIndices( IndexData&& indices, const std::size_t vertex_count )
+	{
+		if( const auto* indices_u32 = std::get_if< std::vector< std::uint32_t > >( &indices );
+			indices_u32 && CanUse16BitIndices( vertex_count ) )
+		{
+			std::vector< std::uint16_t > indices_u16( indices_u32->size() );
+			std::transform( indices_u32->cbegin(), indices_u32->cend(), indices_u16.begin(), []( const std::uint32_t index ) { return std::uint16_t( index ); } );
+			return indices_u16;
+		}
+
+		return std::move( indices );
+	}
+
+	void Mesh::CreateVertexBufferAndLayout( const GLenum usage, const VertexLayout::Arrangement arrangement )
+	{
+		const bool compress_positions = HasQuantizedPositions() && not positions.empty();
+		const bool compress_normals   = compressed_attributes.IsSet( CompressedAttribute::NormalsAndTangents );
+		const bool compress_uvs       = compressed_attributes.IsSet( CompressedAttribute::Uvs );
+
+		std::vector< VertexCompression::QuantizedPosition > quantized_positions( compress_positions ? positions.size() : 0 );
+		std::vector< VertexCompression::PackedVector3 >     packed_normals( compress_normals ? normals.size() : 0 );
+		std::vector< VertexCompression::PackedVector3 >     packed_tangents( compress_normals ? tangents.size() : 0 );
+		std::vector< VertexCompression::HalfVector2 >       half_uvs( compress_uvs ? uvs.size() : 0 );
+
+		if( compress_positions )
+			position_dequantization_transform = VertexCompression::QuantizePositions( positions, quantized_positions );
+		if( compress_normals )
+		{
+			VertexCompression::PackUnitVectors( normals, packed_normals );
+			VertexCompression::PackUnitVectors( tangents, packed_tangents );
+		}
+		if( compress_uvs )
+			VertexCompression::ConvertToHalf( uvs, half_uvs );
+
+		/* In attribute location order; Empty streams (absent attributes) are skipped. */
+		const std::array< MeshUtility::VertexStream, 4 > streams
+		{
+			compress_positions	? MeshUtility::VertexStream( quantized_positions )	: MeshUtility::VertexStream( positions ),
+			compress_normals	? MeshUtility::VertexStream( packed_normals )		: MeshUtility::VertexStream( normals ),
+			compress_uvs		? MeshUtility::VertexStream( half_uvs )				: MeshUtility::VertexStream( uvs ),
+			compress_normals	? MeshUtility::VertexStream( packed_tangents )		: MeshUtility::VertexStream( tangents )
+		};
+
+		const std::size_t vertex_count = positions.size();
+		const std::size_t size         = vertex_count * MeshUtility::VertexSize( streams );
+
+		auto WriteVertices = [ & ]( std::span< std::byte > destination )
+		{
+			if( arrangement == VertexLayout::Arrangement::Planar )
+				MeshUtility::WritePlanar( destination, vertex_count, streams );
+			else
+				MeshUtility::WriteInterleaved( destination, vertex_count, streams );
+		};
+
+		vertex_buffer = VertexBuffer( ( unsigned int )vertex_count, ( unsigned int )size, name + " Vertex Buffer", usage );
+
+		/* Write straight into driver memory to skip an intermediate copy; Fall back to a regular upload if mapping fails or the mapped contents got lost. */
+		bool is_written = false;
+		if( std::byte* mapped_vertices = vertex_buffer.Map_Write();
+			mapped_vertices != nullptr )
+		{
+			WriteVertices( std::span( mapped_vertices, size ) );
+			is_written = vertex_buffer.Unmap();
+		}
+
+		if( not is_written )
+		{
+			ServiceLocator< GLLogger >::Get().Warning( "Could not write to the mapped vertex buffer of \"" + name + "\"; Falling back to glBufferSubData()." );
+
+			std::vector< std::byte > vertices( size );
+			WriteVertices( vertices );
+			vertex_buffer.Update( vertices.data() );
+		}
+
+		vertex_layout = VertexLayout( GatherAttributes( positions, normals, uvs, tangents, compressed_attributes ), arrangement );
+	}
+
 	std::array< VertexAttribute, 4 > Mesh::GatherAttributes( const std::vector< Vector3 >& positions, const std::vector< Vector3 >& normals,
 															 const std::vector< Vector2 >& uvs,
-															 const std::vector< Vector3 >& tangents )
+															 const std::vector< Vector3 >& tangents,
+															 const BitFlags< CompressedAttribute > compressed_attributes )
 	{
 		auto CountOf = []( auto&& attribute_container ) { return attribute_container.empty() ? 0 : int( sizeof( attribute_container.front() ) / sizeof( float ) ); };
+		auto CountOf_Compressed = []( auto&& attribute_container, const int component_count ) { return attribute_container.empty() ? 0 : component_count; };
+
+		constexpr bool is_instanced  = false;
+		constexpr bool is_normalized = true;
 
-		constexpr bool is_instanced = false;
+		/* Packed normals & tangents are declared with 4 components, as GL requires for GL_INT_2_10_10_10_REV; Shaders read them as vec3. */
+		const auto position = compressed_attributes.IsSet( CompressedAttribute::Positions )
+			? VertexAttribute{ CountOf_Compressed( positions, 4 ),	GL_SHORT,				is_instanced, POSITION_LOCATION, is_normalized }
+			: VertexAttribute{ CountOf( positions ),				GL_FLOAT,				is_instanced, POSITION_LOCATION };
+		const auto normal = compressed_attributes.IsSet( CompressedAttribute::NormalsAndTangents )
+			? VertexAttribute{ CountOf_Compressed( normals, 4 ),	GL_INT_2_10_10_10_REV,	is_instanced, NORMAL_LOCATION, is_normalized }
+			: VertexAttribute{ CountOf( normals ),					GL_FLOAT,				is_instanced, NORMAL_LOCATION };
+		const auto uv = compressed_attributes.IsSet( CompressedAttribute::Uvs )
+			? VertexAttribute{ CountOf_Compressed( uvs, 2 ),		GL_HALF_FLOAT,			is_instanced, TEXCOORDS_LOCATION }
+			: VertexAttribute{ CountOf( uvs ),						GL_FLOAT,				is_instanced, TEXCOORDS_LOCATION };
+		const auto tangent = compressed_attributes.IsSet( CompressedAttribute::NormalsAndTangents )
+			? VertexAttribute{ CountOf_Compressed( tangents, 4 ),	GL_INT_2_10_10_10_REV,	is_instanced, TANGENT_LOCATION, is_normalized }
+			: VertexAttribute{ CountOf( tangents ),					GL_FLOAT,				is_instanced, TANGENT_LOCATION };
 
-		return std::array< VertexAttribute, 4 >
-		( {
-			VertexAttribute{ CountOf( positions ),		GL_FLOAT,	is_instanced, POSITION_LOCATION		},
-			VertexAttribute{ CountOf( normals ),		GL_FLOAT,	is_instanced, NORMAL_LOCATION		},
-			VertexAttribute{ CountOf( uvs ),			GL_FLOAT,	is_instanced, TEXCOORDS_LOCATION	},
-			VertexAttribute{ CountOf( tangents ),		GL_FLOAT,	is_instanced, TANGENT_LOCATION		},
-		} );
+		return std::array< VertexAttribute, 4 >( { position, normal, uv, tangent } );
 	}
 }
@@ -4,9 +4,11 @@
 #include "Color.hpp"
 #include "MeshUtility.hpp"
 #include "VertexArray.h"
+#include "Core/BitFlags.hpp"
 
 // std Includes.
 #include <array>
+#include <variant>
 
 namespace Engine
 {
@@ -25,6 +27,41 @@ namespace Engine
 			Quads			= GL_QUADS
 		};
 
+		/* Attributes stored in compact formats on the GPU (see VertexCompression.h); CPU-side copies (Positions() etc.) always stay in full precision. */
+		enum class CompressedAttribute : std::uint8_t
+		{
+			None = 0,
+
+			Positions          = 1, // 4x normalized GL_SHORT; Decoded in the vertex shader with PositionDequantizationTransform() (see _Attributes.glsl).
+			NormalsAndTangents = 2, // Normalized GL_INT_2_10_10_10_REV.
+			Uvs                = 4, // 2x GL_HALF_FLOAT.
+
+			All = Positions | NormalsAndTangents | Uvs
+		};
+
+		/* Indices are stored (on both the CPU & the GPU) as 16-bit whenever the vertex count allows it; 32-bit indices passed for such meshes are narrowed. */
+		using IndexData = std::variant< std::vector< std::uint16_t >, std::vector< std::uint32_t > >;
+
+		static constexpr std::size_t MAX_VERTEX_COUNT_FOR_16_BIT_INDICES = 65536;
+
+		static constexpr bool CanUse16BitIndices( const std::size_t vertex_count ) { return vertex_count <= MAX_VERTEX_COUNT_FOR_16_BIT_INDICES; }
+
+		/* The size EncodedVertices::data has to be for the given attributes; For validating encoded vertices coming from outside (e.g., the ModelCache). */
+		static std::size_t EncodedVerticesSize( const std::vector< Vector3 >& positions,
+												const std::vector< Vector3 >& normals,
+												const std::vector< Vector2 >& uvs,
+												const std::vector< Vector3 >& tangents,
+												const BitFlags< CompressedAttribute > compressed_attributes,
+												const VertexLayout::Arrangement arrangement );
+
+		/* Vertex data already in the form the first constructor uploads, i.e., with the compressed attributes encoded & arranged; See VertexData(). */
+		struct EncodedVertices
+		{
+			std::span< const std::byte > data;
+			VertexLayout::Arrangement arrangement;
+			Matrix4x4 position_dequantization_transform;
+		};
+
 	public:
 		Mesh();
 
@@ -35,10 +72,25 @@ namespace Engine
 			  const std::string&				name			= {},
 			  std::vector< Vector3			>&& normals			= {},
 			  std::vector< Vector2			>&& uvs			= {},
-			  std::vector< std::uint32_t	>&& indices		    = {},
+			  IndexData&&						indices		    = {},
 			  std::vector< Vector3			>&& tangents		= {},
 			  const PrimitiveType				primitive_type	= PrimitiveType::Triangles,
-			  const GLenum						usage			= GL_STATIC_DRAW );
+			  const GLenum						usage			= GL_STATIC_DRAW,
+			  const BitFlags< CompressedAttribute > compressed_attributes = CompressedAttribute::None,
+			  const VertexLayout::Arrangement	arrangement		= VertexLayout::Arrangement::Interleaved );
+
+		/* Uploads the encoded vertices as they are, without any per-vertex processing (e.g., when loading from the ModelCache);
+		 * The attributes still have to be passed (in full precision), as they make up the CPU-side copies & determine the vertex layout. */
+		Mesh( std::vector< Vector3			>&& positions,
+			  const std::string&				name,
+			  std::vector< Vector3			>&& normals,
+			  std::vector< Vector2			>&& uvs,
+			  IndexData&&						indices,
+			  std::vector< Vector3			>&& tangents,
+			  const PrimitiveType				primitive_type,
+			  const GLenum						usage,
+			  const BitFlags< CompressedAttribute > compressed_attributes,
+			  const EncodedVertices&			encoded_vertices );
 
 		Mesh( const Mesh& other,
 			  const std::initializer_list< VertexInstanceAttribute > instanced_attributes,
@@ -53,6 +105,7 @@ namespace Engine
 	 */
 
 		inline void Bind() const { vertex_array.Bind(); }
+		/* Expects data in the Mesh's vertex layout, including its compressed attribute formats. */
 		void Update( const void* data ) const;
 		void Update_Partial( const std::span< std::byte > data_span, const std::size_t offset_from_buffer_start ) const;
 		void UpdateInstanceData( const void* data ) const;
@@ -82,15 +135,24 @@ namespace Engine
 		inline bool HasInstancing() const { return ( bool )instance_buffer; }
 		inline int InstanceCount() const { return instance_count; }
 
+		inline VertexLayout::Arrangement VertexArrangement() const { return vertex_layout.VertexArrangement(); }
+
 		inline bool IsCompatibleWith( const VertexLayout& other_vertex_layout ) const { return vertex_layout.IsCompatibleWith( other_vertex_layout ); }
 
+		inline BitFlags< CompressedAttribute > CompressedAttributes() const { return compressed_attributes; }
+		inline bool HasQuantizedPositions() const { return compressed_attributes.IsSet( CompressedAttribute::Positions ); }
+
+		/* Maps the quantized [-1, +1] positions back to object space; Identity for non-quantized positions. */
+		inline const Matrix4x4& PositionDequantizationTransform() const { return position_dequantization_transform; }
+
 	/*
 	 * Index Data:
 	 */
 
-		inline const std::vector< std::uint32_t >&	Indices()		const { return indices; };
-		inline const std::uint32_t*					Indices_Raw()	const { return indices.data(); };
-		inline constexpr GLenum						IndexType()		const { return GL_UNSIGNED_INT; }
+		inline const IndexData&	Indices()		const { return indices; };
+		inline const void*		Indices_Raw()	const { return std::visit( []( const auto& index_vector ) -> const void* { return index_vector.data(); }, indices ); };
+		inline bool				Has16BitIndices() const { return std::holds_alternative< std::vector< std::uint16_t > >( indices ); }
+		inline GLenum			IndexType()		const { return Has16BitIndices() ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; }
 
 	/*
 	 * Vertex Data:
@@ -106,16 +168,25 @@ namespace Engine
 		inline const float* Tangents_Raw()		const { return reinterpret_cast< const float* >( tangents.data()	); };
 		inline const float* Uvs_Raw()			const { return reinterpret_cast< const float* >( uvs.data()			); };
 
+		/* Reads the vertex buffer back from the GPU, i.e., encoded & arranged as it was uploaded; Waits for the GPU. */
+		std::vector< std::byte > VertexData() const;
+
 	private:
+		static IndexData NarrowIndices( IndexData&& indices, const std::size_t vertex_count );
+
+		/* Encodes the compressed attributes & writes the vertex data directly into the (mapped) vertex buffer in the given arrangement; Creates the vertex layout too. */
+		void CreateVertexBufferAndLayout( const GLenum usage, const VertexLayout::Arrangement arrangement );
+
 		static std::array< VertexAttribute, 4 > GatherAttributes( const std::vector< Vector3 >& positions,
 																  const std::vector< Vector3 >& normals,
 																  const std::vector< Vector2 >& uvs,
-																  const std::vector< Vector3 >& tangents );
+																  const std::vector< Vector3 >& tangents,
+																  const BitFlags< CompressedAttribute > compressed_attributes );
 
  	private:
 		std::string name;
 
-		std::vector< std::uint32_t > indices;
+		IndexData indices;
 
 		std::vector< Vector3 > positions;
 		std::vector< Vector3 > normals;
@@ -126,6 +197,9 @@ namespace Engine
 
 		int instance_count;
 
+		BitFlags< CompressedAttribute > compressed_attributes;
+		Matrix4x4 position_dequantization_transform;
+
 		VertexBuffer vertex_buffer;
 		VertexLayout vertex_layout;
 		std::optional< IndexBuffer > index_buffer;
@@ -0,0 +1,310 @@
+// Engine Includes.
+#include "MeshOptimization.h"
+#include "Core/Assertion.h"
+
+// std Includes.
+#include <algorithm>
+#include <numeric>
+
+namespace Engine::MeshOptimization
+{
+	template< typename IndexType >
+	VertexCacheStatistics AnalyzeVertexCache( std::span< const IndexType > indices, const std::size_t vertex_count, const unsigned int cache_size )
+	{
+		if( indices.size() < 3 || vertex_count == 0 )
+			return { 0.0f, 0.0f };
+
+		/* A vertex is in the FIFO if fewer than cache_size vertices have been pushed since it was. */
+		std::vector< std::uint32_t > cache_timestamps( vertex_count, 0 );
+		std::uint32_t timestamp = cache_size + 1;
+		std::size_t miss_count  = 0;
+
+		for( const auto index : indices )
+		{
+			if( timestamp - cache_timestamps[ index ] > cache_size )
+			{
+				cache_timestamps[ index ] = timestamp++;
+				miss_count++;
+			}
+		}
+
+		return
+		{
+			.acmr = float( miss_count ) / float( indices.size() / 3 ),
+			.atvr = float( miss_count ) / float( vertex_count )
+		};
+	}
+
+	template< typename IndexType >
+	std::vector< std::uint32_t > OptimizeVertexCache( std::span< IndexType > indices, const std::size_t vertex_count, const unsigned int cache_size,
+													  const float cluster_acmr_threshold )
+	{
+		ASSERT_DEBUG_ONLY( indices.size() % 3 == 0 && "MeshOptimization::OptimizeVertexCache(): Index count is not a multiple of 3!" );
+
+		const std::size_t triangle_count = indices.size() / 3;
+
+		std::vector< std::uint32_t > cluster_starts;
+		if( triangle_count == 0 )
+			return cluster_starts;
+
+		/* Triangles using each vertex (in compressed row form) & how many of them are yet to be emitted. */
+		std::vector< std::uint32_t > live_triangle_counts( vertex_count, 0 );
+		for( const auto index : indices )
+			live_triangle_counts[ index ]++;
+
+		std::vector< std::uint32_t > adjacency_offsets( vertex_count + 1, 0 );
+		std::inclusive_scan( live_triangle_counts.cbegin(), live_triangle_counts.cend(), adjacency_offsets.begin() + 1 );
+
+		std::vector< std::uint32_t > adjacent_triangles( indices.size() );
+		{
+			std::vector< std::uint32_t > write_offsets( adjacency_offsets.cbegin(), adjacency_offsets.cend() - 1 );
+			for( std::uint32_t triangle = 0; triangle < triangle_count; triangle++ )
+				for( auto corner = 0; corner < 3; corner++ )
+					adjacent_triangles[ write_offsets[ indices[ triangle * 3 + corner ] ]++ ] = triangle;
+		}
+
+		std::vector< std::uint32_t > cache_timestamps( vertex_count, 0 );
+		std::vector< std::uint8_t >  is_emitted( triangle_count, false );
+		std::vector< std::uint32_t > dead_end_stack;
+		std::vector< std::uint32_t > candidates;
+		std::vector< IndexType >     result;
+
+		dead_end_stack.reserve( indices.size() );
+		result.reserve( indices.size() );
+
+		std::uint32_t timestamp = cache_size + 1;
+		std::size_t   cursor    = 0;
+
+		/* Recently used vertices with remaining triangles first, then the remaining vertices in input order. Returns -1 when all triangles are emitted. */
+		auto SkipDeadEnd = [ & ]() -> std::int64_t
+		{
+			while( not dead_end_stack.empty() )
+			{
+				const auto vertex = dead_end_stack.back();
+				dead_end_stack.pop_back();
+
+				if( live_triangle_counts[ vertex ] > 0 )
+					return vertex;
+			}
+
+			for( ; cursor < vertex_count; cursor++ )
+				if( live_triangle_counts[ cursor ] > 0 )
+					return cursor;
+
+			return -1;
+		};
+
+		cluster_starts.push_back( 0 );
+
+		std::int64_t fanning_vertex = SkipDeadEnd();
+
+		while( fanning_vertex >= 0 )
+		{
+			candidates.clear();
+
+			/* Emit all remaining triangles around the fanning vertex. */
+			for( auto adjacency_index = adjacency_offsets[ fanning_vertex ]; adjacency_index < adjacency_offsets[ fanning_vertex + 1 ]; adjacency_index++ )
+			{
+				const auto triangle = adjacent_triangles[ adjacency_index ];
+				if( is_emitted[ triangle ] )
+					continue;
+
+				for( auto corner = 0; corner < 3; corner++ )
+				{
+					const IndexType vertex = indices[ triangle * 3 + corner ];
+
+					result.push_back( vertex );
+					dead_end_stack.push_back( vertex );
+					candidates.push_back( vertex );
+
+					live_triangle_counts[ vertex ]--;
+
+					if( timestamp - cache_timestamps[ vertex ] > cache_size )
+						cache_timestamps[ vertex ] = timestamp++;
+				}
+
+				is_emitted[ triangle ] = true;
+			}
+
+			/* Continue with the candidate that has been in the cache the longest, among the ones that will still be in the cache after emitting all of their triangles.
+			 * Candidates which would fall out of the cache are only picked if there are no others. */
+			std::int64_t next_vertex   = -1;
+			std::int64_t best_priority = -1;
+
+			for( const auto candidate : candidates )
+			{
+				if( live_triangle_counts[ candidate ] == 0 )
+					continue;
+
+				const std::int64_t age      = timestamp - cache_timestamps[ candidate ];
+				const std::int64_t priority = age + 2 * live_triangle_counts[ candidate ] <= cache_size ? age : 0;
+
+				if( priority > best_priority )
+				{
+					best_priority = priority;
+					next_vertex   = candidate;
+				}
+			}
+
+			if( next_vertex == -1 )
+			{
+				next_vertex = SkipDeadEnd();
+
+				if( next_vertex >= 0 )
+					cluster_starts.push_back( std::uint32_t( result.size() / 3 ) );
+			}
+
+			fanning_vertex = next_vertex;
+		}
+
+		std::copy( result.cbegin(), result.cend(), indices.begin() );
+
+		/* Soft boundaries: Hard boundaries alone are rare on well-connected meshes (often, the whole mesh is a single cluster), leaving nothing to reorder.
+		 * Each cluster is simulated from a cold cache, as that is the worst case it can end up in after reordering. */
+		std::vector< std::uint32_t > all_cluster_starts;
+		all_cluster_starts.reserve( cluster_starts.size() );
+
+		std::size_t   hard_boundary_index = 0;
+		std::uint32_t cluster_start       = 0;
+		std::size_t   cluster_miss_count  = 0;
+
+		for( std::uint32_t triangle = 0; triangle < triangle_count; triangle++ )
+		{
+			const bool is_hard_boundary = hard_boundary_index < cluster_starts.size() && cluster_starts[ hard_boundary_index ] == triangle;
+			const bool is_soft_boundary = triangle > cluster_start && float( cluster_miss_count ) < cluster_acmr_threshold * float( triangle - cluster_start );
+
+			if( is_hard_boundary )
+				hard_boundary_index++;
+
+			if( is_hard_boundary || is_soft_boundary )
+			{
+				all_cluster_starts.push_back( triangle );
+
+				cluster_start      = triangle;
+				cluster_miss_count = 0;
+				timestamp         += cache_size + 1; // Flushes the cache.
+			}
+
+			for( auto corner = 0; corner < 3; corner++ )
+			{
+				const auto vertex = indices[ triangle * 3 + corner ];
+				if( timestamp - cache_timestamps[ vertex ] > cache_size )
+				{
+					cache_timestamps[ vertex ] = timestamp++;
+					cluster_miss_count++;
+				}
+			}
+		}
+
+		return all_cluster_starts;
+	}
+
+	template< typename IndexType >
+	void OptimizeOverdraw( std::span< IndexType > indices, std::span< const Vector3 > positions, std::span< const std::uint32_t > cluster_starts )
+	{
+		const std::size_t triangle_count = indices.size() / 3;
+		const std::size_t cluster_count  = cluster_starts.size();
+
+		if( cluster_count < 2 )
+			return;
+
+		struct ClusterSums
+		{
+			Vector3 weighted_centroid = Vector3::Zero();
+			Vector3 weighted_normal   = Vector3::Zero(); // Sum of the (area weighted) triangle normals.
+			float area                = 0.0f;
+		};
+
+		std::vector< ClusterSums > clusters( cluster_count );
+		ClusterSums mesh;
+
+		for( std::size_t cluster_index = 0; cluster_index < cluster_count; cluster_index++ )
+		{
+			const std::size_t end = cluster_index + 1 < cluster_count ? cluster_starts[ cluster_index + 1 ] : triangle_count;
+
+			auto& cluster = clusters[ cluster_index ];
+
+			for( std::size_t triangle = cluster_starts[ cluster_index ]; triangle < end; triangle++ )
+			{
+				const Vector3& position_0 = positions[ indices[ triangle * 3 + 0 ] ];
+				const Vector3& position_1 = positions[ indices[ triangle * 3 + 1 ] ];
+				const Vector3& position_2 = positions[ indices[ triangle * 3 + 2 ] ];
+
+				const Vector3 normal_times_two_area( Math::Cross( position_1 - position_0, position_2 - position_0 ) );
+				const float   area = normal_times_two_area.Magnitude() / 2.0f;
+
+				cluster.weighted_centroid += ( position_0 + position_1 + position_2 ) * ( area / 3.0f );
+				cluster.weighted_normal   += normal_times_two_area;
+				cluster.area              += area;
+			}
+
+			mesh.weighted_centroid += cluster.weighted_centroid;
+			mesh.area              += cluster.area;
+		}
+
+		if( mesh.area == 0.0f )
+			return;
+
+		const Vector3 mesh_centroid( mesh.weighted_centroid / mesh.area );
+
+		/* How much the cluster faces away from the mesh center; Larger is more likely to be an occluder. */
+		std::vector< float > sort_keys( cluster_count, 0.0f );
+		for( std::size_t cluster_index = 0; cluster_index < cluster_count; cluster_index++ )
+		{
+			const auto& cluster = clusters[ cluster_index ];
+			const float normal_length = cluster.weighted_normal.Magnitude();
+
+			if( cluster.area > 0.0f && normal_length > 0.0f )
+				sort_keys[ cluster_index ] = Math::Dot( cluster.weighted_centroid / cluster.area - mesh_centroid, cluster.weighted_normal / normal_length );
+		}
+
+		std::vector< std::uint32_t > cluster_order( cluster_count );
+		std::iota( cluster_order.begin(), cluster_order.end(), 0 );
+		std::stable_sort( cluster_order.begin(), cluster_order.end(), [ & ]( const std::uint32_t left, const std::uint32_t right ) { return sort_keys[ left ] > sort_keys[ right ]; } );
+
+		std::vector< IndexType > result;
+		result.reserve( indices.size() );
+
+		for( const auto cluster_index : cluster_order )
+		{
+			const std::size_t begin = cluster_starts[ cluster_index ];
+			const std::size_t end   = cluster_index + 1 < cluster_count ? cluster_starts[ cluster_index + 1 ] : triangle_count;
+
+			result.insert( result.end(), indices.begin() + begin * 3, indices.begin() + end * 3 );
+		}
+
+		std::copy( result.cbegin(), result.cend(), indices.begin() );
+	}
+
+	template< typename IndexType >
+	std::vector< std::uint32_t > OptimizeVertexFetch( std::span< IndexType > indices, const std::size_t vertex_count, std::size_t& new_vertex_count )
+	{
+		std::vector< std::uint32_t > remap( vertex_count, UNUSED_VERTEX );
+		new_vertex_count = 0;
+
+		for( auto& index : indices )
+		{
+			auto& new_index = remap[ index ];
+			if( new_index == UNUSED_VERTEX )
+				new_index = std::uint32_t( new_vertex_count++ );
+
+			index = IndexType( new_index );
+		}
+
+		return remap;
+	}
+
+	/* Explicit instantiations: */
+
+	template VertexCacheStatistics AnalyzeVertexCache< std::uint16_t >( std::span< const std::uint16_t >, const std::size_t, const unsigned int );
+	template VertexCacheStatistics AnalyzeVertexCache< std::uint32_t >( std::span< const std::uint32_t >, const std::size_t, const unsigned int );
+
+	template std::vector< std::uint32_t > OptimizeVertexCache< std::uint16_t >( std::span< std::uint16_t >, const std::size_t, const unsigned int, const float );
+	template std::vector< std::uint32_t > OptimizeVertexCache< std::uint32_t >( std::span< std::uint32_t >, const std::size_t, const unsigned int, const float );
+
+	template void OptimizeOverdraw< std::uint16_t >( std::span< std::uint16_t >, std::span< const Vector3 >, std::span< const std::uint32_t > );
+	template void OptimizeOverdraw< std::uint32_t >( std::span< std::uint32_t >, std::span< const Vector3 >, std::span< const std::uint32_t > );
+
+	template std::vector< std::uint32_t > OptimizeVertexFetch< std::uint16_t >( std::span< std::uint16_t >, const std::size_t, std::size_t& );
+	template std::vector< std::uint32_t > OptimizeVertexFetch< std::uint32_t >( std::span< std::uint32_t >, const std::size_t, std::size_t& );
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/* Import-time reordering of triangle lists for faster rendering; None of these need a GL context.
+ * All functions operate on triangle lists & are implemented for 16-bit & 32-bit indices. */
+namespace Engine::MeshOptimization
+{
+	/* Post-transform vertex cache modelled as a FIFO; 16 entries is a conservative estimate for current hardware. */
+	constexpr unsigned int DEFAULT_CACHE_SIZE = 16;
+
+	/* Tipsify's λ: Clusters are closed once their ACMR (simulated from a cold cache) drops below this, i.e., once they are long enough to amortize the cache misses
+	 * that reordering them costs. Lower means fewer, longer clusters: Better vertex cache efficiency but less freedom for OptimizeOverdraw(). */
+	constexpr float DEFAULT_CLUSTER_ACMR_THRESHOLD = 0.75f;
+
+	constexpr std::uint32_t UNUSED_VERTEX = ~std::uint32_t( 0 );
+
+	struct VertexCacheStatistics
+	{
+		float acmr; // Average cache miss ratio: Vertex shader invocations per triangle; In [0.5, 3], lower is better.
+		float atvr; // Average transformed vertex ratio: Vertex shader invocations per vertex; 1 is optimal.
+	};
+
+	template< typename IndexType >
+	VertexCacheStatistics AnalyzeVertexCache( std::span< const IndexType > indices, const std::size_t vertex_count, const unsigned int cache_size = DEFAULT_CACHE_SIZE );
+
+	/* Reorders triangles for vertex cache locality with Tipsify (Sander, Nehab & Barczak, "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw", 2007).
+	 * Returns the index of the first triangle of each cluster, so that the clusters can be reordered (see OptimizeOverdraw()) without hurting cache efficiency much:
+	 * Clusters start wherever the algorithm had to jump to a non-adjacent vertex (hard boundaries) & wherever the current cluster's ACMR drops below
+	 * cluster_acmr_threshold (soft boundaries; the paper's "fast linear clustering"). */
+	template< typename IndexType >
+	std::vector< std::uint32_t > OptimizeVertexCache( std::span< IndexType > indices, const std::size_t vertex_count, const unsigned int cache_size = DEFAULT_CACHE_SIZE,
+													  const float cluster_acmr_threshold = DEFAULT_CLUSTER_ACMR_THRESHOLD );
+
+	/* Sorts the clusters returned by OptimizeVertexCache() so that the ones facing away from the mesh center come first, as they are likely to occlude the rest from any view.
+	 * Expects triangles wound so that cross( p1 - p0, p2 - p0 ) points outwards (true for meshes imported by Model::Loader). */
+	template< typename IndexType >
+	void OptimizeOverdraw( std::span< IndexType > indices, std::span< const Vector3 > positions, std::span< const std::uint32_t > cluster_starts );
+
+	/* Renumbers vertices in the order they are first referenced by the indices (which are rewritten), so that vertex fetches walk memory linearly.
+	 * Returns the mapping from the old vertex indices to the new ones (UNUSED_VERTEX for vertices not referenced at all, which get dropped); Apply it to the vertex
+	 * attributes with RemapVertexAttribute(). */
+	template< typename IndexType >
+	std::vector< std::uint32_t > OptimizeVertexFetch( std::span< IndexType > indices, const std::size_t vertex_count, std::size_t& new_vertex_count );
+
+	template< typename AttributeType >
+	void RemapVertexAttribute( std::vector< AttributeType >& attribute, std::span< const std::uint32_t > remap, const std::size_t new_vertex_count )
+	{
+		std::vector< AttributeType > remapped_attribute( new_vertex_count );
+
+		for( std::size_t vertex_index = 0; vertex_index < attribute.size(); vertex_index++ )
+			if( remap[ vertex_index ] != UNUSED_VERTEX )
+				remapped_attribute[ remap[ vertex_index ] ] = attribute[ vertex_index ];
+
+		attribute = std::move( remapped_attribute );
+	}
+}
@@ -0,0 +1,270 @@
+// Engine Includes.
+#include "MeshUtility.hpp"
+#include "Core/Assertion.h"
+#include "Math/FastMath.hpp"
+#include "Math/Math.hpp"
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <execution>
+#include <numeric>
+
+namespace Engine::MeshUtility
+{
+	/* Per-stream state of WriteInterleaved(), resolved once before the vertex loop. */
+	struct StreamLayout
+	{
+		const std::byte* source;
+		unsigned int element_size;
+		unsigned int offset; // In the destination vertex.
+	};
+
+	/* memcpy() with the size known at compile time for the common attribute sizes, so that these become plain register moves. */
+	void CopyElement( std::byte* destination, const std::byte* source, const unsigned int element_size )
+	{
+		switch( element_size )
+		{
+			case 4:		std::memcpy( destination, source, 4 );				break;
+			case 8:		std::memcpy( destination, source, 8 );				break;
+			case 12:	std::memcpy( destination, source, 12 );				break;
+			case 16:	std::memcpy( destination, source, 16 );				break;
+			default:	std::memcpy( destination, source, element_size );	break;
+		}
+	}
+
+	unsigned int VertexSize( std::span< const VertexStream > streams )
+	{
+		unsigned int vertex_size = 0;
+		for( const auto& stream : streams )
+			if( not stream.Empty() )
+				vertex_size += stream.element_size;
+
+		return vertex_size;
+	}
+
+	void WriteInterleaved( std::span< std::byte > destination, const std::size_t vertex_count, std::span< const VertexStream > streams )
+	{
+		std::array< StreamLayout, MAX_VERTEX_STREAM_COUNT > layouts;
+		std::size_t  stream_count = 0;
+		unsigned int vertex_size  = 0;
+
+		bool all_fit_in_a_register = true;
+
+		for( const auto& stream : streams )
+		{
+			if( stream.Empty() )
+				continue;
+
+			ASSERT_DEBUG_ONLY( stream_count < MAX_VERTEX_STREAM_COUNT && "MeshUtility::WriteInterleaved(): Too many vertex streams!" );
+			ASSERT_DEBUG_ONLY( stream.element_count == vertex_count && "MeshUtility::WriteInterleaved(): Vertex stream size does not match the vertex count!" );
+
+			layouts[ stream_count++ ] = { stream.data, stream.element_size, vertex_size };
+			vertex_size += stream.element_size;
+
+			all_fit_in_a_register = all_fit_in_a_register && stream.element_size <= 16;
+		}
+
+		ASSERT_DEBUG_ONLY( destination.size() == vertex_count * vertex_size && "MeshUtility::WriteInterleaved(): Destination size does not match the vertex count & size!" );
+
+		std::byte* vertex = destination.data();
+		std::size_t vertex_index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		/* Each element is moved with a single 16-byte load & store; Bytes past the element are garbage, which the next element (or vertex) overwrites right after.
+		 * Stores & loads can therefore overrun by up to 12 bytes, which is why the last few vertices are left to the exact copy below. */
+		if( all_fit_in_a_register )
+		{
+			constexpr std::size_t OVERRUN_VERTEX_COUNT = 16 / sizeof( float );
+
+			for( ; vertex_index + OVERRUN_VERTEX_COUNT < vertex_count; vertex_index++, vertex += vertex_size )
+			{
+				for( std::size_t stream_index = 0; stream_index < stream_count; stream_index++ )
+				{
+					const auto& layout = layouts[ stream_index ];
+					_mm_storeu_si128( reinterpret_cast< __m128i* >( vertex + layout.offset ),
+									  _mm_loadu_si128( reinterpret_cast< const __m128i* >( layout.source + vertex_index * layout.element_size ) ) );
+				}
+			}
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; vertex_index < vertex_count; vertex_index++, vertex += vertex_size )
+		{
+			for( std::size_t stream_index = 0; stream_index < stream_count; stream_index++ )
+			{
+				const auto& layout = layouts[ stream_index ];
+				CopyElement( vertex + layout.offset, layout.source + vertex_index * layout.element_size, layout.element_size );
+			}
+		}
+	}
+
+	void WritePlanar( std::span< std::byte > destination, const std::size_t vertex_count, std::span< const VertexStream > streams )
+	{
+		ASSERT_DEBUG_ONLY( destination.size() == vertex_count * VertexSize( streams ) && "MeshUtility::WritePlanar(): Destination size does not match the vertex count & size!" );
+
+		std::byte* stream_start = destination.data();
+
+		for( const auto& stream : streams )
+		{
+			if( stream.Empty() )
+				continue;
+
+			ASSERT_DEBUG_ONLY( stream.element_count == vertex_count && "MeshUtility::WritePlanar(): Vertex stream size does not match the vertex count!" );
+
+			const std::size_t stream_size = vertex_count * stream.element_size;
+			std::memcpy( stream_start, stream.data, stream_size );
+			stream_start += stream_size;
+		}
+	}
+
+	/* Vector::Normalized() treats magnitudes below epsilon as zero, which is too coarse for the un-normalized face tangents of small (e.g., millimeter scale) triangles. */
+	Vector3 NormalizedOrZero( const Vector3& vector )
+	{
+		const float square_magnitude = vector.SquareMagnitude();
+		return square_magnitude > 1.0e-30f ? vector * Math::Fast::InverseSqrt( square_magnitude ) : Vector3::Zero();
+	}
+
+	/* Per-triangle input to the per-vertex tangent accumulation. */
+	struct TriangleTangentFrame
+	{
+		Vector3 tangent; // Only the direction is meaningful.
+		Vector3 normal;  // Length is twice the area.
+		float corner_angles[ 3 ];
+		float handedness; // +1, -1 or 0 for triangles with no uv area.
+	};
+
+	template< typename IndexType >
+	std::vector< Vector4 > GenerateTangents( std::span< const IndexType > indices, std::span< const Vector3 > positions,
+											 std::span< const Vector3 > normals, std::span< const Vector2 > uvs )
+	{
+		ASSERT_DEBUG_ONLY( indices.size() % 3 == 0 && "MeshUtility::GenerateTangents(): Index count is not a multiple of 3!" );
+		ASSERT_DEBUG_ONLY( uvs.size() == positions.size() && "MeshUtility::GenerateTangents(): uv count does not match the vertex count!" );
+		ASSERT_DEBUG_ONLY( ( normals.empty() || normals.size() == positions.size() ) && "MeshUtility::GenerateTangents(): Normal count does not match the vertex count!" );
+
+		const std::size_t vertex_count = positions.size();
+
+		const std::size_t triangle_count = indices.size() / 3;
+
+		/* 0, 1, 2, ...; The parallel loops below iterate over these (rather than the triangles/vertices themselves), as they may pass copies of trivially copyable elements. */
+		std::vector< std::uint32_t > element_indices( std::max( triangle_count, vertex_count ) );
+		std::iota( element_indices.begin(), element_indices.end(), 0 );
+
+		std::vector< TriangleTangentFrame > triangle_frames( triangle_count );
+
+		std::for_each( std::execution::par, element_indices.cbegin(), element_indices.cbegin() + triangle_count, [ & ]( const std::uint32_t triangle )
+		{
+			auto& frame = triangle_frames[ triangle ];
+
+			const std::size_t base_index = triangle * std::size_t( 3 );
+
+			const Vector3& position_0 = positions[ indices[ base_index     ] ];
+			const Vector3& position_1 = positions[ indices[ base_index + 1 ] ];
+			const Vector3& position_2 = positions[ indices[ base_index + 2 ] ];
+
+			const Vector2& uv_0 = uvs[ indices[ base_index     ] ];
+			const Vector2& uv_1 = uvs[ indices[ base_index + 1 ] ];
+			const Vector2& uv_2 = uvs[ indices[ base_index + 2 ] ];
+
+			const Vector3 edge_1( position_1 - position_0 );
+			const Vector3 edge_2( position_2 - position_0 );
+
+			const Vector2 delta_uv_1( uv_1 - uv_0 );
+			const Vector2 delta_uv_2( uv_2 - uv_0 );
+
+			frame.normal = Math::Cross( edge_1, edge_2 );
+
+			/* Approximate angles are plenty for weights. */
+			const Vector3 direction_0_to_1( NormalizedOrZero( edge_1 ) );
+			const Vector3 direction_1_to_2( NormalizedOrZero( position_2 - position_1 ) );
+			const Vector3 direction_2_to_0( NormalizedOrZero( position_0 - position_2 ) );
+
+			frame.corner_angles[ 0 ] = Math::Fast::Acos( Math::Clamp( -Math::Dot( direction_2_to_0, direction_0_to_1 ), -1.0f, +1.0f ) ).Value();
+			frame.corner_angles[ 1 ] = Math::Fast::Acos( Math::Clamp( -Math::Dot( direction_0_to_1, direction_1_to_2 ), -1.0f, +1.0f ) ).Value();
+			frame.corner_angles[ 2 ] = Math::Fast::Acos( Math::Clamp( -Math::Dot( direction_1_to_2, direction_2_to_0 ), -1.0f, +1.0f ) ).Value();
+
+			/* Solving [ edge_1 edge_2 ] = [ tangent bitangent ] * [ delta_uv_1 delta_uv_2 ] would divide by the uv area; Only its sign matters for the direction.
+			 * Triangles with no uv area do not contribute a direction. */
+			if( const float uv_area_times_two = delta_uv_1.X() * delta_uv_2.Y() - delta_uv_2.X() * delta_uv_1.Y();
+				uv_area_times_two != 0.0f )
+			{
+				const float uv_orientation = uv_area_times_two > 0.0f ? +1.0f : -1.0f;
+
+				frame.tangent = ( edge_1 * delta_uv_2.Y() - edge_2 * delta_uv_1.Y() ) * uv_orientation;
+
+				const Vector3 bitangent( ( edge_2 * delta_uv_1.X() - edge_1 * delta_uv_2.X() ) * uv_orientation );
+				frame.handedness = Math::Dot( Math::Cross( frame.tangent, frame.normal ), bitangent ) < 0.0f ? -1.0f : +1.0f;
+			}
+			else
+			{
+				frame.tangent    = Vector3::Zero();
+				frame.handedness = 0.0f;
+			}
+		} );
+
+		/* Corners (triangle * 3 + corner) using each vertex, in compressed row form; Filled in index order, which fixes the summation order below. */
+		std::vector< std::uint32_t > corner_offsets( vertex_count + 1, 0 );
+		for( const auto index : indices )
+			corner_offsets[ index + 1 ]++;
+		std::inclusive_scan( corner_offsets.cbegin(), corner_offsets.cend(), corner_offsets.begin() );
+
+		std::vector< std::uint32_t > vertex_corners( indices.size() );
+		{
+			std::vector< std::uint32_t > write_offsets( corner_offsets.cbegin(), corner_offsets.cend() - 1 );
+			for( std::uint32_t corner = 0; corner < indices.size(); corner++ )
+				vertex_corners[ write_offsets[ indices[ corner ] ]++ ] = corner;
+		}
+
+		std::vector< Vector4 > tangents( vertex_count );
+
+		std::for_each( std::execution::par, element_indices.cbegin(), element_indices.cbegin() + vertex_count, [ & ]( const std::uint32_t vertex )
+		{
+			const auto corners_begin = vertex_corners.cbegin() + corner_offsets[ vertex ];
+			const auto corners_end   = vertex_corners.cbegin() + corner_offsets[ vertex + 1 ];
+
+			Vector3 normal( Vector3::Zero() );
+			if( normals.empty() )
+			{
+				for( auto corner = corners_begin; corner != corners_end; corner++ )
+					normal += triangle_frames[ *corner / 3 ].normal;
+			}
+			else
+				normal = normals[ vertex ];
+
+			normal = NormalizedOrZero( normal );
+
+			Vector3 tangent_sum( Vector3::Zero() );
+			float handedness_sum = 0.0f;
+			for( auto corner = corners_begin; corner != corners_end; corner++ )
+			{
+				const auto& frame = triangle_frames[ *corner / 3 ];
+				const float angle = frame.corner_angles[ *corner % 3 ];
+
+				tangent_sum    += NormalizedOrZero( frame.tangent - normal * Math::Dot( normal, frame.tangent ) ) * angle;
+				handedness_sum += frame.handedness * angle;
+			}
+
+			Vector3 tangent( NormalizedOrZero( tangent_sum - normal * Math::Dot( normal, tangent_sum ) ) );
+
+			/* No usable uvs around this vertex (or not referenced at all): Any direction on the tangent plane will do. */
+			if( tangent == Vector3::Zero() )
+			{
+				tangent = NormalizedOrZero( Math::Cross( normal, std::abs( normal.X() ) < 0.9f ? Vector3::Right() : Vector3::Up() ) );
+				if( tangent == Vector3::Zero() )
+					tangent = Vector3::Right();
+			}
+
+			tangents[ vertex ] = Vector4( tangent.X(), tangent.Y(), tangent.Z(), handedness_sum < 0.0f ? -1.0f : +1.0f );
+		} );
+
+		return tangents;
+	}
+
+	/* Explicit instantiations: */
+
+	template std::vector< Vector4 > GenerateTangents< std::uint16_t >( std::span< const std::uint16_t >, std::span< const Vector3 >, std::span< const Vector3 >, std::span< const Vector2 > );
+	template std::vector< Vector4 > GenerateTangents< std::uint32_t >( std::span< const std::uint32_t >, std::span< const Vector3 >, std::span< const Vector3 >, std::span< const Vector2 > );
+}
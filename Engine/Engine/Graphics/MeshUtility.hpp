@@ -4,6 +4,8 @@
 #include "Math/Vector.hpp"
 
 // std Includes.
+#include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -59,52 +61,47 @@ namespace Engine
 				return 1;
 		}
 
-		template< typename FirstVertexAttributeType, typename ... OtherVertexAttributeTypes >
-		auto Interleave( unsigned int& vertex_count,
-						 FirstVertexAttributeType&& vertex_attribute_vector_first,
-						 OtherVertexAttributeTypes&& ... vertex_attribute_vector_pack )
+		/* A vertex attribute array to be written into a vertex buffer; Empty streams are skipped. */
+		struct VertexStream
 		{
-			auto ComponentCount_OnlyForNonEmpty = []( auto&& vector_of_attributes )
+			template< typename AttributeType >
+			VertexStream( const std::vector< AttributeType >& attribute )
+				:
+				data( reinterpret_cast< const std::byte* >( attribute.data() ) ),
+				element_count( attribute.size() ),
+				element_size( ( unsigned int )sizeof( AttributeType ) )
 			{
-				if( vector_of_attributes.empty() )
-					return 0u;
+				static_assert( sizeof( AttributeType ) % sizeof( float ) == 0, "Vertex attributes need to be a multiple of 4 bytes in size." );
+			}
 
-				return ComponentCount< std::remove_reference_t< decltype( vector_of_attributes ) >::value_type >();
-			};
+			inline bool Empty() const { return element_count == 0; }
 
-			constexpr auto first_attribute_component_count = ComponentCount< std::remove_reference_t< decltype( vertex_attribute_vector_first ) >::value_type >();
-			const	  auto total_attribute_count           = first_attribute_component_count +
-														     ( ComponentCount_OnlyForNonEmpty( vertex_attribute_vector_pack ) + ... );
-			vertex_count = ( unsigned int )vertex_attribute_vector_first.size();
+			const std::byte* data;
+			std::size_t element_count;
+			unsigned int element_size;
+		};
 
-			std::vector< float > interleaved_vertex_attribute_vector( total_attribute_count * vertex_count );
+		/* Up to the minimum number of vertex attributes every GL implementation supports. */
+		constexpr std::size_t MAX_VERTEX_STREAM_COUNT = 16;
 
-			constexpr auto size_of_first_vertex_attribute = sizeof( std::remove_reference_t< decltype( vertex_attribute_vector_first ) >::value_type );
+		/* Size of a single vertex in bytes, i.e., the sum of the element sizes of the non-empty streams. */
+		unsigned int VertexSize( std::span< const VertexStream > streams );
 
-			for( unsigned int vertex_index = 0, element_index = 0; vertex_index < vertex_count; vertex_index++ )
-			{
-				/* Copy the first attribute's elements. */
-				std::memcpy( interleaved_vertex_attribute_vector.data() + element_index, 
-							 vertex_attribute_vector_first.data() + vertex_index,
-							 size_of_first_vertex_attribute );
-				element_index += first_attribute_component_count;
-
-				/* Below fold expression of the lambda over the comma operator covers the copying of the rest; i.e., elements in the parameter pack. */
-				( [&]
-				{
-					if( !vertex_attribute_vector_pack.empty() )
-					{
-						const auto size_of_vertex_attribute = sizeof( std::remove_reference_t< decltype( vertex_attribute_vector_pack ) >::value_type );
-						const auto component_count_of_vertex_attribute = ComponentCount_OnlyForNonEmpty( vertex_attribute_vector_pack );
-						std::memcpy( interleaved_vertex_attribute_vector.data() + element_index,
-									 vertex_attribute_vector_pack.data() + vertex_index,
-									 size_of_vertex_attribute );
-						element_index += component_count_of_vertex_attribute;
-					}
-				}() , ... ); // Fold expression: Lambda over the comma operator.
-			}
+		/* Writes the vertices as [ stream 0, stream 1, ... ][ stream 0, stream 1, ... ]...; destination has to be exactly vertex_count * VertexSize( streams ) bytes.
+		 * The layout is computed once up front & nothing is allocated, so destination can be a mapped buffer. */
+		void WriteInterleaved( std::span< std::byte > destination, const std::size_t vertex_count, std::span< const VertexStream > streams );
 
-			return interleaved_vertex_attribute_vector;
-		}
+		/* Writes the streams back to back ([ stream 0 of all vertices ][ stream 1 of all vertices ]...), for use with VertexLayout::Arrangement::Planar.
+		 * Same requirements as WriteInterleaved(). */
+		void WritePlanar( std::span< std::byte > destination, const std::size_t vertex_count, std::span< const VertexStream > streams );
+
+		/* Per-vertex tangents for triangle lists, MikkTSpace-style: Each triangle's tangent is projected onto the tangent plane of the vertex normal & accumulated with
+		 * the corner angle as weight, then orthonormalized against the normal. w holds the handedness: +1 when the bitangent (the +v direction) is cross( tangent, normal ),
+		 * as the shaders reconstruct it, & -1 for mirrored uvs; This matches glTF's w after the loader's z flip.
+		 * Normals are optional (area weighted face normals are used in their place); uvs are required.
+		 * Triangles & vertices are processed in parallel, but every vertex sums its triangles in index order, so the results do not depend on the thread count. */
+		template< typename IndexType >
+		std::vector< Vector4 > GenerateTangents( std::span< const IndexType > indices, std::span< const Vector3 > positions,
+												 std::span< const Vector3 > normals, std::span< const Vector2 > uvs );
 	}
 }
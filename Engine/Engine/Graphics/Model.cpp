@@ -32,12 +32,14 @@ namespace Engine
 
 	Model::Model()
 		:
-		name( "<unnamed>" )
+		name( "<unnamed>" ),
+		mesh_istance_count( 0 )
 	{}
 
 	Model::Model( const std::string& name )
 		:
-		name( name )
+		name( name ),
+		mesh_istance_count( 0 )
 	{
 	}
 
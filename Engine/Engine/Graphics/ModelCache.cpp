@@ -0,0 +1,214 @@
+// Engine Includes.
+#include "ModelCache.h"
+
+// std Includes.
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace Engine::ModelCache
+{
+	struct FileHeader
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint64_t content_hash;
+		std::uint64_t metadata_size;
+		std::uint64_t metadata_hash;	// Catches truncated/corrupt files.
+		std::uint64_t blob_offset;		// From the start of the file; Multiple of Serialization::BLOB_ALIGNMENT.
+		std::uint64_t blob_size;
+	};
+
+	constexpr std::uint32_t FILE_MAGIC   = 'K' | ( 'M' << 8 ) | ( 'D' << 16 ) | ( 'C' << 24 );
+	constexpr std::uint32_t FILE_VERSION = 1;
+
+	static unsigned int hit_count  = 0;
+	static unsigned int miss_count = 0;
+
+	/* Returns the paths of the files referred to by the "uri" members of a .gltf file's JSON (buffers & images); Embedded (data:) URIs are skipped,
+	 * as they are part of the JSON itself. A plain scan is enough, as "uri" can not appear as a key anywhere else in a valid glTF. */
+	static std::vector< std::filesystem::path > ReferencedFilePaths( const std::filesystem::path& gltf_path, const std::string_view json )
+	{
+		constexpr std::string_view URI_KEY( "\"uri\"" );
+
+		std::vector< std::filesystem::path > file_paths;
+
+		for( auto position = json.find( URI_KEY ); position != std::string_view::npos; position = json.find( URI_KEY, position ) )
+		{
+			position = json.find_first_not_of( " \t\r\n", position + URI_KEY.size() );
+			if( position == std::string_view::npos || json[ position ] != ':' )
+				continue;
+
+			position = json.find_first_not_of( " \t\r\n", position + 1 );
+			if( position == std::string_view::npos || json[ position ] != '"' )
+				continue;
+
+			const auto uri_end = json.find( '"', ++position );
+			if( uri_end == std::string_view::npos )
+				break;
+
+			const auto uri = json.substr( position, uri_end - position );
+			position = uri_end + 1;
+
+			if( uri.starts_with( "data:" ) )
+				continue;
+
+			/* Undo the JSON ("\/") & URI ("%20" etc.) escaping. */
+			std::string decoded_uri;
+			for( std::size_t index = 0; index < uri.size(); index++ )
+			{
+				if( uri[ index ] == '\\' && index + 1 < uri.size() )
+					decoded_uri += uri[ ++index ];
+				else if( uri[ index ] == '%' && index + 2 < uri.size() && std::isxdigit( ( unsigned char )uri[ index + 1 ] ) && std::isxdigit( ( unsigned char )uri[ index + 2 ] ) )
+				{
+					decoded_uri += ( char )std::stoi( std::string( uri.substr( index + 1, 2 ) ), nullptr, 16 );
+					index += 2;
+				}
+				else
+					decoded_uri += uri[ index ];
+			}
+
+			file_paths.push_back( gltf_path.parent_path() / decoded_uri );
+		}
+
+		return file_paths;
+	}
+
+	static std::uint64_t HashFileStamps( const std::vector< std::filesystem::path >& file_paths )
+	{
+		Serialization::Hasher hasher;
+		for( const auto& file_path : file_paths )
+		{
+			const auto path = file_path.generic_string();
+
+			/* A missing file hashes differently from a present one (its size is -1), so that adding it later invalidates the entry. */
+			std::error_code error_code;
+			const auto size            = std::filesystem::file_size( file_path, error_code );
+			const auto last_write_time = std::filesystem::last_write_time( file_path, error_code ).time_since_epoch().count();
+
+			hasher.Add( path ).Add( size ).Add( ( std::int64_t )last_write_time );
+		}
+
+		return hasher.Get();
+	}
+
+	std::optional< Entry > MakeEntry( const std::filesystem::path& source_path, const std::uint64_t import_settings_hash )
+	{
+		std::error_code error_code;
+		const auto absolute_source_path = std::filesystem::absolute( source_path, error_code ).lexically_normal();
+
+		const Platform::MappedFile source_file( absolute_source_path );
+		if( error_code || not source_file.IsOpen() )
+			return std::nullopt;
+
+		Serialization::Hasher content_hasher;
+		content_hasher.Add( source_file.Data() ).Add( import_settings_hash ).Add( FILE_VERSION );
+
+		auto extension = absolute_source_path.extension().string();
+		std::transform( extension.begin(), extension.end(), extension.begin(), []( const unsigned char character ) { return ( char )std::tolower( character ); } );
+
+		if( extension == ".gltf" )
+			content_hasher.Add( HashFileStamps( ReferencedFilePaths( absolute_source_path,
+																	 std::string_view( reinterpret_cast< const char* >( source_file.Data().data() ), source_file.Data().size() ) ) ) );
+
+		const auto identity = absolute_source_path.generic_string();
+
+		std::ostringstream file_name;
+		file_name << std::hex << std::setw( 16 ) << std::setfill( '0' ) << Serialization::Hasher().Add( identity ).Get() << ".model";
+
+		return Entry
+		{
+			.path         = std::filesystem::path( DIRECTORY ) / file_name.str(),
+			.content_hash = content_hasher.Get()
+		};
+	}
+
+	std::optional< Reader > Load( const Entry& entry )
+	{
+		Platform::MappedFile file( entry.path );
+
+		FileHeader header;
+		if( not file.IsOpen() || file.Size() < sizeof( FileHeader ) )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		std::memcpy( &header, file.Data().data(), sizeof( FileHeader ) );
+
+		if( header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.content_hash != entry.content_hash ||
+			header.blob_offset % Serialization::BLOB_ALIGNMENT != 0 || header.blob_offset < sizeof( FileHeader ) || header.metadata_size > header.blob_offset - sizeof( FileHeader ) ||
+			header.blob_offset > file.Size() || file.Size() - header.blob_offset != header.blob_size )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		const auto metadata = file.Data().subspan( sizeof( FileHeader ), header.metadata_size );
+		const auto blobs    = file.Data().subspan( header.blob_offset, header.blob_size );
+
+		if( Serialization::Hasher().Add( metadata ).Get() != header.metadata_hash )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		hit_count++;
+		return std::optional< Reader >( std::in_place, std::move( file ), metadata, blobs );
+	}
+
+	/* Writes to a temporary file first, so that an interrupted write can not leave a truncated entry behind. */
+	void Store( const Entry& entry, const Serialization::Writer& writer )
+	{
+		const auto& metadata = writer.Metadata();
+		const auto& blobs    = writer.Blobs();
+
+		const FileHeader header
+		{
+			.magic         = FILE_MAGIC,
+			.version       = FILE_VERSION,
+			.content_hash  = entry.content_hash,
+			.metadata_size = metadata.size(),
+			.metadata_hash = Serialization::Hasher().Add( metadata ).Get(),
+			.blob_offset   = Serialization::AlignToBlob( sizeof( FileHeader ) + metadata.size() ),
+			.blob_size     = blobs.size()
+		};
+
+		std::error_code error_code;
+		std::filesystem::create_directories( entry.path.parent_path(), error_code );
+
+		auto temporary_path( entry.path );
+		temporary_path += ".tmp";
+
+		{
+			std::ofstream file( temporary_path, std::ios::binary | std::ios::trunc );
+			if( not file )
+				return;
+
+			const std::vector< char > padding( header.blob_offset - sizeof( FileHeader ) - metadata.size(), 0 );
+
+			file.write( reinterpret_cast< const char* >( &header ), sizeof( FileHeader ) );
+			file.write( reinterpret_cast< const char* >( metadata.data() ), metadata.size() );
+			file.write( padding.data(), padding.size() );
+			file.write( reinterpret_cast< const char* >( blobs.data() ), blobs.size() );
+
+			if( not file )
+				return;
+		}
+
+		std::filesystem::rename( temporary_path, entry.path, error_code );
+	}
+
+	unsigned int HitCount()
+	{
+		return hit_count;
+	}
+
+	unsigned int MissCount()
+	{
+		return miss_count;
+	}
+}
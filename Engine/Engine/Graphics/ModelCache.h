@@ -0,0 +1,54 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Platform.h"
+#include "Core/Serialization.h"
+
+// std Includes.
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace Engine::ModelCache
+{
+	/* Imported models are stored under DIRECTORY (relative to the working directory), one file per source file, in the form they are uploaded to the GPU in.
+	 * The file name is derived from the source path, so re-importing a modified model overwrites its own entry.
+	 * The hash stored inside covers the source file's contents, the import settings & the file format version (see MakeEntry()).
+	 * An entry is a small metadata section (layout & descriptors, as written by the owner; see Model::Loader) followed by blobs (vertex/index data etc.),
+	 * each aligned to Serialization::BLOB_ALIGNMENT inside the file. Entries are read through a memory mapping & blobs are handed out as spans into it, without any copies. */
+
+	constexpr const char* DIRECTORY = "ModelCache";
+
+	struct Entry
+	{
+		std::filesystem::path path;
+		std::uint64_t content_hash;
+	};
+
+	/* Hashes the source file's contents; Returns nullopt if the file can not be read.
+	 * .gltf files reference external files (buffers & images), so the sizes & last write times of the files named by their "uri"s are hashed too. */
+	std::optional< Entry > MakeEntry( const std::filesystem::path& source_path, const std::uint64_t import_settings_hash );
+
+	/* Keeps the entry's memory mapping alive; Spans returned by ReadBlob() point into the mapped file, so they are valid as long as the Reader is. */
+	class Reader : public Serialization::Reader
+	{
+	public:
+		Reader( Platform::MappedFile&& file, const std::span< const std::byte > metadata, const std::span< const std::byte > blobs )
+			:
+			Serialization::Reader( metadata, blobs ),
+			file( std::move( file ) )
+		{}
+
+	private:
+		Platform::MappedFile file;
+	};
+
+	/* Returns nullopt if there is no entry, the entry is stale or it fails its checksum (metadata only; Blobs are not hashed, as that would mean touching every byte). */
+	std::optional< Reader > Load( const Entry& entry );
+	void Store( const Entry& entry, const Serialization::Writer& writer );
+
+	unsigned int HitCount();
+	unsigned int MissCount();
+}
@@ -1,5 +1,7 @@
 // Engine Includes.
 #include "Model.h"
+#include "MeshOptimization.h"
+#include "ModelCache.h"
 #include "Core/AssetDatabase.hpp"
 #include "Math/Matrix.h"
 #include "Math/Quaternion.hpp"
@@ -12,7 +14,14 @@
 #pragma warning(default:5223)
 
 // std Includes.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <execution>
+#include <limits>
+#include <memory>
 #include <numeric>
+#include <thread>
 
 template <>
 struct fastgltf::ElementTraits< Engine::Vector2  > : fastgltf::ElementTraitsBase< Engine::Vector2,  AccessorType::Vec2, float> {};
@@ -41,8 +50,135 @@ struct fastgltf::ElementTraits< Engine::Vector4I > : fastgltf::ElementTraitsBase
 
 namespace Engine
 {
+    /* Feeds fastgltf from a memory mapping of the file & lets the asset refer to binary data where it already is, instead of copying it into buffers:
+     * - The GLB binary chunk: fastgltf read()s it into memory obtained from the buffer allocation callback (MapBuffer()). That read is skipped & only the chunk's
+     *   position in the file is recorded; The allocation is never touched, so it never becomes resident.
+     * - External buffers: Mapped as well (instead of being read into vectors via Options::LoadExternalBuffers).
+     * - Base64 (data URI) buffers & images: Have to be decoded, so they stay in the memory fastgltf decodes them into.
+     * ResolveDataSources() turns all of these into sources::ByteView, which the accessor tools read from directly.
+     * Has to outlive the asset. */
+    class MappedGltfData : public fastgltf::GltfDataGetter
+    {
+    public:
+        MappedGltfData( const std::filesystem::path& file_path )
+            :
+            file( file_path ),
+            offset( 0 )
+        {}
+
+        inline bool IsOpen() const { return file.IsOpen(); }
+
+        void AttachTo( fastgltf::Parser& parser )
+        {
+            parser.setUserPointer( this );
+            parser.setBufferAllocationCallback( &MapBuffer );
+        }
+
+        /* To be called after parsing. Image URIs are left as they are (see CreateTextures()). Returns false if an external buffer can not be mapped. */
+        bool ResolveDataSources( fastgltf::Asset& gltf_asset, const std::filesystem::path& directory )
+        {
+            for( auto& buffer : gltf_asset.buffers )
+            {
+                if( const auto* custom_buffer = std::get_if< fastgltf::sources::CustomBuffer >( &buffer.data ) )
+                    buffer.data = fastgltf::sources::ByteView{ BytesOf( *custom_buffer ), custom_buffer->mimeType };
+                else if( const auto* uri = std::get_if< fastgltf::sources::URI >( &buffer.data ) )
+                {
+                    /* Data URIs are decoded by fastgltf, so this can only be a remote resource. */
+                    if( not uri->uri.isLocalPath() )
+                        return false;
+
+                    const auto& external_file = external_files.emplace_back( directory / uri->uri.fspath() );
+                    if( not external_file.IsOpen() ||
+                        external_file.Size() < uri->fileByteOffset || external_file.Size() - uri->fileByteOffset < buffer.byteLength )
+                        return false;
+
+                    buffer.data = fastgltf::sources::ByteView{ external_file.Data().subspan( uri->fileByteOffset, buffer.byteLength ), uri->mimeType };
+                }
+            }
+
+            for( auto& image : gltf_asset.images )
+                if( const auto* custom_buffer = std::get_if< fastgltf::sources::CustomBuffer >( &image.data ) )
+                    image.data = fastgltf::sources::ByteView{ BytesOf( *custom_buffer ), custom_buffer->mimeType };
+
+            /* Nothing refers to the skipped allocations anymore. */
+            for( auto& allocation : allocations )
+                if( allocation.file_offset )
+                    allocation.memory.reset();
+
+            return true;
+        }
+
+        void read( void* destination, const std::size_t count ) override
+        {
+            if( not allocations.empty() && destination == allocations.back().memory.get() && count == allocations.back().size && not allocations.back().file_offset )
+                allocations.back().file_offset = offset;
+            else
+                std::memcpy( destination, file.Data().data() + offset, count );
+
+            offset += count;
+        }
+
+        /* simdjson reads (but never writes) up to padding bytes past the end of the JSON; The mapping can be handed out as is, unless that would run past the end
+         * of the file, which is always the case for .gltf files (the JSON is the whole file). */
+        fastgltf::span< std::byte > read( const std::size_t count, const std::size_t padding ) override
+        {
+            std::byte* start;
+            if( file.Size() - offset >= count + padding )
+                start = const_cast< std::byte* >( file.Data().data() + offset );
+            else
+            {
+                padded_copy.resize( count + padding );
+                std::memcpy( padded_copy.data(), file.Data().data() + offset, count );
+                start = padded_copy.data();
+            }
+
+            offset += count;
+            return fastgltf::span< std::byte >( start, count );
+        }
+
+        void reset() override { offset = 0; }
+
+        std::size_t bytesRead() override { return offset; }
+        std::size_t totalSize() override { return file.Size(); }
+
+    private:
+        struct Allocation
+        {
+            std::unique_ptr< std::byte[] > memory;
+            std::size_t size;
+            std::optional< std::size_t > file_offset; // Set if the allocation was skipped, as its contents are in the file.
+        };
+
+        static fastgltf::BufferInfo MapBuffer( const std::uint64_t size, void* user_pointer )
+        {
+            auto& self = *static_cast< MappedGltfData* >( user_pointer );
+
+            /* Not value-initialized, so that the pages are not touched. */
+            self.allocations.push_back( { std::make_unique_for_overwrite< std::byte[] >( size ), size, std::nullopt } );
+
+            return { .mappedMemory = self.allocations.back().memory.get(), .customId = self.allocations.size() - 1 };
+        }
+
+        std::span< const std::byte > BytesOf( const fastgltf::sources::CustomBuffer& custom_buffer ) const
+        {
+            const auto& allocation = allocations[ custom_buffer.id ];
+            return allocation.file_offset
+                ? file.Data().subspan( *allocation.file_offset, allocation.size )
+                : std::span< const std::byte >( allocation.memory.get(), allocation.size );
+        }
+
+    private:
+        Platform::MappedFile file;
+        std::size_t offset;
+
+        std::vector< std::byte > padded_copy;
+        std::vector< Allocation > allocations; // Indexed by CustomBufferId.
+        std::vector< Platform::MappedFile > external_files;
+    };
+
 	bool LoadMesh( const fastgltf::Asset& gltf_asset, const fastgltf::Mesh& gltf_mesh,
-                   Model::MeshGroup& mesh_group_to_load, std::vector< Mesh >& meshes, const std::vector< Texture* >& textures )
+                   Model::MeshGroup& mesh_group_to_load, std::vector< Mesh >& meshes, const std::vector< Texture* >& textures,
+                   const Model::ImportSettings& import_settings )
     {
 		/* Naming variables sub-mesh instead of gltf's "primitive" for better readibility. */
 
@@ -194,10 +330,10 @@ namespace Engine
                 return false;
             const std::uint32_t index_count = static_cast< std::uint32_t >( index_accessor.count );
 
-            std::vector< std::uint32_t > indices_u32;
-
-            // Ignore 16 bit indices (or any other format other than 32 bit for that matter).
-            indices_u32.resize( index_count );
+            /* Loaded directly in the width the Mesh will store them in. */
+            Mesh::IndexData indices = Mesh::CanUse16BitIndices( positions.size() )
+                ? Mesh::IndexData( std::vector< std::uint16_t >( index_count ) )
+                : Mesh::IndexData( std::vector< std::uint32_t >( index_count ) );
 
             auto EffectiveIndex = []( const std::size_t index )
             {
@@ -209,47 +345,61 @@ namespace Engine
                 return needs_swap * swapped_index + ( 1 - needs_swap ) * index;
             };
 
-            fastgltf::iterateAccessorWithIndex< std::uint32_t >( gltf_asset, index_accessor,
-                                                                 [ & ]( std::uint32_t actual_index, std::size_t array_index )
-                                                                 {
-                                                                     indices_u32[ EffectiveIndex( array_index ) ] = actual_index;
-                                                                 } );
-            
-            /* Calculate tangents if the model did not have them. */
-            if( tangents.empty() )
+            std::visit( [ & ]< typename IndexType >( std::vector< IndexType >& index_vector )
+            {
+                fastgltf::iterateAccessorWithIndex< std::uint32_t >( gltf_asset, index_accessor,
+                                                                     [ & ]( std::uint32_t actual_index, std::size_t array_index )
+                                                                     {
+                                                                         index_vector[ EffectiveIndex( array_index ) ] = IndexType( actual_index );
+                                                                     } );
+            }, indices );
+
+            if( import_settings.optimize_indices )
             {
-                const auto index_count = indices_u32.size();
-                const auto size = uvs_0.size();
-                tangents.reserve( size );
-                for( auto base_index = 0; base_index < index_count; base_index += 3 )
+                std::visit( [ & ]< typename IndexType >( std::vector< IndexType >& index_vector )
                 {
-                    const auto index_0 = indices_u32[ base_index     ];
-                    const auto index_1 = indices_u32[ base_index + 1 ];
-                    const auto index_2 = indices_u32[ base_index + 2 ];
+                    MeshOptimization::VertexCacheStatistics statistics_before;
+                    if( import_settings.log_optimization_statistics )
+                        statistics_before = MeshOptimization::AnalyzeVertexCache( std::span< const IndexType >( index_vector ), positions.size() );
 
-                    const auto position_0 = positions[ index_0 ];
-                    const auto position_1 = positions[ index_1 ];
-                    const auto position_2 = positions[ index_2 ];
+                    const auto cluster_starts = MeshOptimization::OptimizeVertexCache( std::span( index_vector ), positions.size() );
+                    MeshOptimization::OptimizeOverdraw( std::span( index_vector ), std::span< const Vector3 >( positions ), cluster_starts );
 
-                    const auto uv_0 = uvs_0[ index_0 ];
-                    const auto uv_1 = uvs_0[ index_1 ];
-                    const auto uv_2 = uvs_0[ index_2 ];
+                    std::size_t new_vertex_count;
+                    const auto remap = MeshOptimization::OptimizeVertexFetch( std::span( index_vector ), positions.size(), new_vertex_count );
 
-                    const auto edge_1 = position_1 - position_0;
-                    const auto edge_2 = position_2 - position_0;
+                    MeshOptimization::RemapVertexAttribute( positions, remap, new_vertex_count );
+                    if( not normals.empty() )
+                        MeshOptimization::RemapVertexAttribute( normals, remap, new_vertex_count );
+                    if( not uvs_0.empty() )
+                        MeshOptimization::RemapVertexAttribute( uvs_0, remap, new_vertex_count );
+                    if( not tangents.empty() )
+                        MeshOptimization::RemapVertexAttribute( tangents, remap, new_vertex_count );
 
-                    const auto delta_uv_1 = uv_1 - uv_0;
-                    const auto delta_uv_2 = uv_2 - uv_0;
-
-                    const auto delta_v_1 = delta_uv_1.Y();
-                    const auto delta_v_2 = delta_uv_2.Y();
+                    if( import_settings.log_optimization_statistics )
+                    {
+                        const auto statistics_after = MeshOptimization::AnalyzeVertexCache( std::span< const IndexType >( index_vector ), positions.size() );
+
+                        char report[ 256 ];
+                        std::snprintf( report, sizeof( report ), "Optimized indices of \"%s\" (primitive %d): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f.",
+                                       gltf_mesh.name.c_str(), int( std::distance( gltf_mesh.primitives.begin(), submesh_iterator ) ),
+                                       statistics_before.acmr, statistics_after.acmr, statistics_before.atvr, statistics_after.atvr );
+                        ServiceLocator< GLLogger >::Get().Info( report );
+                    }
+                }, indices );
+            }
 
-                    const auto f = 1.0f / ( delta_uv_1.X() * delta_v_2 - delta_uv_2.X() * delta_v_1 );
+            /* Calculate tangents if the model did not have them; The handedness is dropped, the same as for the tangents read from the model above. */
+            if( tangents.empty() && not uvs_0.empty() )
+            {
+                const auto generated_tangents = std::visit( [ & ]< typename IndexType >( const std::vector< IndexType >& index_vector )
+                {
+                    return MeshUtility::GenerateTangents( std::span< const IndexType >( index_vector ), positions, normals, uvs_0 );
+                }, indices );
 
-                    tangents.emplace_back( f * ( delta_v_2 * edge_1.X() - delta_v_1 * edge_2.X() ),
-                                           f * ( delta_v_2 * edge_1.Y() - delta_v_1 * edge_2.Y() ),
-                                           f * ( delta_v_2 * edge_1.Z() - delta_v_1 * edge_2.Z() ) );
-                }
+                tangents.reserve( generated_tangents.size() );
+                for( const auto& tangent : generated_tangents )
+                    tangents.push_back( tangent.XYZ() );
             }
 
             std::string sub_mesh_name( mesh_group_to_load.name + "_" + std::to_string( std::distance( gltf_mesh.primitives.begin(), submesh_iterator ) ) );
@@ -260,8 +410,11 @@ namespace Engine
 																				   sub_mesh_name,
 																				   std::move( normals ),
                                                                                    std::move( uvs_0 ),
-                                                                                   std::move( indices_u32 ),
-                                                                                   std::move( tangents ) ) ),
+                                                                                   std::move( indices ),
+                                                                                   std::move( tangents ),
+                                                                                   Mesh::PrimitiveType::Triangles,
+                                                                                   import_settings.usage,
+                                                                                   import_settings.compressed_attributes ) ),
 														sub_mesh_albedo_texture,
                                                         sub_mesh_normal_texture,
                                                         std::move( sub_mesh_albedo_color ) );
@@ -270,9 +423,91 @@ namespace Engine
         return true;
     }
 
-    bool LoadTexture( const fastgltf::Asset& gltf_asset, const fastgltf::Image& gltf_image,
-                      Texture*& texture_to_load, const Engine::Texture::ImportSettings& import_settings )
+    /* What a texture is created from; Also recorded for the ModelCache, so that a cached load can create the same textures without the glTF asset. */
+    struct TextureSource
     {
+        std::string name;
+        Texture::ImportSettings import_settings;
+        std::string file_path;                  // Either a file,
+        std::span< const std::byte > image;     // or the (still encoded) image itself; Points into the glTF asset's buffers (i.e., the mappings of MappedGltfData).
+    };
+
+    /* Decodes the images on worker threads & creates the textures on this (the GL) thread.
+     * Images are decoded (& uploaded) in batches of one per hardware thread, so that at most that many decoded images are held at once.
+     * The textures are named the same way as with AssetDatabase< Texture >::CreateAssetFromMemory() (& images of textures that already exist are not decoded). */
+    bool CreateTextures( const std::vector< TextureSource >& texture_sources, std::vector< Texture* >& textures )
+    {
+        const auto texture_count = texture_sources.size();
+
+        const auto first_texture = textures.size();
+        textures.resize( first_texture + texture_count, nullptr );
+
+        std::vector< std::size_t > indices_to_decode;
+        indices_to_decode.reserve( texture_count );
+        for( std::size_t index = 0; index < texture_count; index++ )
+        {
+            const auto& texture_source = texture_sources[ index ];
+
+            if( auto* existing_texture = AssetDatabase< Texture >::Find( texture_source.name );
+                not texture_source.name.empty() && existing_texture )
+                textures[ first_texture + index ] = existing_texture;
+            else
+                indices_to_decode.push_back( index );
+        }
+
+        const std::size_t batch_size = std::max( std::thread::hardware_concurrency(), 1u );
+
+        std::vector< std::optional< Texture::DecodedImage > > decoded_images( batch_size );
+
+        /* Positions in the batch; The parallel loop runs over these rather than the indices themselves, as it may pass copies of (trivially copyable) elements. */
+        std::vector< std::size_t > batch_positions( batch_size );
+        std::iota( batch_positions.begin(), batch_positions.end(), 0 );
+
+        for( std::size_t batch_start = 0; batch_start < indices_to_decode.size(); batch_start += batch_size )
+        {
+            const auto batch = std::span( indices_to_decode ).subspan( batch_start, std::min( batch_size, indices_to_decode.size() - batch_start ) );
+
+            std::for_each( std::execution::par, batch_positions.cbegin(), batch_positions.cbegin() + batch.size(), [ & ]( const std::size_t batch_index )
+            {
+                const auto& texture_source = texture_sources[ batch[ batch_index ] ];
+                auto& decoded_image        = decoded_images[ batch_index ];
+
+                if( texture_source.file_path.empty() )
+                    decoded_image = Texture::DecodeImage( texture_source.image.data(), static_cast< int >( texture_source.image.size() ),
+                                                          texture_source.import_settings.flip_vertically );
+                else if( const Platform::MappedFile image_file( texture_source.file_path );
+                         image_file.IsOpen() )
+                    decoded_image = Texture::DecodeImage( image_file.Data().data(), static_cast< int >( image_file.Size() ),
+                                                          texture_source.import_settings.flip_vertically );
+            } );
+
+            for( std::size_t batch_index = 0; batch_index < batch.size(); batch_index++ )
+            {
+                const auto& texture_source = texture_sources[ batch[ batch_index ] ];
+                auto& decoded_image        = decoded_images[ batch_index ];
+
+                if( not decoded_image )
+                {
+                    std::cerr << R"(ERROR::MODELLOADER::Texture ")" << texture_source.name << R"(": Could not decode image)"
+                              << ( texture_source.file_path.empty() ? "." : " from file \"" + texture_source.file_path + "\"." ) << '\n';
+                    return false;
+                }
+
+                textures[ first_texture + batch[ batch_index ] ] = AssetDatabase< Texture >::CreateAsset( texture_source.name, *decoded_image, texture_source.import_settings );
+
+                decoded_image.reset(); // Uploaded; The pixels are not needed anymore.
+            }
+        }
+
+        return true;
+    }
+
+    bool LoadTextureSource( const fastgltf::Asset& gltf_asset, const fastgltf::Image& gltf_image, const std::filesystem::path& directory,
+                            const Engine::Texture::ImportSettings& import_settings, TextureSource& texture_source )
+    {
+        texture_source.name            = gltf_image.name;
+        texture_source.import_settings = import_settings;
+
         std::visit( fastgltf::visitor
                     {
                         []( const auto& arg ) {},
@@ -281,39 +516,35 @@ namespace Engine
                             ASSERT_DEBUG_ONLY( file_path.fileByteOffset == 0 ); // Offsets with stbi are not supported.
                             ASSERT_DEBUG_ONLY( file_path.uri.isLocalPath() );   // Only capable of loading local files.
 
-                            const std::string path( file_path.uri.path().begin(), file_path.uri.path().end() );
-
-                            texture_to_load = AssetDatabase< Texture >::CreateAssetFromFile( std::string( gltf_image.name ), path, import_settings );
+                            /* Relative to the glTF file. */
+                            texture_source.file_path = ( directory / file_path.uri.fspath() ).string();
                         },
                         [ & ]( const fastgltf::sources::Array& vector )
                         {
-                            texture_to_load = AssetDatabase< Texture >::CreateAssetFromMemory( std::string( gltf_image.name ), vector.bytes.data(), static_cast< int >( vector.bytes.size() ),
-																					           false, import_settings );
+                            texture_source.image = std::span( vector.bytes.data(), vector.bytes.size() );
+                        },
+                        [ & ]( const fastgltf::sources::ByteView& view )
+                        {
+                            texture_source.image = std::span( view.bytes.data(), view.bytes.size() );
                         },
                         [ & ]( const fastgltf::sources::BufferView& view )
                         {
                             auto& buffer_view = gltf_asset.bufferViews[ view.bufferViewIndex ];
                             auto& buffer      = gltf_asset.buffers[ buffer_view.bufferIndex ];
 
-                            /* Yes, we've already loaded every buffer into some GL buffer. 
-                             * However, with GL it's simpler to just copy the buffer data again for the texture.
-                             * Besides, this is just an example. */
+                            /* Every buffer is a ByteView by now (see MappedGltfData::ResolveDataSources()); The image is decoded straight from it. */
                             std::visit( fastgltf::visitor
                                         {
-                                            // We only care about VectorWithMime here, because we specify LoadExternalBuffers, meaning all buffers are already loaded into a vector.
                                             []( const auto& arg ) {},
-                                            [ & ]( const fastgltf::sources::Array& vector )
+                                            [ & ]( const fastgltf::sources::ByteView& buffer_bytes )
                                             {
-												texture_to_load = AssetDatabase< Texture >::CreateAssetFromMemory( std::string( gltf_image.name ),
-																										           vector.bytes.data() + buffer_view.byteOffset,
-																										           static_cast< int >( buffer_view.byteLength ),
-																										           false, import_settings );
+                                                texture_source.image = std::span( buffer_bytes.bytes.data() + buffer_view.byteOffset, buffer_view.byteLength );
                                             }
                                         }, buffer.data );
                         }
                     }, gltf_image.data );
 
-        return texture_to_load;
+        return not texture_source.file_path.empty() || not texture_source.image.empty();
     }
 
     bool LoadNode( const fastgltf::Node& gltf_node,
@@ -352,8 +583,303 @@ namespace Engine
         return true;
     }
 
+    /* Import settings the cached data depends on. */
+    std::uint64_t HashOf( const Model::ImportSettings& import_settings )
+    {
+        return Serialization::Hasher().Add( import_settings.usage ).Add( import_settings.compressed_attributes ).Add( import_settings.optimize_indices ).Get();
+    }
+
+    /* Stores the imported model as it is uploaded: Vertex buffers are read back from the GPU, so they are stored with the compressed attributes already encoded.
+     * Textures are stored as their sources (file paths or the still encoded images) & decoded again on load. */
+    void StoreInCache( const ModelCache::Entry& entry, const Model& model, const std::vector< TextureSource >& texture_sources )
+    {
+        Serialization::Writer writer;
+
+        auto WriteIndices = [ & ]( const auto& index_container )
+        {
+            writer.Write( ( std::uint32_t )index_container.size() );
+            for( const auto index : index_container )
+                writer.Write( ( std::int32_t )index );
+        };
+
+        auto TextureIndexOf = [ & ]( const Texture* texture ) -> std::int32_t
+        {
+            const auto& textures = model.Textures();
+            return texture ? std::int32_t( std::find( textures.cbegin(), textures.cend(), texture ) - textures.cbegin() ) : -1;
+        };
+
+        /* Textures: */
+        writer.Write( ( std::uint32_t )texture_sources.size() );
+        for( auto index = 0; index < texture_sources.size(); index++ )
+        {
+            const auto& texture_source = texture_sources[ index ];
+            writer.WriteString( texture_source.name )
+                  .WriteString( model.Textures()[ index ]->Name() ) // LoadMesh() renames the textures after their use.
+                  .Write( texture_source.import_settings )
+                  .WriteString( texture_source.file_path )
+                  .WriteBlob( texture_source.image );
+        }
+
+        /* Meshes: */
+        writer.Write( ( std::uint32_t )model.MeshCount() );
+        for( const auto& mesh : model.Meshes() )
+        {
+            writer.WriteString( mesh.Name() )
+                  .Write( mesh.Primitive() )
+                  .Write( mesh.CompressedAttributes() )
+                  .Write( mesh.VertexArrangement() )
+                  .Write( mesh.PositionDequantizationTransform() )
+                  .WriteBlob( mesh.VertexData() )
+                  .WriteBlob( std::span( mesh.Positions() ) )
+                  .WriteBlob( std::span( mesh.Normals() ) )
+                  .WriteBlob( std::span( mesh.Uvs() ) )
+                  .WriteBlob( std::span( mesh.Tangents() ) )
+                  .Write( mesh.Has16BitIndices() );
+
+            std::visit( [ & ]( const auto& index_vector ) { writer.WriteBlob( std::span( index_vector ) ); }, mesh.Indices() );
+        }
+
+        /* Mesh Groups: */
+        writer.Write( ( std::uint32_t )model.MeshGroupCount() );
+        for( const auto& mesh_group : model.MeshGroups() )
+        {
+            writer.WriteString( mesh_group.name );
+            WriteIndices( mesh_group.node_indices );
+
+            writer.Write( ( std::uint32_t )mesh_group.sub_meshes.size() );
+            for( const auto& sub_mesh : mesh_group.sub_meshes )
+                writer.WriteString( sub_mesh.name )
+                      .Write( std::int32_t( &sub_mesh.mesh - model.Meshes().data() ) )
+                      .Write( TextureIndexOf( sub_mesh.texture_albedo ) )
+                      .Write( TextureIndexOf( sub_mesh.texture_normal ) )
+                      .Write( sub_mesh.color_albedo.has_value() )
+                      .Write( sub_mesh.color_albedo.value_or( Color3::Black() ) );
+        }
+
+        /* Nodes: */
+        writer.Write( ( std::uint32_t )model.NodeCount() );
+        for( const auto& node : model.Nodes() )
+        {
+            writer.WriteString( node.name )
+                  .Write( node.transform_local )
+                  .Write( node.mesh_group ? std::int32_t( node.mesh_group - model.MeshGroups().data() ) : -1 );
+            WriteIndices( node.children );
+        }
+
+        WriteIndices( model.TopLevelNodeIndices() );
+        writer.Write( ( std::int32_t )model.MeshInstanceCount() );
+
+        ModelCache::Store( entry, writer );
+    }
+
+    /* Vertex data is uploaded straight from the mapped file; Only the CPU-side copies (see Mesh::Positions() etc.) are copied out of it.
+     * Returns false on a miss or a malformed entry; The parts loaded so far are left as they are & have to be discarded by the caller then. */
+    bool LoadFromCache( const ModelCache::Entry& entry,
+                        std::vector< Model::Node >& nodes, std::vector< Model::MeshGroup >& mesh_groups, std::vector< Mesh >& meshes, std::vector< Texture* >& textures,
+                        std::vector< std::size_t >& node_indices_top_level, int& mesh_instance_count,
+                        const Model::ImportSettings& import_settings )
+    {
+        auto maybe_reader = ModelCache::Load( entry );
+        if( not maybe_reader )
+            return false;
+
+        auto& reader = *maybe_reader;
+
+        auto ReadIndices = [ & ]( auto& index_container, const std::size_t index_limit )
+        {
+            std::uint32_t count;
+            if( not reader.Read( count ) )
+                return false;
+
+            index_container.reserve( count );
+            for( std::uint32_t i = 0; i < count; i++ )
+            {
+                std::int32_t index;
+                if( not reader.Read( index ) || index < 0 || ( std::size_t )index >= index_limit )
+                    return false;
+
+                index_container.push_back( index );
+            }
+
+            return true;
+        };
+
+        /* Textures: */
+        std::uint32_t texture_count;
+        if( not reader.Read( texture_count ) )
+            return false;
+
+        std::vector< TextureSource > texture_sources( texture_count );
+        std::vector< std::string > texture_final_names( texture_count );
+        for( std::uint32_t index = 0; index < texture_count; index++ )
+        {
+            auto& texture_source = texture_sources[ index ];
+            if( not ( reader.ReadString( texture_source.name ) && reader.ReadString( texture_final_names[ index ] ) && reader.Read( texture_source.import_settings ) &&
+                      reader.ReadString( texture_source.file_path ) && reader.ReadBlob( texture_source.image ) ) )
+                return false;
+        }
+
+        if( not CreateTextures( texture_sources, textures ) )
+            return false;
+
+        for( std::uint32_t index = 0; index < texture_count; index++ )
+            if( textures[ index ]->Name() != texture_final_names[ index ] )
+                textures[ index ]->SetName( texture_final_names[ index ] );
+
+        /* Meshes: */
+        std::uint32_t mesh_count;
+        if( not reader.Read( mesh_count ) )
+            return false;
+
+        meshes.reserve( mesh_count ); // SubMeshes reference their Mesh inside this vector, so it must never reallocate.
+        for( std::uint32_t index = 0; index < mesh_count; index++ )
+        {
+            std::string mesh_name;
+            Mesh::PrimitiveType primitive_type;
+            BitFlags< Mesh::CompressedAttribute > compressed_attributes;
+            Mesh::EncodedVertices encoded_vertices;
+            std::span< const Vector3 > positions, normals, tangents;
+            std::span< const Vector2 > uvs;
+            bool has_16_bit_indices;
+            if( not ( reader.ReadString( mesh_name ) && reader.Read( primitive_type ) && reader.Read( compressed_attributes ) &&
+                      reader.Read( encoded_vertices.arrangement ) && reader.Read( encoded_vertices.position_dequantization_transform ) &&
+                      reader.ReadBlob( encoded_vertices.data ) &&
+                      reader.ReadBlob( positions ) && reader.ReadBlob( normals ) && reader.ReadBlob( uvs ) && reader.ReadBlob( tangents ) &&
+                      reader.Read( has_16_bit_indices ) ) )
+                return false;
+
+            Mesh::IndexData indices;
+            if( has_16_bit_indices )
+            {
+                std::span< const std::uint16_t > indices_u16;
+                if( not reader.ReadBlob( indices_u16 ) )
+                    return false;
+                indices = std::vector< std::uint16_t >( indices_u16.begin(), indices_u16.end() );
+            }
+            else
+            {
+                std::span< const std::uint32_t > indices_u32;
+                if( not reader.ReadBlob( indices_u32 ) )
+                    return false;
+                indices = std::vector< std::uint32_t >( indices_u32.begin(), indices_u32.end() );
+            }
+
+            std::vector< Vector3 > positions_vector( positions.begin(), positions.end() ), normals_vector( normals.begin(), normals.end() ), tangents_vector( tangents.begin(), tangents.end() );
+            std::vector< Vector2 > uvs_vector( uvs.begin(), uvs.end() );
+
+            /* Uploaded as is; A size mismatch would make the GPU read past the data. */
+            if( encoded_vertices.data.size() != Mesh::EncodedVerticesSize( positions_vector, normals_vector, uvs_vector, tangents_vector, compressed_attributes, encoded_vertices.arrangement ) )
+                return false;
+
+            meshes.emplace_back( std::move( positions_vector ),
+                                 mesh_name,
+                                 std::move( normals_vector ),
+                                 std::move( uvs_vector ),
+                                 std::move( indices ),
+                                 std::move( tangents_vector ),
+                                 primitive_type,
+                                 import_settings.usage,
+                                 compressed_attributes,
+                                 encoded_vertices );
+        }
+
+        /* Mesh Groups: */
+        std::uint32_t mesh_group_count, node_count;
+        if( not reader.Read( mesh_group_count ) )
+            return false;
+
+        mesh_groups.resize( mesh_group_count ); // Nodes point into this vector.
+        for( auto& mesh_group : mesh_groups )
+        {
+            std::uint32_t sub_mesh_count;
+            if( not ( reader.ReadString( mesh_group.name ) && ReadIndices( mesh_group.node_indices, std::numeric_limits< std::int32_t >::max() ) &&
+                      reader.Read( sub_mesh_count ) ) )
+                return false;
+
+            mesh_group.sub_meshes.reserve( sub_mesh_count );
+            for( std::uint32_t index = 0; index < sub_mesh_count; index++ )
+            {
+                std::string sub_mesh_name;
+                std::int32_t mesh_index, texture_albedo_index, texture_normal_index;
+                bool has_color_albedo;
+                Color3 color_albedo;
+                if( not ( reader.ReadString( sub_mesh_name ) && reader.Read( mesh_index ) && reader.Read( texture_albedo_index ) && reader.Read( texture_normal_index ) &&
+                          reader.Read( has_color_albedo ) && reader.Read( color_albedo ) ) ||
+                    mesh_index < 0 || mesh_index >= ( std::int32_t )meshes.size() ||
+                    texture_albedo_index >= ( std::int32_t )textures.size() || texture_normal_index >= ( std::int32_t )textures.size() )
+                    return false;
+
+                mesh_group.sub_meshes.emplace_back( sub_mesh_name,
+                                                    meshes[ mesh_index ],
+                                                    texture_albedo_index >= 0 ? textures[ texture_albedo_index ] : nullptr,
+                                                    texture_normal_index >= 0 ? textures[ texture_normal_index ] : nullptr,
+                                                    has_color_albedo ? std::optional< Color3 >( color_albedo ) : std::nullopt );
+            }
+        }
+
+        /* Nodes: */
+        if( not reader.Read( node_count ) )
+            return false;
+
+        nodes.reserve( node_count );
+        for( std::uint32_t index = 0; index < node_count; index++ )
+        {
+            std::string node_name;
+            Matrix4x4 transform_local;
+            std::int32_t mesh_group_index;
+            if( not ( reader.ReadString( node_name ) && reader.Read( transform_local ) && reader.Read( mesh_group_index ) ) ||
+                mesh_group_index >= ( std::int32_t )mesh_groups.size() )
+                return false;
+
+            auto& node = nodes.emplace_back( node_name, transform_local, mesh_group_index >= 0 ? &mesh_groups[ mesh_group_index ] : nullptr );
+            if( not ReadIndices( node.children, node_count ) )
+                return false;
+        }
+
+        std::int32_t cached_mesh_instance_count;
+        if( not ( ReadIndices( node_indices_top_level, node_count ) && reader.Read( cached_mesh_instance_count ) ) )
+            return false;
+
+        /* Could not be checked while reading, as the Nodes come after the MeshGroups. */
+        for( const auto& mesh_group : mesh_groups )
+            if( std::any_of( mesh_group.node_indices.cbegin(), mesh_group.node_indices.cend(), [ & ]( const int node_index ) { return node_index >= ( int )node_count; } ) )
+                return false;
+
+        mesh_instance_count = cached_mesh_instance_count;
+
+        return reader.IsAtEnd();
+    }
+
     std::optional< Model > Model::Loader::FromFile( const std::string_view name, const std::string& file_path, const ImportSettings& import_settings )
 	{
+        const auto start_time = std::chrono::steady_clock::now();
+
+        const auto cache_entry = ModelCache::MakeEntry( file_path, HashOf( import_settings ) );
+
+        if( cache_entry )
+        {
+            Model model( std::string{ name } );
+
+            if( LoadFromCache( *cache_entry,
+                               model.nodes, model.mesh_groups, model.meshes, model.textures, model.node_indices_top_level, model.mesh_istance_count,
+                               import_settings ) )
+            {
+                const std::chrono::duration< float, std::milli > elapsed_time( std::chrono::steady_clock::now() - start_time );
+                ServiceLocator< GLLogger >::Get().Info( "Model \"" + std::string( name ) + "\" is loaded from the model cache in " + std::to_string( elapsed_time.count() ) + " ms." );
+
+                return model;
+            }
+        }
+
+        const std::filesystem::path path( file_path );
+
+        MappedGltfData gltf_data( path ); // The asset refers to the data inside; Has to outlive it.
+        if( not gltf_data.IsOpen() )
+        {
+            std::cerr << "ERROR::MODELLOADER::Failed to open glTF file \"" << file_path << "\".\n";
+            return std::nullopt;
+        }
+
         fastgltf::Asset gltf_asset;
 
         // Parse the glTF file and get the constructed asset:
@@ -364,29 +890,20 @@ namespace Engine
                 fastgltf::Extensions::KHR_materials_variants;
 
             fastgltf::Parser parser( supported_extensions );
+            gltf_data.AttachTo( parser );
 
+            /* External buffers & images are mapped instead of loaded, see MappedGltfData & CreateTextures(). */
             constexpr auto gltf_options =
                 fastgltf::Options::DontRequireValidAssetMember |
-                fastgltf::Options::LoadExternalBuffers |
-                fastgltf::Options::LoadExternalImages |
                 fastgltf::Options::GenerateMeshIndices;
 
-			auto gltfFile = fastgltf::GltfDataBuffer::FromPath( file_path );
-			if( !bool( gltfFile ) )
-            {
-				std::cerr << "ERROR::MODELLOADER::FASTGLTF::Failed to open glTF file: " << fastgltf::getErrorMessage( gltfFile.error() ) << '\n';
-				return std::nullopt;
-			}
-
-            std::filesystem::path path( file_path );
-
             fastgltf::Expected< fastgltf::Asset > maybe_gltf_asset( fastgltf::Error::None );
              
-            if( const auto gltf_type = fastgltf::determineGltfFileType( gltfFile.get() );
+            if( const auto gltf_type = fastgltf::determineGltfFileType( gltf_data );
                 gltf_type == fastgltf::GltfType::glTF )
-                maybe_gltf_asset = parser.loadGltf( gltfFile.get(), path.parent_path(), gltf_options );
+                maybe_gltf_asset = parser.loadGltf( gltf_data, path.parent_path(), gltf_options );
             else
-                maybe_gltf_asset = parser.loadGltfBinary( gltfFile.get(), path.parent_path(), gltf_options );
+                maybe_gltf_asset = parser.loadGltfBinary( gltf_data, path.parent_path(), gltf_options );
 
             if( maybe_gltf_asset.error() != fastgltf::Error::None )
             {
@@ -397,12 +914,21 @@ namespace Engine
             gltf_asset = std::move( maybe_gltf_asset.get() );
         }
 
+        if( not gltf_data.ResolveDataSources( gltf_asset, path.parent_path() ) )
+        {
+            std::cerr << "ERROR::MODELLOADER::Failed to map the external buffers of glTF file \"" << file_path << "\".\n";
+            return std::nullopt;
+        }
+
         Model model( std::string{ name } );
         
         model.textures.reserve( gltf_asset.images.size() );
 
-		for( auto& gltf_texture : gltf_asset.textures )
+        std::vector< TextureSource > texture_sources( gltf_asset.textures.size() );
+
+		for( auto texture_index = 0; texture_index < gltf_asset.textures.size(); texture_index++ )
         {
+            const auto& gltf_texture = gltf_asset.textures[ texture_index ];
             const auto& gltf_image = gltf_asset.images[ *gltf_texture.imageIndex ];
 
             Texture::ImportSettings import_settings
@@ -444,11 +970,13 @@ namespace Engine
                 }
             }
 
-            if( not LoadTexture( gltf_asset, gltf_image,
-                                 model.textures.emplace_back(), import_settings ) )
+            if( not LoadTextureSource( gltf_asset, gltf_image, path.parent_path(), import_settings, texture_sources[ texture_index ] ) )
                 return std::nullopt;
         }
 
+        if( not CreateTextures( texture_sources, model.textures ) )
+            return std::nullopt;
+
         /*
          * Mapping between the glTF & this engine: 
          * scene        -> ~Model (Default scene is assumed, multiple scenes are not supported).
@@ -471,8 +999,14 @@ namespace Engine
 			                                             return sum_so_far + ( int )gltf_mesh.primitives.size();
 		                                             } );
 
+        /* SubMeshes reference their Mesh inside this vector, so it must never reallocate; Every glTF mesh is loaded exactly once below, so this is the final size. */
         model.meshes.reserve( sub_mesh_count );
 
+        for( auto index = 0; index < gltf_asset.meshes.size(); index++ )
+            if( not LoadMesh( gltf_asset, gltf_asset.meshes[ index ],
+                              model.mesh_groups[ index ], model.meshes, model.textures, import_settings ) )
+                return std::nullopt;
+
         std::copy( gltf_asset.scenes.front().nodeIndices.cbegin(), gltf_asset.scenes.front().nodeIndices.cend(), std::back_inserter( model.node_indices_top_level ) );
 
         for( auto index = 0; index < gltf_asset.nodes.size(); index++ )
@@ -488,16 +1022,21 @@ namespace Engine
             for( auto& child_index : gltf_node.children )
                 node.children.push_back( ( int )child_index );
 
+            /* Nodes sharing a glTF mesh share its MeshGroup (& therefore the Meshes) too. */
             if( node.mesh_group )
             {
-                if( not LoadMesh( gltf_asset, gltf_asset.meshes[ *gltf_node.meshIndex ],
-								  *node.mesh_group, model.meshes, model.textures ) )
-                    return std::nullopt;
+                node.mesh_group->node_indices.push_back( index );
 
                 model.mesh_istance_count += ( int )node.mesh_group->sub_meshes.size();
             }
         }
 
+        if( cache_entry )
+            StoreInCache( *cache_entry, model, texture_sources );
+
+        const std::chrono::duration< float, std::milli > elapsed_time( std::chrono::steady_clock::now() - start_time );
+        ServiceLocator< GLLogger >::Get().Info( "Model \"" + std::string( name ) + "\" is imported" + ( cache_entry ? " & cached" : "" ) + " in " + std::to_string( elapsed_time.count() ) + " ms." );
+
         return model;
 	}
 }
\ No newline at end of file
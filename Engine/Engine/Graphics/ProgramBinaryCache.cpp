@@ -0,0 +1,262 @@
+// Engine Includes.
+#include "ProgramBinaryCache.h"
+#include "Graphics.h"
+#include "Core/Serialization.h"
+
+// std Includes.
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace Engine::ProgramBinaryCache
+{
+	struct FileHeader
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint64_t content_hash;
+		std::uint32_t binary_format;
+		std::uint32_t binary_size;
+	};
+
+	struct MetadataFileHeader
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint64_t content_hash;		// Same as the binary's; Ties the metadata to that exact binary.
+		std::uint64_t metadata_hash;	// Of the metadata itself; Catches truncated/corrupt files.
+		std::uint64_t metadata_size;
+	};
+
+	constexpr std::uint32_t FILE_MAGIC   = 'K' | ( 'P' << 8 ) | ( 'B' << 16 ) | ( 'C' << 24 );
+	constexpr std::uint32_t FILE_VERSION = 1;
+
+	constexpr std::uint32_t METADATA_FILE_MAGIC   = 'K' | ( 'P' << 8 ) | ( 'B' << 16 ) | ( 'M' << 24 );
+	constexpr std::uint32_t METADATA_FILE_VERSION = 1;
+
+	/* Every Load() counts as exactly one of these. */
+	static std::atomic< unsigned int > hit_count  = 0;
+	static std::atomic< unsigned int > miss_count = 0;
+
+	static std::filesystem::path MetadataPath( const Entry& entry )
+	{
+		auto path( entry.path );
+		return path.replace_extension( ".meta" );
+	}
+
+	/* Writes to a temporary file first, so that an interrupted write can not leave a truncated entry behind. */
+	static void WriteFile( const std::filesystem::path& path, const void* header, const std::size_t header_size, const std::byte* data, const std::size_t data_size )
+	{
+		std::error_code error_code;
+		std::filesystem::create_directories( path.parent_path(), error_code );
+
+		auto temporary_path( path );
+		temporary_path += ".tmp";
+
+		{
+			std::ofstream file( temporary_path, std::ios::binary | std::ios::trunc );
+			if( not file )
+				return;
+
+			file.write( reinterpret_cast< const char* >( header ), header_size );
+			file.write( reinterpret_cast< const char* >( data ), data_size );
+
+			if( not file )
+				return;
+		}
+
+		std::filesystem::rename( temporary_path, path, error_code );
+	}
+
+	static const std::vector< GLint >& SupportedBinaryFormats()
+	{
+		static const std::vector< GLint > formats = []()
+		{
+			int format_count = 0;
+			glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &format_count );
+
+			std::vector< GLint > formats( format_count );
+			if( format_count > 0 )
+				glGetIntegerv( GL_PROGRAM_BINARY_FORMATS, formats.data() );
+
+			return formats;
+		}();
+
+		return formats;
+	}
+
+	static std::uint64_t DriverHash()
+	{
+		static const std::uint64_t hash = []()
+		{
+			const auto GetString = []( const GLenum name ) { return std::string_view( reinterpret_cast< const char* >( glGetString( name ) ) ); };
+
+			return Serialization::Hasher().Add( GetString( GL_VENDOR ) ).Add( GetString( GL_RENDERER ) ).Add( GetString( GL_VERSION ) ).Get();
+		}();
+
+		return hash;
+	}
+
+	Entry MakeEntry( const std::vector< std::string_view >& source_paths, const std::vector< std::string_view >& preprocessed_sources, const std::vector< std::string >& features )
+	{
+		Serialization::Hasher identity_hasher, content_hasher;
+
+		for( const auto& source_path : source_paths )
+			identity_hasher.Add( source_path );
+
+		for( const auto& preprocessed_source : preprocessed_sources )
+			content_hasher.Add( preprocessed_source );
+
+		for( const auto& feature : features )
+		{
+			identity_hasher.Add( feature );
+			content_hasher.Add( feature );
+		}
+
+		content_hasher.Add( FILE_VERSION );
+
+		std::ostringstream file_name;
+		file_name << std::hex << std::setw( 16 ) << std::setfill( '0' ) << identity_hasher.Get() << ".bin";
+
+		return Entry
+		{
+			.path         = std::filesystem::path( DIRECTORY ) / file_name.str(),
+			.content_hash = content_hasher.Get() ^ DriverHash()
+		};
+	}
+
+	/* Returns 0 if the file does not exist or can not be queried. */
+	static std::uintmax_t FileSize( const std::filesystem::path& path )
+	{
+		std::error_code error_code;
+		const auto size = std::filesystem::file_size( path, error_code );
+		return error_code ? 0 : size;
+	}
+
+	std::optional< unsigned int > Load( const Entry& entry )
+	{
+		const auto& supported_formats = SupportedBinaryFormats();
+		if( supported_formats.empty() )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		const auto file_size = FileSize( entry.path );
+
+		std::ifstream file( entry.path, std::ios::binary );
+
+		/* The size stored in the header is checked against the actual file size before allocating anything, so that a corrupt header can not trigger a huge allocation
+		 * & the driver is never handed a truncated (or padded) binary. */
+		FileHeader header;
+		if( file_size < sizeof( FileHeader ) ||
+			not file || not file.read( reinterpret_cast< char* >( &header ), sizeof( FileHeader ) ) ||
+			header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.content_hash != entry.content_hash ||
+			header.binary_size == 0 || header.binary_size > ( std::uint32_t )std::numeric_limits< GLsizei >::max() ||
+			file_size - sizeof( FileHeader ) != header.binary_size ||
+			std::find( supported_formats.cbegin(), supported_formats.cend(), ( GLint )header.binary_format ) == supported_formats.cend() )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		std::vector< std::byte > binary( header.binary_size );
+		if( not file.read( reinterpret_cast< char* >( binary.data() ), header.binary_size ) )
+		{
+			miss_count++;
+			return std::nullopt;
+		}
+
+		const unsigned int program_id = glCreateProgram();
+		glProgramBinary( program_id, header.binary_format, binary.data(), ( GLsizei )header.binary_size );
+
+		/* Drivers are free to reject binaries (e.g., after a driver update that did not change the version string); Not an error, just a miss. */
+		int success;
+		glGetProgramiv( program_id, GL_LINK_STATUS, &success );
+		if( not success )
+		{
+			glDeleteProgram( program_id );
+			miss_count++;
+			return std::nullopt;
+		}
+
+		hit_count++;
+		return program_id;
+	}
+
+	void Store( const Entry& entry, const unsigned int program_id )
+	{
+		if( SupportedBinaryFormats().empty() )
+			return;
+
+		int binary_size = 0;
+		glGetProgramiv( program_id, GL_PROGRAM_BINARY_LENGTH, &binary_size );
+		if( binary_size <= 0 )
+			return;
+
+		std::vector< std::byte > binary( binary_size );
+		GLenum binary_format;
+		glGetProgramBinary( program_id, binary_size, nullptr, &binary_format, binary.data() );
+
+		const FileHeader header
+		{
+			.magic         = FILE_MAGIC,
+			.version       = FILE_VERSION,
+			.content_hash  = entry.content_hash,
+			.binary_format = binary_format,
+			.binary_size   = ( std::uint32_t )binary_size
+		};
+
+		WriteFile( entry.path, &header, sizeof( FileHeader ), binary.data(), binary.size() );
+	}
+
+	std::optional< std::vector< std::byte > > LoadMetadata( const Entry& entry )
+	{
+		const auto metadata_path = MetadataPath( entry );
+		const auto file_size     = FileSize( metadata_path );
+
+		std::ifstream file( metadata_path, std::ios::binary );
+
+		MetadataFileHeader header;
+		if( file_size < sizeof( MetadataFileHeader ) ||
+			not file || not file.read( reinterpret_cast< char* >( &header ), sizeof( MetadataFileHeader ) ) ||
+			header.magic != METADATA_FILE_MAGIC || header.version != METADATA_FILE_VERSION || header.content_hash != entry.content_hash ||
+			file_size - sizeof( MetadataFileHeader ) != header.metadata_size )
+			return std::nullopt;
+
+		std::vector< std::byte > metadata( header.metadata_size );
+		if( not file.read( reinterpret_cast< char* >( metadata.data() ), header.metadata_size ) ||
+			Serialization::Hasher().Add( metadata ).Get() != header.metadata_hash )
+			return std::nullopt;
+
+		return metadata;
+	}
+
+	void StoreMetadata( const Entry& entry, const std::vector< std::byte >& metadata )
+	{
+		const MetadataFileHeader header
+		{
+			.magic         = METADATA_FILE_MAGIC,
+			.version       = METADATA_FILE_VERSION,
+			.content_hash  = entry.content_hash,
+			.metadata_hash = Serialization::Hasher().Add( metadata ).Get(),
+			.metadata_size = metadata.size()
+		};
+
+		WriteFile( MetadataPath( entry ), &header, sizeof( MetadataFileHeader ), metadata.data(), metadata.size() );
+	}
+
+	unsigned int HitCount()
+	{
+		return hit_count;
+	}
+
+	unsigned int MissCount()
+	{
+		return miss_count;
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// std Includes.
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Engine::ProgramBinaryCache
+{
+	/* Linked shader programs are stored via glGetProgramBinary() under DIRECTORY (relative to the working directory), one file per program.
+	 * The file name is derived from the program's identity (source paths & requested features), so recompiling a program (i.e., hot-reloading) overwrites its own entry.
+	 * The hash stored inside covers everything the binary depends on: Preprocessed stage sources, requested features & the driver (GL_VENDOR, GL_RENDERER & GL_VERSION).
+	 * Each entry can have a metadata file next to it (i.e., Shader's reflection data, as written by a Serialization::Writer), valid only as long as the binary itself is. */
+
+	constexpr const char* DIRECTORY = "ShaderCache";
+
+	struct Entry
+	{
+		std::filesystem::path path;
+		std::uint64_t content_hash;
+	};
+
+	/* Needs a current GL context. */
+	Entry MakeEntry( const std::vector< std::string_view >& source_paths, const std::vector< std::string_view >& preprocessed_sources, const std::vector< std::string >& features );
+
+	/* Returns the id of a program created from the stored binary.
+	 * Returns nullopt if there is no entry, the entry is stale or the driver rejects the binary; Caller is expected to compile from source & Store() then. */
+	std::optional< unsigned int > Load( const Entry& entry );
+	/* Program has to be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set. */
+	void Store( const Entry& entry, const unsigned int program_id );
+
+	/* Returns nullopt if there is no metadata for the entry, it belongs to a different version of the entry or it fails its checksum. */
+	std::optional< std::vector< std::byte > > LoadMetadata( const Entry& entry );
+	void StoreMetadata( const Entry& entry, const std::vector< std::byte >& metadata );
+
+	unsigned int HitCount();
+	unsigned int MissCount();
+}
@@ -3,8 +3,11 @@
 #include "DefaultFramebuffer.h"
 #include "InternalShaders.h"
 #include "InternalTextures.h"
+#include "Std140Layout_Generated.h"
 #include "UniformBufferManager.h"
 #include "Core/ImGuiDrawer.hpp"
+#include "Core/Platform.h"
+#include "Math/FastMath.hpp"
 
 // Vendor Includes.
 #include <IconFontCppHeaders/IconsFontAwesome6.h>
@@ -48,19 +51,14 @@ namespace Engine
 		lights_spot_active_count( 0 ),
 		update_uniform_buffer_lighting( false ),
 		update_uniform_buffer_other( false ),
-		sRGB_encoding_is_enabled( false )
+		sRGB_encoding_is_enabled( false ),
+		shader_source_directories_are_all_watched( true )
 	{
 		DefaultFramebuffer::Instance(); // Initialize.
 		
 		InternalShaders::Initialize( *this );
 		InternalTextures::Initialize();
 
-		if( update_uniform_buffer_lighting )
-		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED", Vector4( 0.005f, 0.05f, 0.0f, 0.0f ) );
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y",		Vector2I( 3, 3 ) );
-		}
-
 		InitializeBuiltinQueues();
 		InitializeBuiltinPasses();
 	}
@@ -142,6 +140,7 @@ namespace Engine
 
 										if( renderable->transform )
 											shadow_map_write_shader.SetUniform( "uniform_transform_world", renderable->transform->GetFinalMatrix() );
+										shadow_map_write_shader.SetUniform( "uniform_transform_position_dequantization", renderable->mesh->PositionDequantizationTransform() );
 
 										Render( *renderable->mesh );
 									}
@@ -155,6 +154,8 @@ namespace Engine
 									{
 										renderable->mesh->Bind();
 
+										shadow_map_write_instanced_shader.SetUniform( "uniform_transform_position_dequantization", renderable->mesh->PositionDequantizationTransform() );
+
 										Render( *renderable->mesh );
 									}
 								}
@@ -180,6 +181,9 @@ namespace Engine
 
 													if( renderable->transform )
 														material->SetAndUploadUniform( "uniform_transform_world", renderable->transform->GetFinalMatrix() );
+													/* Has to be uploaded for every Mesh (even the ones with float positions), as the shader always decodes the positions with it. */
+													if( material->HasUniform( "uniform_transform_position_dequantization" ) )
+														material->SetAndUploadUniform( "uniform_transform_position_dequantization", renderable->mesh->PositionDequantizationTransform() );
 
 													Render( *renderable->mesh );
 												}
@@ -282,7 +286,7 @@ namespace Engine
 
 		if( update_uniform_buffer_other )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_VIEWPORT_SIZE", Vector2( ( float )new_width_in_pixels, ( float )new_height_in_pixels ) );
+			uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_VIEWPORT_SIZE, Vector2( ( float )new_width_in_pixels, ( float )new_height_in_pixels ) );
 		}
 
 		/* Shadow maps: */
@@ -567,6 +571,9 @@ namespace Engine
 
 	void Renderer::RegisterShader( Shader& shader )
 	{
+		/* Reflection data is needed below; Also, registered Shaders are assumed to be compiled (see ShaderVariantCache::EvictUnused()). */
+		shader.CompileIfNeeded();
+
 		if( shader.HasUniformBlocks() )
 		{
 			/* Regular Uniform Buffers are handled by the Material class.
@@ -591,6 +598,13 @@ namespace Engine
 
 		if( shader.GetUniformBufferInfoMap_Intrinsic().contains( "_Intrinsic_Lighting" ) )
 		{
+			/* Built-in Shaders are compiled & registered on first use, so the lighting block may come into existence at any point; Initialize it whenever it does. */
+			if( shaders_using_intrinsics_lighting.empty() )
+			{
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED,	Vector4( 0.005f, 0.05f, 0.0f, 0.0f ) );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y,		Vector2I( 3, 3 ) );
+			}
+
 			shaders_using_intrinsics_lighting.insert( &shader );
 			update_uniform_buffer_lighting = true;
 		}
@@ -602,7 +616,10 @@ namespace Engine
 		}
 
 		if( ++shaders_registered_reference_count_map[ &shader ] == 1 )
+		{
 			shaders_registered.insert( &shader );
+			WatchSourceDirectories( shader );
+		}
 	}
 
 	void Renderer::UnregisterShader( Shader& shader )
@@ -986,16 +1003,16 @@ namespace Engine
 
 		if( update_uniform_buffer_other && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_Projection ) )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_PROJECTION", current_camera_info.projection_matrix );
+			uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_TRANSFORM_PROJECTION, current_camera_info.projection_matrix );
 			if( not targets.IsSet( IntrinsicModifyTarget::UniformBuffer_View ) ) // No need to upload twice.
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_PROJECTION", current_camera_info.view_projection_matrix );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_TRANSFORM_VIEW_PROJECTION, current_camera_info.view_projection_matrix );
 
 			if( Matrix::IsPerspectiveProjection( current_camera_info.projection_matrix ) ) // No need to upload these if they will not mean anything anyway.
 			{
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_NEAR",					current_camera_info.plane_near );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_FAR",					current_camera_info.plane_far );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_ASPECT_RATIO",			current_camera_info.aspect_ratio );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_VERTICAL_FIELD_OF_VIEW", current_camera_info.vertical_field_of_view );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_PROJECTION_NEAR,						current_camera_info.plane_near );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_PROJECTION_FAR,						current_camera_info.plane_far );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_PROJECTION_ASPECT_RATIO,				current_camera_info.aspect_ratio );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_PROJECTION_VERTICAL_FIELD_OF_VIEW,	current_camera_info.vertical_field_of_view );
 			}
 		}
 
@@ -1007,18 +1024,18 @@ namespace Engine
 
 			if( update_uniform_buffer_other )
 			{
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW",				view_matrix );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_ROTATION_ONLY",	view_matrix_rotation_only );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_PROJECTION",		current_camera_info.view_projection_matrix );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_TRANSFORM_VIEW,				view_matrix );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_TRANSFORM_VIEW_ROTATION_ONLY,	view_matrix_rotation_only );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Other::NAME, Std140Layout::Intrinsic_Other::INTRINSIC_TRANSFORM_VIEW_PROJECTION,	current_camera_info.view_projection_matrix );
 			}
 
 			if( update_uniform_buffer_lighting )
 			{
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT_IS_ACTIVE", light_directional && light_directional->is_enabled ? 1u : 0u );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_DIRECTIONAL_LIGHT_IS_ACTIVE, light_directional && light_directional->is_enabled ? 1u : 0u );
 				if( light_directional && light_directional->is_enabled )
 				{
 					light_directional->data.direction_view_space = light_directional->transform->Forward() * view_matrix_3x3;
-					uniform_buffer_management_intrinsic.SetPartial_Struct( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT", light_directional->data );
+					uniform_buffer_management_intrinsic.SetPartial_Struct( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_DIRECTIONAL_LIGHT, light_directional->data );
 				}
 
 				lights_point_active_count = 0;
@@ -1030,10 +1047,10 @@ namespace Engine
 					{
 						/* Shaders expect the lights' position & direction in view space. */
 						point_light->data.position_view_space = Vector4( point_light->transform->GetTranslation() ).SetW( 1.0f ) * view_matrix;
-						uniform_buffer_management_intrinsic.SetPartial_Array( "_Intrinsic_Lighting", "_INTRINSIC_POINT_LIGHTS", lights_point_active_count++, point_light->data );
+						uniform_buffer_management_intrinsic.SetPartial_Array( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_POINT_LIGHTS, lights_point_active_count++, point_light->data );
 					}
 				}
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_POINT_LIGHT_ACTIVE_COUNT", lights_point_active_count );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_POINT_LIGHT_ACTIVE_COUNT, lights_point_active_count );
 
 				lights_spot_active_count = 0;
 				for( auto index = 0; index < lights_spot.size(); index++ )
@@ -1045,21 +1062,21 @@ namespace Engine
 						/* Shaders expect the lights' position & direction in view space. */
 
 						spot_light->data.position_view_space_and_cos_cutoff_angle_inner.vector = ( Vector4( spot_light->transform->GetTranslation() ).SetW( 1.0f ) * view_matrix ).XYZ();
-						spot_light->data.position_view_space_and_cos_cutoff_angle_inner.scalar = Math::Cos( Radians( spot_light->data.cutoff_angle_inner ) );
+						spot_light->data.position_view_space_and_cos_cutoff_angle_inner.scalar = Math::Fast::Cos( Radians( spot_light->data.cutoff_angle_inner ) );
 
 						spot_light->data.direction_view_space_and_cos_cutoff_angle_outer.vector = spot_light->transform->Forward() * view_matrix_3x3;
-						spot_light->data.direction_view_space_and_cos_cutoff_angle_outer.scalar = Math::Cos( Radians( spot_light->data.cutoff_angle_outer ) );
+						spot_light->data.direction_view_space_and_cos_cutoff_angle_outer.scalar = Math::Fast::Cos( Radians( spot_light->data.cutoff_angle_outer ) );
 
-						uniform_buffer_management_intrinsic.SetPartial_Array( "_Intrinsic_Lighting", "_INTRINSIC_SPOT_LIGHTS", lights_spot_active_count++, spot_light->data );
+						uniform_buffer_management_intrinsic.SetPartial_Array( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_SPOT_LIGHTS, lights_spot_active_count++, spot_light->data );
 					}
 				}
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SPOT_LIGHT_ACTIVE_COUNT", lights_spot_active_count );
+				uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_SPOT_LIGHT_ACTIVE_COUNT, lights_spot_active_count );
 			}
 		}
 
 		if( update_uniform_buffer_lighting && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_Lighting_ShadowMapping ) )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM", 
+			uniform_buffer_management_intrinsic.SetPartial( Std140Layout::Intrinsic_Lighting::NAME, Std140Layout::Intrinsic_Lighting::INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM, 
 															light_directional_view_projection_transform_matrix );
 		}
 	}
@@ -1114,32 +1131,160 @@ namespace Engine
 
 	void Renderer::RecompileModifiedShaders()
 	{
-		/* Shader Recompilation: */
-		static std::vector< Shader* > shaders_to_recompile;
+		if( shader_source_directories_are_all_watched )
+		{
+			/* Only an atomic load when nothing is modified, which is almost always the case. */
+			if( const auto modified_files = Platform::PopModifiedFiles();
+				not modified_files.empty() )
+			{
+				for( const auto& shader : shaders_registered )
+					if( std::any_of( modified_files.cbegin(), modified_files.cend(), [ & ]( const std::filesystem::path& file_path ) { return shader->DependsOn( file_path ); } ) )
+						StartShaderRecompilation( *shader );
+			}
+		}
+		else
+		{
+			for( const auto& shader : shaders_registered )
+				if( shader->SourceFilesAreModified() )
+					StartShaderRecompilation( *shader );
+		}
+
+		if( not shader_recompilations_in_flight.empty() )
+			ProgressShaderRecompilations();
+	}
 
-		/* Have to do two passes as shaders to be recompiled need to be removed from shaders_registered, which we can not do while traversing the container. */
+	void Renderer::StartShaderRecompilation( Shader& shader )
+	{
+		if( auto iterator = std::find_if( shader_recompilations_in_flight.begin(), shader_recompilations_in_flight.end(),
+										  [ & ]( const ShaderRecompilation& recompilation ) { return recompilation.shader == &shader; } );
+			iterator != shader_recompilations_in_flight.end() )
+		{
+			/* Let the one in flight finish (abandoning it would leak its GL shader objects) & start over afterwards. */
+			iterator->is_outdated = true;
+			return;
+		}
 
-		shaders_to_recompile.clear();
+		auto& recompilation = shader_recompilations_in_flight.emplace_back( ShaderRecompilation
+		{
+			.shader       = &shader,
+			.new_shader   = std::make_unique< Shader >( shader.name.c_str() ),
+			.context      = std::make_unique< Shader::CompilationContext >(),
+			.is_submitted = false,
+			.is_outdated  = false
+		} );
+
+		/* Paths & features are copied, as the live Shader may be replaced or recompiled again while the worker is running. */
+		recompilation.preprocessing = std::async( std::launch::async,
+												  [ new_shader           = recompilation.new_shader.get(),
+													context              = recompilation.context.get(),
+													vertex_source_path   = shader.vertex_source_path,
+													geometry_source_path = shader.geometry_source_path,
+													fragment_source_path = shader.fragment_source_path,
+													features_requested   = shader.features_requested ]()
+												  {
+													  return new_shader->Preprocess( VertexShaderSourcePath( vertex_source_path ),
+																					 GeometryShaderSourcePath( geometry_source_path ),
+																					 FragmentShaderSourcePath( fragment_source_path ),
+																					 features_requested,
+																					 *context );
+												  } );
+	}
 
-		for( const auto& shader : shaders_registered )
-			if( shader->SourceFilesAreModified() )
-				shaders_to_recompile.push_back( shader );
+	void Renderer::ProgressShaderRecompilations()
+	{
+		std::vector< Shader* > shaders_to_recompile_again;
 
-		for( auto& shader : shaders_to_recompile )
+		for( auto iterator = shader_recompilations_in_flight.begin(); iterator != shader_recompilations_in_flight.end(); )
 		{
-			Shader new_shader( shader->name.c_str() );
-			if( shader->RecompileFromThis( new_shader ) )
+			auto& recompilation = *iterator;
+
+			bool is_finished = false, is_successful = false;
+
+			/* Shader reports its errors itself (to the console & GLLogger) & then throws; Catching here only keeps the current program in use. */
+			try
+			{
+				if( not recompilation.is_submitted &&
+					recompilation.preprocessing.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready )
+				{
+					if( recompilation.preprocessing.get() )
+					{
+						recompilation.new_shader->SubmitCompilation( *recompilation.context );
+						recompilation.is_submitted = true;
+					}
+					else
+					{
+						is_finished = true;
+						recompilation.new_shader->LogErrors_Preprocessing( *recompilation.context );
+					}
+				}
+
+				/* Not an else-if: Programs loaded from the ProgramBinaryCache (& every program, without GL_KHR_parallel_shader_compile) are complete right away. */
+				if( recompilation.is_submitted && recompilation.new_shader->IsCompilationComplete() )
+				{
+					is_finished   = true;
+					is_successful = recompilation.new_shader->CompleteCompilation( *recompilation.context );
+				}
+			}
+			catch( const std::exception& )
+			{
+				is_finished = true;
+			}
+
+			if( not is_finished )
 			{
-				UnregisterShader( *shader );
+				iterator++;
+				continue;
+			}
 
-				*shader = std::move( new_shader );
+			auto& shader = *recompilation.shader;
 
-				RegisterShader( *shader );
+			if( is_successful )
+			{
+				/* The Shader may have lost all its Renderables meanwhile; It is still updated, for whenever it gets used again. */
+				const bool is_registered = shaders_registered.contains( &shader );
+
+				if( is_registered )
+					UnregisterShader( shader );
 
-				logger.Info( "\"" + shader->name + "\" shader's source files are modified. It is recompiled." );
+				shader = std::move( *recompilation.new_shader );
+
+				if( is_registered )
+					RegisterShader( shader );
+
+				/* The new version may #include files from directories the previous one did not; Already watched directories are skipped. */
+				WatchSourceDirectories( shader );
+
+				logger.Info( "\"" + shader.name + "\" shader's source files are modified. It is recompiled." );
 			}
 			else
-				logger.Error( "\"" + shader->name + "\" shader's source files are modified but it could not be recompiled successfully." );
+				logger.Error( "\"" + shader.name + "\" shader's source files are modified but it could not be recompiled successfully. Previous version stays in use." );
+
+			if( recompilation.is_outdated )
+				shaders_to_recompile_again.push_back( &shader );
+
+			iterator = shader_recompilations_in_flight.erase( iterator );
+		}
+
+		for( auto* shader : shaders_to_recompile_again )
+			StartShaderRecompilation( *shader );
+	}
+
+	void Renderer::WatchSourceDirectories( const Shader& shader )
+	{
+		for( const auto& [ source_path, last_write_time ] : shader.last_write_time_map )
+		{
+			const auto directory_path( std::filesystem::path( source_path ).parent_path() );
+
+			if( std::find( shader_source_directories_watched.cbegin(), shader_source_directories_watched.cend(), directory_path ) == shader_source_directories_watched.cend() )
+			{
+				if( Platform::WatchDirectory( directory_path ) )
+					shader_source_directories_watched.push_back( directory_path );
+				else
+				{
+					shader_source_directories_are_all_watched = false;
+					logger.Warning( "Shader source directory \"" + directory_path.string() + "\" could not be watched; Falling back to polling for shader hot-reloading." );
+				}
+			}
 		}
 	}
 
@@ -1223,8 +1368,8 @@ namespace Engine
 						   [ & ]( Renderable* renderable_1, Renderable* renderable_2 )
 							{
 								if( renderable_1->GetTransform() && renderable_2->GetTransform() )
-									return Math::Distance( camera_position, renderable_1->GetTransform()->GetTranslation() ) <
-										   Math::Distance( camera_position, renderable_2->GetTransform()->GetTranslation() );
+									return Math::SquareDistance( camera_position, renderable_1->GetTransform()->GetTranslation() ) <
+										   Math::SquareDistance( camera_position, renderable_2->GetTransform()->GetTranslation() );
 
 								return renderable_1 < renderable_2; // Does not matter;
 							} );
@@ -1235,8 +1380,8 @@ namespace Engine
 						   [ & ]( Renderable* renderable_1, Renderable* renderable_2 )
 							{
 								if( renderable_1->GetTransform() && renderable_2->GetTransform() )
-									return Math::Distance( camera_position, renderable_1->GetTransform()->GetTranslation() ) >
-										   Math::Distance( camera_position, renderable_2->GetTransform()->GetTranslation() );
+									return Math::SquareDistance( camera_position, renderable_1->GetTransform()->GetTranslation() ) >
+										   Math::SquareDistance( camera_position, renderable_2->GetTransform()->GetTranslation() );
 							
 								return renderable_1 < renderable_2; // Does not matter;
 							} );
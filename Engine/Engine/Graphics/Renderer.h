@@ -13,7 +13,9 @@
 #include "UniformBufferManagement.hpp"
 
 // std Includes.
+#include <future>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -214,6 +216,9 @@ namespace Engine
 
 		void CalculateShadowMappingInformation();
 		void RecompileModifiedShaders();
+		void StartShaderRecompilation( Shader& shader );
+		void ProgressShaderRecompilations();
+		void WatchSourceDirectories( const Shader& shader );
 
 		/*
 		 * Pass, Queue & Renderable:
@@ -306,6 +311,23 @@ namespace Engine
 		std::unordered_set< Shader* > shaders_registered;
 		std::unordered_map< Shader*, Shader::ReferenceCount > shaders_registered_reference_count_map;
 
+		/* Directories containing the registered Shaders' source & include files. */
+		std::vector< std::filesystem::path > shader_source_directories_watched;
+
+		/* A modified Shader is preprocessed on a worker thread & compiled/linked in the background (GL_KHR_parallel_shader_compile), spanning as many frames as needed.
+		 * The Shader keeps its current program until the new one is linked successfully; A failed recompilation leaves it untouched. */
+		struct ShaderRecompilation
+		{
+			Shader* shader;
+			std::unique_ptr< Shader > new_shader;
+			std::unique_ptr< Shader::CompilationContext > context;
+			std::future< bool > preprocessing; // Declared after the two above, so that its destruction waits for the worker writing to them.
+			bool is_submitted;
+			bool is_outdated; // Sources got modified again while in flight; Another recompilation follows this one.
+			// bool padding[ 6 ];
+		};
+		std::vector< ShaderRecompilation > shader_recompilations_in_flight;
+
 		/*
 		 * Uniform Management:
 		 */
@@ -326,7 +348,13 @@ namespace Engine
 		 */
 
 		bool sRGB_encoding_is_enabled;
+
+		/*
+		 * Shader Hot-reloading:
+		 */
+
+		bool shader_source_directories_are_all_watched; // Otherwise, falls back to polling the source files' last write times every frame.
 		
-		/* 5 bytes of padding. */
+		/* 4 bytes of padding. */
 	};
 }
@@ -6,22 +6,35 @@
 
 // Engince Includes.
 #include "Asset/Shader/InternalShaderDirectoryPath.h"
+#include "Core/Serialization.h"
 #include "Core/ServiceLocator.h"
 #include "Core/Utility.hpp"
 #include "GLLogger.h"
+#include "ProgramBinaryCache.h"
 #include "Shader.hpp"
+#include "ShaderIncludeCache.h"
 #include "ShaderTypeInformation.h"
 #include "UniformBlockBindingPointManager.h"
 
 // std Includes.
+#include <atomic>
+#include <execution>
+#include <fstream>
 #include <numeric> // std::iota.
-#include <regex>
-
-// Vendor Includes.
-#include <stb/stb_include.h>
 
 namespace Engine
 {
+	/* Bump whenever the layout written by SerializeReflectionData() changes. */
+	constexpr std::uint32_t REFLECTION_DATA_FORMAT_VERSION = 1;
+
+	/* Cleared for good once a SPIR-V program turns out to have no resource names on this driver. */
+	static std::atomic_bool SPIRV_IS_USABLE = true;
+
+	static bool SPIRVIsAvailable()
+	{
+		return ( GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_gl_spirv ) && SPIRV_IS_USABLE;
+	}
+
 	/* Will be initialized later with FromFile(). */
 	Shader::Shader( const char* name )
 		:
@@ -144,141 +157,124 @@ namespace Engine
 						   const FragmentShaderSourcePath& fragment_shader_source_path,
 						   const Features& features_to_set )
 	{
-		this->vertex_source_path   = ( std::string )vertex_shader_source_path;
-		this->geometry_source_path = ( std::string )geometry_shader_source_path;
-		this->fragment_source_path = ( std::string )fragment_shader_source_path;
-
-		features_requested = features_to_set;
-
-		unsigned int vertex_shader_id = 0, geometry_shader_id = 0, fragment_shader_id = 0;
+		CompilationContext context;
 
-		std::optional< std::string > vertex_shader_source;
-		std::optional< std::string > geometry_shader_source;
-		std::optional< std::string > fragment_shader_source;
-		std::unordered_map< std::string, Feature > vertex_shader_features;
-		std::unordered_map< std::string, Feature > geometry_shader_features;
-		std::unordered_map< std::string, Feature > fragment_shader_features;
-
-		if( vertex_shader_source = ParseShaderFromFile( vertex_shader_source_path, ShaderType::Vertex );
-			vertex_shader_source )
+		if( not Preprocess( vertex_shader_source_path, geometry_shader_source_path, fragment_shader_source_path, features_to_set, context ) )
 		{
-			auto& shader_source = *vertex_shader_source;
+			LogErrors_Preprocessing( context );
+			return false;
+		}
 
-			vertex_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-			PreProcessShaderStage_IncludeDirectives( vertex_shader_source_path, shader_source, ShaderType::Vertex );
-			vertex_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-			PreProcessShaderStage_SetFeatures( shader_source, vertex_shader_features, features_to_set );
+		SubmitCompilation( context );
 
-			if( !CompileShader( shader_source.c_str(), vertex_shader_id, ShaderType::Vertex ) )
-				return false;
-		}
-		else
-			return false;
+		return CompleteCompilation( context );
+	}
 
-		feature_map.insert( vertex_shader_features.begin(), vertex_shader_features.end() );
+	bool Shader::FromFile_Batch( const std::vector< FromFileParameters >& batch )
+	{
+		std::vector< CompilationContext > contexts( batch.size() );
+		std::vector< std::exception_ptr > preprocess_exceptions( batch.size() );
+		std::vector< std::uint8_t > preprocess_results( batch.size(), false ); // Not vector< bool >, as it is written to concurrently.
 
-		if( not geometry_shader_source_path.Empty() )
+		/* Preprocessing touches no GL state, so it can be done in parallel: */
+		std::for_each( std::execution::par, contexts.begin(), contexts.end(), [ & ]( CompilationContext& context )
 		{
-			if( geometry_shader_source = ParseShaderFromFile( geometry_shader_source_path, ShaderType::Geometry );
-				geometry_shader_source )
+			const auto index = &context - contexts.data();
+			const auto& parameters = batch[ index ];
+
+			try
 			{
-				auto& shader_source = *geometry_shader_source;
+				preprocess_results[ index ] = parameters.shader->Preprocess( VertexShaderSourcePath( parameters.vertex_source_path ),
+																			 GeometryShaderSourcePath( parameters.geometry_source_path ),
+																			 FragmentShaderSourcePath( parameters.fragment_source_path ),
+																			 parameters.features_to_set,
+																			 context );
+			}
+			catch( ... )
+			{
+				preprocess_exceptions[ index ] = std::current_exception();
+			}
+		} );
 
-				geometry_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-				PreProcessShaderStage_IncludeDirectives( geometry_shader_source_path, shader_source, ShaderType::Geometry );
-				geometry_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-				PreProcessShaderStage_SetFeatures( shader_source, geometry_shader_features, features_to_set );
+		/* A failing Shader reports its errors itself & then throws (see LogErrors()); Failures are contained per entry, so that the rest of the batch still completes.
+		 * Failed Shaders are left uncompiled, so that they are retried on next use (see CompileIfNeeded()). */
+		const auto CompleteStepOrMarkFailed = [ & ]( const std::size_t index, const auto& step )
+		{
+			bool is_successful = false;
 
-				if( !CompileShader( shader_source.c_str(), geometry_shader_id, ShaderType::Geometry ) )
-					return false;
+			try
+			{
+				is_successful = step();
 			}
-			else
+			catch( const std::exception& )
 			{
-				glDeleteShader( vertex_shader_id );
-				return false;
 			}
 
-			feature_map.insert( geometry_shader_features.begin(), geometry_shader_features.end() );
-		}
+			if( not is_successful )
+				batch[ index ].shader->Delete();
 
-		if( fragment_shader_source = ParseShaderFromFile( fragment_shader_source_path, ShaderType::Fragment );
-			fragment_shader_source )
-		{
-			auto& shader_source = *fragment_shader_source;
-
-			fragment_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-			PreProcessShaderStage_IncludeDirectives( fragment_shader_source_path, shader_source, ShaderType::Fragment );
-			fragment_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-			PreProcessShaderStage_SetFeatures( shader_source, fragment_shader_features, features_to_set );
+			return is_successful;
+		};
 
-			if( !CompileShader( shader_source.c_str(), fragment_shader_id, ShaderType::Fragment ) )
-				return false;
-		}
-		else
+		/* Back on the GL thread; Report what the workers collected: */
+		for( std::size_t index = 0; index < batch.size(); index++ )
 		{
-			glDeleteShader( vertex_shader_id );
-			if( geometry_shader_id > 0 )
-				glDeleteShader( geometry_shader_id );
+			if( preprocess_exceptions[ index ] )
+			{
+				/* Not thrown by LogErrors(), hence not reported yet. */
+				CompleteStepOrMarkFailed( index, [ & ]()
+				{
+					try
+					{
+						std::rethrow_exception( preprocess_exceptions[ index ] );
+					}
+					catch( const std::exception& exception )
+					{
+						batch[ index ].shader->LogErrors( exception.what() );
+					}
 
-			return false;
+					return false;
+				} );
+			}
+			else if( not preprocess_results[ index ] )
+				CompleteStepOrMarkFailed( index, [ & ]() { batch[ index ].shader->LogErrors_Preprocessing( contexts[ index ] ); return false; } );
 		}
 
-		feature_map.insert( fragment_shader_features.begin(), fragment_shader_features.end() );
+		/* Submit everything before waiting on anything, so that the driver can compile concurrently (with GL_KHR_parallel_shader_compile, on its own threads): */
+		if( GLAD_GL_KHR_parallel_shader_compile )
+			glMaxShaderCompilerThreadsKHR( 0xFFFFFFFF ); // Let the implementation decide.
 
-		const bool link_result = LinkProgram( vertex_shader_id, geometry_shader_id, fragment_shader_id );
+		for( std::size_t index = 0; index < batch.size(); index++ )
+			if( preprocess_results[ index ] )
+				batch[ index ].shader->SubmitCompilation( contexts[ index ] );
 
-		glDeleteShader( vertex_shader_id );
-		if( not geometry_shader_source_path.Empty() )
-			glDeleteShader( geometry_shader_id );
-		glDeleteShader( fragment_shader_id );
+		bool all_succeeded = true;
 
-		if( link_result )
+		std::vector< std::size_t > pending_indices;
+		for( std::size_t index = 0; index < batch.size(); index++ )
 		{
-		#ifdef _DEBUG
-			ServiceLocator< GLLogger >::Get().SetLabel( GL_PROGRAM, program_id.Get(), name );
-		#endif // _DEBUG
-
-			QueryVertexAttributes();
-
-			GetUniformBookKeepingInfo();
-			if( uniform_book_keeping_info.count == 0 )
-				return true;
-
-			QueryUniformData();
-
-			ParseShaderSource_VertexLayout( *vertex_shader_source );
-			ParseShaderSource_UniformUsageHints( *vertex_shader_source, ShaderType::Vertex );
-			if( geometry_shader_source )
-				ParseShaderSource_UniformUsageHints( *geometry_shader_source, ShaderType::Geometry );
-			ParseShaderSource_UniformUsageHints( *fragment_shader_source, ShaderType::Fragment );
-
-			QueryUniformData_BlockIndexAndOffsetForBufferMembers();
-			QueryUniformBufferData( uniform_buffer_info_map_regular, Uniform::BufferCategory::Regular );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_regular );
-			QueryUniformBufferData( uniform_buffer_info_map_global, Uniform::BufferCategory::Global );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_global );
-			QueryUniformBufferData( uniform_buffer_info_map_intrinsic, Uniform::BufferCategory::Intrinsic );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_intrinsic );
-
-			CalculateTotalUniformSizes();
-			EnumerateUniformBufferCategories();
-
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_regular )
-				UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+			if( preprocess_results[ index ] )
+				pending_indices.push_back( index );
+			else
+				all_succeeded = false;
+		}
 
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_global )
-				UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+		/* Query reflection data of whichever program is ready first, while the driver keeps working on the rest.
+		 * When none is ready, block on the oldest one instead of spinning. */
+		while( not pending_indices.empty() )
+		{
+			auto ready_iterator = std::find_if( pending_indices.begin(), pending_indices.end(),
+												[ & ]( const std::size_t index ) { return batch[ index ].shader->IsCompilationComplete(); } );
+			if( ready_iterator == pending_indices.end() )
+				ready_iterator = pending_indices.begin();
 
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_intrinsic )
-				UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+			const auto index = *ready_iterator;
+			pending_indices.erase( ready_iterator );
 
-			last_write_time_map.emplace( vertex_source_path, std::filesystem::last_write_time( vertex_source_path ) );
-			if( not geometry_shader_source_path.Empty() )
-				last_write_time_map.emplace( geometry_source_path, std::filesystem::last_write_time( geometry_source_path ) );
-			last_write_time_map.emplace( fragment_source_path, std::filesystem::last_write_time( fragment_source_path ) );
+			all_succeeded = CompleteStepOrMarkFailed( index, [ & ]() { return batch[ index ].shader->CompleteCompilation( contexts[ index ] ); } ) && all_succeeded;
 		}
 
-		return link_result;
+		return all_succeeded;
 	}
 
 	void Shader::Bind() const
@@ -294,6 +290,30 @@ namespace Engine
 									features_requested );
 	}
 
+	bool Shader::CompileIfNeeded()
+	{
+		if( IsValid() )
+			return true;
+
+		ASSERT_DEBUG_ONLY( not vertex_source_path.empty() && "Shader::CompileIfNeeded() called on a Shader without recorded sources!" );
+
+		/* Compile into a separate Shader & move it in, just like hot-reloading does:
+		 * Reflection data left behind by an eviction gets replaced as a whole, while pointers to this Shader (& its maps) held elsewhere stay valid. */
+		Shader compiled_shader( name.c_str() );
+		if( not RecompileFromThis( compiled_shader ) )
+			return false;
+
+		*this = std::move( compiled_shader );
+
+		return true;
+	}
+
+	bool Shader::DependsOn( const std::filesystem::path& file_path ) const
+	{
+		return std::any_of( last_write_time_map.cbegin(), last_write_time_map.cend(),
+							[ & ]( const auto& source_and_last_write_time ) { return std::filesystem::path( source_and_last_write_time.first ) == file_path; } );
+	}
+
 	bool Shader::SourceFilesAreModified()
 	{
 		for( auto& [ source, last_write_time ] : last_write_time_map )
@@ -419,114 +439,432 @@ namespace Engine
 		}
 	}
 
-	std::optional< std::string > Shader::ParseShaderFromFile( const char* file_path, const ShaderType shader_type )
+	void Shader::Defer( const std::string& vertex_shader_source_path,
+						const std::string& geometry_shader_source_path,
+						const std::string& fragment_shader_source_path,
+						const Features& features_to_set )
 	{
-		const std::string error_prompt( std::string( "ERROR::SHADER::" ) + ShaderTypeString( shader_type ) + "::FILE_NOT_SUCCESSFULLY_READ\n\tShader name: " + name + "\n" );
-
-		if( const auto source = Engine::Utility::ReadFileIntoString( file_path, error_prompt.c_str() );
-			source )
-			return *source;
-
-		LogErrors( error_prompt );
+		vertex_source_path   = vertex_shader_source_path;
+		geometry_source_path = geometry_shader_source_path;
+		fragment_source_path = fragment_shader_source_path;
 
-		return std::nullopt;
+		features_requested = features_to_set;
 	}
 
-	std::vector< std::string > Shader::PreprocessShaderStage_GetIncludeFilePaths( std::string shader_source ) const
+	bool Shader::Preprocess( const VertexShaderSourcePath& vertex_shader_source_path,
+							 const GeometryShaderSourcePath& geometry_shader_source_path,
+							 const FragmentShaderSourcePath& fragment_shader_source_path,
+							 const Features& features_to_set,
+							 CompilationContext& context )
 	{
-		std::regex pattern( R"(#include\s+"\s*(\S+)\s*")" );
-		std::smatch matches;
+		this->vertex_source_path   = ( std::string )vertex_shader_source_path;
+		this->geometry_source_path = ( std::string )geometry_shader_source_path;
+		this->fragment_source_path = ( std::string )fragment_shader_source_path;
 
-		std::vector< std::string > includes;
+		features_requested = features_to_set;
+
+		auto& vertex_shader_source   = context.vertex_shader_source;
+		auto& geometry_shader_source = context.geometry_shader_source;
+		auto& fragment_shader_source = context.fragment_shader_source;
+
+		std::unordered_map< std::string, Feature > vertex_shader_features;
+		std::unordered_map< std::string, Feature > geometry_shader_features;
+		std::unordered_map< std::string, Feature > fragment_shader_features;
+
+		if( vertex_shader_source = ParseShaderFromFile( vertex_shader_source_path, ShaderType::Vertex, context );
+			vertex_shader_source )
+		{
+			auto& shader_source = *vertex_shader_source;
+
+			vertex_source_include_path_array.clear();
+			if( not PreProcessShaderStage_IncludeDirectives( vertex_shader_source_path, shader_source, vertex_source_include_path_array, ShaderType::Vertex, context ) )
+				return false;
+			const auto directives = ShaderSourceScanner::Scan( shader_source );
+			vertex_shader_features = PreProcessShaderStage_ParseFeatures( directives );
+			PreProcessShaderStage_SetFeatures( shader_source, directives, vertex_shader_features, features_to_set );
+		}
+		else
+			return false;
 
-		if( std::regex_search( shader_source, matches, pattern ) )
+		feature_map.insert( vertex_shader_features.begin(), vertex_shader_features.end() );
+
+		if( not geometry_shader_source_path.Empty() )
 		{
-			do
+			if( geometry_shader_source = ParseShaderFromFile( geometry_shader_source_path, ShaderType::Geometry, context );
+				geometry_shader_source )
 			{
-				const auto& match = matches[ 1 ]; /* First match is the pattern itself. */
-				if( match.length() != 0 && match.matched )
-					includes.emplace_back( std::string( Engine::SHADER_SOURCE_DIRECTORY_WITH_SEPARATOR ) + ( std::string )match );
+				auto& shader_source = *geometry_shader_source;
 
-				shader_source = matches.suffix();
+				geometry_source_include_path_array.clear();
+				if( not PreProcessShaderStage_IncludeDirectives( geometry_shader_source_path, shader_source, geometry_source_include_path_array, ShaderType::Geometry, context ) )
+					return false;
+				const auto directives = ShaderSourceScanner::Scan( shader_source );
+				geometry_shader_features = PreProcessShaderStage_ParseFeatures( directives );
+				PreProcessShaderStage_SetFeatures( shader_source, directives, geometry_shader_features, features_to_set );
 			}
-			while( std::regex_search( shader_source, matches, pattern ) );
+			else
+				return false;
+
+			feature_map.insert( geometry_shader_features.begin(), geometry_shader_features.end() );
+		}
+
+		if( fragment_shader_source = ParseShaderFromFile( fragment_shader_source_path, ShaderType::Fragment, context );
+			fragment_shader_source )
+		{
+			auto& shader_source = *fragment_shader_source;
+
+			fragment_source_include_path_array.clear();
+			if( not PreProcessShaderStage_IncludeDirectives( fragment_shader_source_path, shader_source, fragment_source_include_path_array, ShaderType::Fragment, context ) )
+				return false;
+			const auto directives = ShaderSourceScanner::Scan( shader_source );
+			fragment_shader_features = PreProcessShaderStage_ParseFeatures( directives );
+			PreProcessShaderStage_SetFeatures( shader_source, directives, fragment_shader_features, features_to_set );
 		}
+		else
+			return false;
+
+		feature_map.insert( fragment_shader_features.begin(), fragment_shader_features.end() );
 
-		return includes;
+		if( SPIRVIsAvailable() )
+		{
+			if( const auto program_module_directory = FindSPIRVProgram();
+				program_module_directory )
+			{
+				context.vertex_spirv_module = ReadSPIRVModule( *program_module_directory / "vert.spv" );
+				if( geometry_shader_source )
+					context.geometry_spirv_module = ReadSPIRVModule( *program_module_directory / "geom.spv" );
+				context.fragment_spirv_module = ReadSPIRVModule( *program_module_directory / "frag.spv" );
+			}
+
+			/* GL can not link SPIR-V & GLSL shaders together. */
+			if( not context.vertex_spirv_module || ( geometry_shader_source && not context.geometry_spirv_module ) || not context.fragment_spirv_module )
+			{
+				context.vertex_spirv_module.reset();
+				context.geometry_spirv_module.reset();
+				context.fragment_spirv_module.reset();
+			}
+		}
+
+		return true;
 	}
 
-	void Shader::PreprocessShaderStage_StripDefinesToBeSet( std::string& shader_source_to_modify, const std::vector< std::string >& features_to_set )
+	void Shader::SubmitCompilation( CompilationContext& context )
 	{
-		std::regex pattern( R"(#define\s+([_[:alnum:]]+)\s*(\S+)?\s*?\r?\n)" ); // ([_[:alnum:]]+) is to FAIL the Regex for non alnum & non-underscore characters, to exclude macros mostly.
-		std::smatch matches;
+		context.program_binary_cache_entry = ProgramBinaryCache::MakeEntry( { vertex_source_path, geometry_source_path, fragment_source_path },
+																			{ *context.vertex_shader_source,
+																			  context.geometry_shader_source ? std::string_view( *context.geometry_shader_source ) : std::string_view(),
+																			  *context.fragment_shader_source },
+																			features_requested );
+
+		if( const auto cached_program_id = ProgramBinaryCache::Load( context.program_binary_cache_entry );
+			cached_program_id )
+		{
+			program_id = ID( *cached_program_id );
+			context.is_loaded_from_program_binary_cache = true;
+			return;
+		}
+
+		/* Only issue the commands here; Statuses are queried in CompleteCompilation(), as querying them would block until the driver is done. */
+		if( context.vertex_spirv_module )
+		{
+			/* Specialization is what compiles a SPIR-V module; Features are baked into separate modules instead of specialization constants, as they add/remove declarations. */
+			const auto Specialize = []( const std::vector< std::byte >& module, const ShaderType shader_type )
+			{
+				const unsigned int shader_id = glCreateShader( ShaderTypeID( shader_type ) );
+				glShaderBinary( 1, &shader_id, GL_SHADER_BINARY_FORMAT_SPIR_V, module.data(), ( GLsizei )module.size() );
+				if( GLAD_GL_VERSION_4_6 )
+					glSpecializeShader( shader_id, "main", 0, nullptr, nullptr );
+				else
+					glSpecializeShaderARB( shader_id, "main", 0, nullptr, nullptr );
+
+				return shader_id;
+			};
 
-		std::string shader_source_copy( shader_source_to_modify );
+			context.vertex_shader_id = Specialize( *context.vertex_spirv_module, ShaderType::Vertex );
+			if( context.geometry_spirv_module )
+				context.geometry_shader_id = Specialize( *context.geometry_spirv_module, ShaderType::Geometry );
+			context.fragment_shader_id = Specialize( *context.fragment_spirv_module, ShaderType::Fragment );
 
-		while( std::regex_search( shader_source_copy, matches, pattern ) )
+			context.is_compiled_from_spirv = true;
+		}
+		else
 		{
-			if( std::find_if( features_to_set.begin(), features_to_set.end(), [ & ]( const std::string& feature )
-				{ return feature.find( matches[ 1 ] ) != std::string::npos; } ) != features_to_set.end() )
-				shader_source_to_modify = std::string( matches.prefix() ) + std::string( matches.suffix() );
+			const auto Compile = []( const std::string& source, const ShaderType shader_type )
+			{
+				const char* source_c_string = source.c_str();
+
+				const unsigned int shader_id = glCreateShader( ShaderTypeID( shader_type ) );
+				glShaderSource( shader_id, /* how many strings: */ 1, &source_c_string, NULL );
+				glCompileShader( shader_id );
 
-			shader_source_copy = matches.suffix();
+				return shader_id;
+			};
+
+			context.vertex_shader_id = Compile( *context.vertex_shader_source, ShaderType::Vertex );
+			if( context.geometry_shader_source )
+				context.geometry_shader_id = Compile( *context.geometry_shader_source, ShaderType::Geometry );
+			context.fragment_shader_id = Compile( *context.fragment_shader_source, ShaderType::Fragment );
 		}
+
+		program_id = ID( glCreateProgram() );
+
+		glAttachShader( program_id.Get(), context.vertex_shader_id );
+		if( context.geometry_shader_id > 0 )
+			glAttachShader( program_id.Get(), context.geometry_shader_id );
+		glAttachShader( program_id.Get(), context.fragment_shader_id );
+
+		/* So that the linked program can be stored in the ProgramBinaryCache. */
+		glProgramParameteri( program_id.Get(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+
+		glLinkProgram( program_id.Get() );
 	}
 
-	std::unordered_map< std::string, Shader::Feature > Shader::PreProcessShaderStage_ParseFeatures( std::string shader_source )
+	bool Shader::IsCompilationComplete() const
 	{
-		std::unordered_map< std::string, Feature > features;
+		if( not GLAD_GL_KHR_parallel_shader_compile )
+			return true; // Nothing to poll; Querying the link status will simply block.
 
-		/* Parse declarations via "#pragma feature <feature_name>" syntax: */
-		{
-			std::regex pattern( R"(#pragma\s+feature\s*(\S+))" );
-			std::smatch matches;
+		int is_complete = GL_FALSE;
+		glGetProgramiv( program_id.Get(), GL_COMPLETION_STATUS_KHR, &is_complete );
+		return is_complete == GL_TRUE;
+	}
 
-			if( std::regex_search( shader_source, matches, pattern ) )
+	bool Shader::CompleteCompilation( CompilationContext& context )
+	{
+		if( not context.is_loaded_from_program_binary_cache )
+		{
+			const auto DeleteShaderObjects = [ & ]()
 			{
+				glDeleteShader( context.vertex_shader_id );
+				if( context.geometry_shader_id > 0 )
+					glDeleteShader( context.geometry_shader_id );
+				glDeleteShader( context.fragment_shader_id );
+			};
+
+			int success;
 
-				do
+			/* Fall back to the GLSL sources (at hand anyway) if the modules do not link or the driver dropped the names the reflection relies on. */
+			if( context.is_compiled_from_spirv )
+			{
+				glGetProgramiv( program_id.Get(), GL_LINK_STATUS, &success );
+				if( not success || not ProgramHasResourceNames() )
 				{
-					const auto& match_feature_name = matches[ 1 ]; /* First match is the pattern itself. */
-					if( match_feature_name.length() != 0 && match_feature_name.matched )
-						features.try_emplace( match_feature_name, std::nullopt, false );
+					if( success && SPIRV_IS_USABLE.exchange( false ) )
+						ServiceLocator< GLLogger >::Get().Warning( "Programs created from SPIR-V have no resource names on this driver; Shaders will be compiled from GLSL." );
+
+					DeleteShaderObjects();
+					Delete();
+
+					context.vertex_spirv_module.reset();
+					context.geometry_spirv_module.reset();
+					context.fragment_spirv_module.reset();
+					context.vertex_shader_id = context.geometry_shader_id = context.fragment_shader_id = 0;
+					context.is_compiled_from_spirv = false;
 
-					shader_source = matches.suffix();
+					SubmitCompilation( context );
 				}
-				while( std::regex_search( shader_source, matches, pattern ) );
 			}
-		}
-
-		/* Parse definitions via "#define <feature_name> <optional_value>" syntax: */
-		{
-			std::regex pattern( R"(#define\s+([_[:alnum:]]+)\s*(\S+)?\s*\r?\n)" ); // ([_[:alnum:]]+) is to FAIL the Regex for non alnum & non-underscore characters, to exclude macros mostly.
-			std::smatch matches;
 
-			if( std::regex_search( shader_source, matches, pattern ) )
+			glGetProgramiv( program_id.Get(), GL_LINK_STATUS, &success );
+			if( !success )
 			{
-				do
+				/* Report the compilation error if there is one, as it is the root cause of the linkage error. */
+				for( const auto& [ shader_id, shader_type ] : { std::pair{ context.vertex_shader_id,	ShaderType::Vertex	 },
+																std::pair{ context.geometry_shader_id,	ShaderType::Geometry },
+																std::pair{ context.fragment_shader_id,	ShaderType::Fragment } } )
 				{
-					const auto& match_feature_name = matches[ 1 ]; /* First match is the pattern itself. */
-					if( match_feature_name.length() != 0 && match_feature_name.matched )
+					if( shader_id == 0 )
+						continue;
+
+					glGetShaderiv( shader_id, GL_COMPILE_STATUS, &success );
+					if( !success )
 					{
-						if( matches.size() > 2 && matches[ 2 ].length() != 0 && matches[ 2 ].matched )
-						{
-							const auto& match_feature_value = matches[ 2 ];
-							features.try_emplace( match_feature_name, match_feature_value, true );
-						}
-						else
-							features.try_emplace( match_feature_name, std::nullopt, true );
+						LogErrors_Compilation( shader_id, shader_type );
+						DeleteShaderObjects();
+						return false;
 					}
-
-					shader_source = matches.suffix();
 				}
-				while( std::regex_search( shader_source, matches, pattern ) );
+
+				LogErrors_Linking();
+				DeleteShaderObjects();
+				return false;
 			}
+
+			DeleteShaderObjects();
+
+			ProgramBinaryCache::Store( context.program_binary_cache_entry, program_id.Get() );
+		}
+
+	#ifdef _DEBUG
+		ServiceLocator< GLLogger >::Get().SetLabel( GL_PROGRAM, program_id.Get(), name );
+	#endif // _DEBUG
+
+		/* A program loaded from the ProgramBinaryCache is the very program reflected when it was stored, so its reflection data is loaded too, skipping the queries. */
+		bool reflection_data_is_loaded = false;
+		if( context.is_loaded_from_program_binary_cache )
+		{
+			if( const auto metadata = ProgramBinaryCache::LoadMetadata( context.program_binary_cache_entry );
+				metadata )
+				reflection_data_is_loaded = DeserializeReflectionData( *metadata );
+		}
+
+		if( not reflection_data_is_loaded )
+		{
+			QueryReflectionData( context );
+			ProgramBinaryCache::StoreMetadata( context.program_binary_cache_entry, SerializeReflectionData() );
+		}
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_regular )
+			UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_global )
+			UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_intrinsic )
+			UniformBlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+
+		last_write_time_map.emplace( vertex_source_path, std::filesystem::last_write_time( vertex_source_path ) );
+		if( not geometry_source_path.empty() )
+			last_write_time_map.emplace( geometry_source_path, std::filesystem::last_write_time( geometry_source_path ) );
+		last_write_time_map.emplace( fragment_source_path, std::filesystem::last_write_time( fragment_source_path ) );
+
+		/* Include files are tracked too, so that editing one recompiles exactly the Shaders that depend on it. */
+		for( const auto* include_path_array : { &vertex_source_include_path_array, &geometry_source_include_path_array, &fragment_source_include_path_array } )
+			for( const auto& include_path : *include_path_array )
+				last_write_time_map.emplace( include_path, std::filesystem::last_write_time( include_path ) );
+
+		return true;
+	}
+
+	std::optional< std::string > Shader::ParseShaderFromFile( const char* file_path, const ShaderType shader_type, CompilationContext& context )
+	{
+		const std::string error_prompt( std::string( "ERROR::SHADER::" ) + ShaderTypeString( shader_type ) + "::FILE_NOT_SUCCESSFULLY_READ\n\tShader name: " + name + "\n" );
+
+		if( const auto source = Engine::Utility::ReadFileIntoString( file_path, error_prompt.c_str() );
+			source )
+			return *source;
+
+		context.preprocessing_errors.push_back( error_prompt );
+
+		return std::nullopt;
+	}
+
+	std::optional< std::filesystem::path > Shader::FindSPIRVProgram() const
+	{
+		/* Has to match PostBuild_CompileShadersToSPIRV.py: <vertex stage file name>+[<geometry stage file name>+]<fragment stage file name>[.<feature>...]/,
+		 * with the program's Features sorted. The stages are linked together there, so the modules of a program are only usable together.
+		 * Modules are only built for value-less Features; A Feature with a value means compiling from GLSL. */
+		std::vector< std::string > program_features_to_set;
+		for( const auto& feature : features_requested )
+		{
+			const auto feature_name = feature.substr( 0, feature.find( ' ' ) );
+			if( not feature_map.contains( feature_name ) )
+				continue;
+
+			if( feature_name.size() != feature.size() )
+				return std::nullopt;
+
+			program_features_to_set.push_back( feature_name );
+		}
+
+		std::sort( program_features_to_set.begin(), program_features_to_set.end() );
+
+		const std::filesystem::path vertex_path( vertex_source_path );
+
+		std::string module_directory_name( vertex_path.filename().string() + '+' );
+		if( not geometry_source_path.empty() )
+			module_directory_name += std::filesystem::path( geometry_source_path ).filename().string() + '+';
+		module_directory_name += std::filesystem::path( fragment_source_path ).filename().string();
+		for( const auto& feature_name : program_features_to_set )
+			module_directory_name += "." + feature_name;
+
+		const auto module_directory_path( vertex_path.parent_path() / "SPIR-V" / module_directory_name );
+
+		/* The modules older than any of the files they are compiled from are stale (i.e., sources are edited after the build). */
+		std::error_code error_code;
+		std::filesystem::file_time_type oldest_module_time = std::filesystem::file_time_type::max();
+		for( const char* module_file_name : { "vert.spv", "geom.spv", "frag.spv" } )
+		{
+			if( module_file_name == std::string_view( "geom.spv" ) && geometry_source_path.empty() )
+				continue;
+
+			oldest_module_time = std::min( oldest_module_time, std::filesystem::last_write_time( module_directory_path / module_file_name, error_code ) );
+			if( error_code )
+				return std::nullopt;
+		}
+
+		for( const auto* source_paths : { &vertex_source_include_path_array, &geometry_source_include_path_array, &fragment_source_include_path_array } )
+			for( const auto& source_path : *source_paths )
+				if( std::filesystem::last_write_time( source_path, error_code ) > oldest_module_time || error_code )
+					return std::nullopt;
+
+		for( const auto* source_path : { &vertex_source_path, &geometry_source_path, &fragment_source_path } )
+			if( not source_path->empty() &&
+				( std::filesystem::last_write_time( *source_path, error_code ) > oldest_module_time || error_code ) )
+				return std::nullopt;
+
+		return module_directory_path;
+	}
+
+	std::optional< std::vector< std::byte > > Shader::ReadSPIRVModule( const std::filesystem::path& module_path )
+	{
+		std::error_code error_code;
+		std::vector< std::byte > module( std::filesystem::file_size( module_path, error_code ) );
+		if( error_code || module.empty() )
+			return std::nullopt;
+
+		std::ifstream file( module_path, std::ios::binary );
+		if( not file.read( reinterpret_cast< char* >( module.data() ), module.size() ) )
+			return std::nullopt;
+
+		return module;
+	}
+
+	void Shader::PreprocessShaderStage_StripDefinesToBeSet( std::string& shader_source_to_modify, const std::vector< ShaderSourceScanner::Define >& defines,
+															const std::vector< std::string >& features_to_set )
+	{
+		std::string stripped_shader_source;
+		std::size_t last_copied_pos = 0;
+
+		for( const auto& define : defines )
+		{
+			if( std::find_if( features_to_set.begin(), features_to_set.end(), [ & ]( const std::string& feature )
+				{ return feature.find( define.name ) != std::string::npos; } ) != features_to_set.end() )
+			{
+				stripped_shader_source.append( shader_source_to_modify, last_copied_pos, define.begin - last_copied_pos );
+				last_copied_pos = define.end;
+			}
+		}
+
+		if( last_copied_pos != 0 )
+		{
+			stripped_shader_source.append( shader_source_to_modify, last_copied_pos );
+			shader_source_to_modify = std::move( stripped_shader_source );
+		}
+	}
+
+	std::unordered_map< std::string, Shader::Feature > Shader::PreProcessShaderStage_ParseFeatures( const ShaderSourceScanner::Result& directives )
+	{
+		std::unordered_map< std::string, Feature > features;
+
+		/* Declarations via "#pragma feature <feature_name>" syntax: */
+		for( const auto& feature_name : directives.feature_declarations )
+			features.try_emplace( std::string( feature_name ), std::nullopt, false );
+
+		/* Definitions via "#define <feature_name> <optional_value>" syntax: */
+		for( const auto& define : directives.defines )
+		{
+			if( define.value )
+				features.try_emplace( std::string( define.name ), std::string( *define.value ), true );
+			else
+				features.try_emplace( std::string( define.name ), std::nullopt, true );
 		}
 
 		return features;
 	}
 
 	void Shader::PreProcessShaderStage_SetFeatures( std::string& shader_source_to_modify,
+													const ShaderSourceScanner::Result& directives,
 													std::unordered_map< std::string, Feature >& defined_features,
 													const std::vector< std::string >& features_to_set )
 	{
@@ -535,7 +873,7 @@ namespace Engine
 		/* Remove all #defines THAT ARE SET by the client code from the shader, so that we can add the modified versions all in one go later.
 		 * This saves us from the work of finding/replacing lines of #defines individually.
 		 * We also do not remove the #define lines of macros & Features that are NOT SET by the client code. */
-		PreprocessShaderStage_StripDefinesToBeSet( shader_source_to_modify, features_to_set );
+		PreprocessShaderStage_StripDefinesToBeSet( shader_source_to_modify, directives.defines, features_to_set );
 
 		std::string define_directives_combined;
 		for( const auto& feature_definition : features_to_set )
@@ -566,69 +904,16 @@ namespace Engine
 			shader_source_to_modify = shader_source_to_modify.substr( 0, first_new_line + 1 ) + define_directives_combined + shader_source_to_modify.substr( first_new_line + 1 );
 	}
 
-	bool Shader::PreProcessShaderStage_IncludeDirectives( const std::filesystem::path& shader_source_path, std::string& shader_source_to_modify, const ShaderType shader_type )
+	bool Shader::PreProcessShaderStage_IncludeDirectives( const std::filesystem::path& shader_source_path, std::string& shader_source_to_modify,
+														  std::vector< std::string >& include_paths, const ShaderType shader_type, CompilationContext& context )
 	{
-		static char error_string[ 256 ];
+		std::string error_string;
 
-		const std::string shader_file_name( shader_source_path.filename().string() );
-		const std::filesystem::path directory_path( shader_source_path.parent_path() );
-
-		std::unique_ptr< char* > preprocessed_source = std::make_unique< char* >( stb_include_string( shader_source_to_modify.data(),
-																									  nullptr,
-																									  const_cast< char* >( directory_path.string().c_str() ),
-																									  const_cast< char* >( shader_file_name.c_str() ),
-																									  error_string ) );
-		if( not *preprocessed_source )
+		if( not ShaderIncludeCache::Expand( shader_source_to_modify, shader_source_path.parent_path(), include_paths, error_string ) )
 		{
 			const std::string error_prompt( std::string( "ERROR::SHADER::" ) + ShaderTypeString( shader_type ) + "::INCLUDE_FILE_NOT_SUCCESSFULLY_READ\n\tShader name: " + name + "\n\t" 
 											+ error_string );
-			LogErrors( error_prompt );
-			return false;
-		}
-
-		shader_source_to_modify = *preprocessed_source;
-		return true;
-	}
-
-	bool Shader::CompileShader( const char* source, unsigned int& shader_id, const ShaderType shader_type )
-	{
-		shader_id = glCreateShader( ShaderTypeID( shader_type ) );
-		glShaderSource( shader_id, /* how many strings: */ 1, &source, NULL );
-		glCompileShader( shader_id );
-
-		int success = false;
-		glGetShaderiv( shader_id, GL_COMPILE_STATUS, &success );
-		if( !success )
-		{
-			LogErrors_Compilation( shader_id, shader_type );
-			return false;
-		}
-
-		return true;
-	}
-
-	bool Shader::LinkProgram( const unsigned int vertex_shader_id, const unsigned int fragment_shader_id )
-	{
-		return LinkProgram( vertex_shader_id, 0, fragment_shader_id );
-	}
-
-
-	bool Shader::LinkProgram( const unsigned int vertex_shader_id, const unsigned int geometry_shader_id, const unsigned int fragment_shader_id )
-	{
-		program_id = ID( glCreateProgram() );
-
-		glAttachShader( program_id.Get(), vertex_shader_id );
-		if( geometry_shader_id > 0 )
-			glAttachShader( program_id.Get(), geometry_shader_id );
-		glAttachShader( program_id.Get(), fragment_shader_id );
-
-		glLinkProgram( program_id.Get() );
-
-		int success;
-		glGetProgramiv( program_id.Get(), GL_LINK_STATUS, &success );
-		if( !success )
-		{
-			LogErrors_Linking();
+			context.preprocessing_errors.push_back( error_prompt );
 			return false;
 		}
 
@@ -774,7 +1059,7 @@ namespace Engine
 		while( current_pos != std::string::npos && current_pos != 0 );
 	}
 
-	void Shader::ParseShaderSource_VertexLayout( std::string shader_source )
+	void Shader::ParseShaderSource_VertexLayout( const std::string_view shader_source )
 	{
 		/* Example:
 			...
@@ -783,36 +1068,238 @@ namespace Engine
 			...
 		*/
 
-		/*												  location			   type	   name			*/
-		std::regex pattern( R"(layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*in\s+(\w+)\s+(\w+)\s*;)" );
-		std::smatch matches;
-
 		std::vector< VertexAttribute > attributes;
 
-		while( std::regex_search( shader_source, matches, pattern ) )
+		for( const auto& vertex_input : ShaderSourceScanner::Scan( shader_source ).vertex_inputs )
 		{
-			const std::string location_string( matches[ 1 ] );
-			const std::string location_type( matches[ 2 ] );
-			const std::string location_name( matches[ 3 ] );
+			const GLenum type( GL::Type::TypeOf( std::string( vertex_input.type ).c_str() ) );
+			/* Source attributes */
+			attributes.emplace_back( GL::Type::CountOf( type ), GL::Type::ComponentTypeOf( type ), false /* => instance info does not matter. */,
+									 vertex_input.location );
+		}
 
-			if( location_string.length() != 0 && matches[ 1 ].matched && 
-				  location_type.length() != 0 && matches[ 2 ].matched &&
-				  location_name.length() != 0 && matches[ 3 ].matched )
+		if( not attributes.empty() )
+		{
+			std::sort( attributes.begin(), attributes.end(), []( const VertexAttribute& left, const VertexAttribute& right ) { return left.location < right.location; } );
+			vertex_layout_source = VertexLayout( attributes );
+		}
+	}
+
+	void Shader::QueryReflectionData( const CompilationContext& context )
+	{
+		QueryVertexAttributes();
+
+		GetUniformBookKeepingInfo();
+		if( uniform_book_keeping_info.count == 0 )
+			return;
+
+		QueryUniformData();
+
+		ParseShaderSource_VertexLayout( *context.vertex_shader_source );
+		ParseShaderSource_UniformUsageHints( *context.vertex_shader_source, ShaderType::Vertex );
+		if( context.geometry_shader_source )
+			ParseShaderSource_UniformUsageHints( *context.geometry_shader_source, ShaderType::Geometry );
+		ParseShaderSource_UniformUsageHints( *context.fragment_shader_source, ShaderType::Fragment );
+
+		QueryUniformData_BlockIndexAndOffsetForBufferMembers();
+		QueryUniformBufferData( uniform_buffer_info_map_regular, Uniform::BufferCategory::Regular );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_regular );
+		QueryUniformBufferData( uniform_buffer_info_map_global, Uniform::BufferCategory::Global );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_global );
+		QueryUniformBufferData( uniform_buffer_info_map_intrinsic, Uniform::BufferCategory::Intrinsic );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_intrinsic );
+
+		CalculateTotalUniformSizes();
+		EnumerateUniformBufferCategories();
+	}
+
+	std::vector< std::byte > Shader::SerializeReflectionData() const
+	{
+		Serialization::Writer writer;
+
+		writer.Write( REFLECTION_DATA_FORMAT_VERSION );
+
+		for( const auto* vertex_layout : { &vertex_layout_active, &vertex_layout_source } )
+		{
+			writer.Write( vertex_layout->Count() );
+			for( const auto& attribute : vertex_layout->Attributes() )
+				writer.Write( attribute.count ).Write( attribute.type ).Write( attribute.is_instanced ).Write( attribute.location );
+		}
+
+		writer.Write( uniform_book_keeping_info.count ).Write( uniform_book_keeping_info.name_max_length );
+
+		writer.Write( ( std::uint32_t )uniform_info_map.size() );
+		for( const auto& [ uniform_name, uniform_info ] : uniform_info_map )
+		{
+			writer.WriteString( uniform_name )
+				  .Write( uniform_info.location_or_block_index )
+				  .Write( uniform_info.size )
+				  .Write( uniform_info.offset )
+				  .Write( uniform_info.count_array )
+				  .Write( uniform_info.type )
+				  .Write( uniform_info.is_buffer_member )
+				  .WriteString( uniform_info.editor_name )
+				  .Write( uniform_info.usage_hint )
+				  .Write( uniform_info.usage_hint_array_dimensions );
+		}
+
+		/* Aggregates (structs & arrays) are not stored; They are derived from the members on load, without touching GL. */
+		for( const auto* uniform_buffer_info_map : { &uniform_buffer_info_map_regular, &uniform_buffer_info_map_global, &uniform_buffer_info_map_intrinsic } )
+		{
+			writer.Write( ( std::uint32_t )uniform_buffer_info_map->size() );
+			for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : *uniform_buffer_info_map )
 			{
-				const GLenum type( GL::Type::TypeOf( location_type.c_str() ) );
-				/* Source attributes */
-				attributes.emplace_back( GL::Type::CountOf( type ), GL::Type::ComponentTypeOf( type ), false /* => instance info does not matter. */,
-										( unsigned int )std::stoi( location_string ) );
+				writer.WriteString( uniform_buffer_name )
+					  .Write( uniform_buffer_info.size )
+					  .Write( uniform_buffer_info.offset )
+					  .Write( ( std::uint32_t )uniform_buffer_info.members_map.size() );
+
+				for( const auto& [ member_name, member_info ] : uniform_buffer_info.members_map )
+					writer.WriteString( member_name );
 			}
+		}
+
+		return writer.Metadata();
+	}
+
+	bool Shader::DeserializeReflectionData( const std::vector< std::byte >& metadata )
+	{
+		Serialization::Reader reader( metadata );
+
+		const auto ReadVertexLayout = [ & ]( VertexLayout& vertex_layout )
+		{
+			unsigned int attribute_count;
+			if( not reader.Read( attribute_count ) )
+				return false;
+
+			std::vector< VertexAttribute > attributes( attribute_count );
+			for( auto& attribute : attributes )
+				if( not ( reader.Read( attribute.count ) && reader.Read( attribute.type ) && reader.Read( attribute.is_instanced ) && reader.Read( attribute.location ) ) )
+					return false;
+
+			vertex_layout = VertexLayout( attributes );
+			return true;
+		};
+
+		const auto ReadUniforms = [ & ]()
+		{
+			std::uint32_t uniform_count;
+			if( not reader.Read( uniform_count ) )
+				return false;
+
+			for( std::uint32_t index = 0; index < uniform_count; index++ )
+			{
+				std::string uniform_name;
+				Uniform::Information uniform_info;
+				if( not ( reader.ReadString( uniform_name ) &&
+						  reader.Read( uniform_info.location_or_block_index ) &&
+						  reader.Read( uniform_info.size ) &&
+						  reader.Read( uniform_info.offset ) &&
+						  reader.Read( uniform_info.count_array ) &&
+						  reader.Read( uniform_info.type ) &&
+						  reader.Read( uniform_info.is_buffer_member ) &&
+						  reader.ReadString( uniform_info.editor_name ) &&
+						  reader.Read( uniform_info.usage_hint ) &&
+						  reader.Read( uniform_info.usage_hint_array_dimensions ) ) )
+					return false;
 
-			shader_source = matches.suffix();
+				uniform_info_map.emplace( std::move( uniform_name ), std::move( uniform_info ) );
+			}
+
+			return true;
+		};
+
+		const auto ReadUniformBuffers = [ & ]( std::unordered_map< std::string, Uniform::BufferInformation >& uniform_buffer_info_map, const Uniform::BufferCategory category )
+		{
+			std::uint32_t uniform_buffer_count;
+			if( not reader.Read( uniform_buffer_count ) )
+				return false;
+
+			for( std::uint32_t index = 0; index < uniform_buffer_count; index++ )
+			{
+				std::string uniform_buffer_name;
+				Uniform::BufferInformation uniform_buffer_info
+				{
+					.binding_point = -1, // This will be filled later via BufferManager::ConnectBufferToBlock().
+					.category      = category
+				};
+				std::uint32_t member_count;
+				if( not ( reader.ReadString( uniform_buffer_name ) && reader.Read( uniform_buffer_info.size ) && reader.Read( uniform_buffer_info.offset ) && reader.Read( member_count ) ) )
+					return false;
+
+				for( std::uint32_t member_index = 0; member_index < member_count; member_index++ )
+				{
+					std::string member_name;
+					if( not reader.ReadString( member_name ) )
+						return false;
+
+					const auto iterator = uniform_info_map.find( member_name );
+					if( iterator == uniform_info_map.end() )
+						return false;
+
+					uniform_buffer_info.members_map.emplace( std::move( member_name ), &iterator->second );
+				}
+
+				uniform_buffer_info_map.emplace( std::move( uniform_buffer_name ), std::move( uniform_buffer_info ) );
+			}
+
+			return true;
+		};
+
+		std::uint32_t format_version;
+		if( not ( reader.Read( format_version ) && format_version == REFLECTION_DATA_FORMAT_VERSION &&
+				  ReadVertexLayout( vertex_layout_active ) &&
+				  ReadVertexLayout( vertex_layout_source ) &&
+				  reader.Read( uniform_book_keeping_info.count ) &&
+				  reader.Read( uniform_book_keeping_info.name_max_length ) &&
+				  ReadUniforms() &&
+				  ReadUniformBuffers( uniform_buffer_info_map_regular,	 Uniform::BufferCategory::Regular	) &&
+				  ReadUniformBuffers( uniform_buffer_info_map_global,	 Uniform::BufferCategory::Global	) &&
+				  ReadUniformBuffers( uniform_buffer_info_map_intrinsic, Uniform::BufferCategory::Intrinsic ) &&
+				  reader.IsAtEnd() ) )
+		{
+			vertex_layout_active = vertex_layout_source = VertexLayout();
+			uniform_book_keeping_info = {};
+			uniform_info_map.clear();
+			uniform_buffer_info_map_regular.clear();
+			uniform_buffer_info_map_global.clear();
+			uniform_buffer_info_map_intrinsic.clear();
+			return false;
 		}
 
-		if( not attributes.empty() )
+		uniform_book_keeping_info.name_holder = std::string( uniform_book_keeping_info.name_max_length, '?' );
+
+		/* Same steps as in QueryReflectionData(); None of these touch GL. */
+		if( uniform_book_keeping_info.count == 0 )
+			return true;
+
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_regular );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_global );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_intrinsic );
+
+		CalculateTotalUniformSizes();
+		EnumerateUniformBufferCategories();
+
+		return true;
+	}
+
+	bool Shader::ProgramHasResourceNames() const
+	{
+		for( const GLenum program_interface : { GL_UNIFORM, GL_PROGRAM_INPUT } )
 		{
-			std::sort( attributes.begin(), attributes.end(), []( const VertexAttribute& left, const VertexAttribute& right ) { return left.location < right.location; } );
-			vertex_layout_source = VertexLayout( attributes );
+			int resource_count = 0;
+			glGetProgramInterfaceiv( program_id.Get(), program_interface, GL_ACTIVE_RESOURCES, &resource_count );
+			if( resource_count == 0 )
+				continue;
+
+			char resource_name[ 2 ];
+			int length = 0;
+			glGetProgramResourceName( program_id.Get(), program_interface, 0, sizeof( resource_name ), &length, resource_name );
+			if( length == 0 )
+				return false;
 		}
+
+		return true;
 	}
 
 	void Shader::QueryVertexAttributes()
@@ -1208,6 +1695,15 @@ namespace Engine
 		throw std::logic_error( error_string );
 	}
 
+	void Shader::LogErrors_Preprocessing( const CompilationContext& context ) const
+	{
+		std::string complete_error_string;
+		for( const auto& error_string : context.preprocessing_errors )
+			complete_error_string += error_string + "\n";
+
+		LogErrors( complete_error_string );
+	}
+
 	void Shader::LogErrors_Compilation( const int shader_id, const ShaderType shader_type ) const
 	{
 		char info_log[ 512 ];
@@ -5,7 +5,9 @@
 #include "Color.hpp"
 #include "Id.hpp"
 #include "Lighting/Lighting.h"
+#include "ProgramBinaryCache.h"
 #include "ShaderSourcePath.hpp"
+#include "ShaderSourceScanner.h"
 #include "Std140StructTag.h"
 #include "Uniform.h"
 #include "VertexLayout.hpp"
@@ -18,6 +20,7 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -27,11 +30,13 @@ namespace Engine
 	/* Forward Declarations: */
 	class Renderer;
 	class InternalShaders;
+	class ShaderVariantCache;
 
 	class Shader
 	{
 		friend class Renderer;
 		friend class InternalShaders;
+		friend class ShaderVariantCache;
 		friend class std::unordered_map< std::string, Shader >;
 
 		using ReferenceCount = unsigned int;
@@ -86,13 +91,32 @@ namespace Engine
 					   const FragmentShaderSourcePath& fragment_shader_source_path,
 					   const Features& features_to_set = {} );
 
+		/* Parameters of a single FromFile() call. Paths are owned, as ShaderSourcePaths do not own theirs. */
+		struct FromFileParameters
+		{
+			Shader* shader;
+			std::string vertex_source_path;
+			std::string geometry_source_path; // Empty if there is no geometry stage.
+			std::string fragment_source_path;
+			Features features_to_set;
+		};
+
+		/* Equivalent to calling FromFile() on each, but preprocesses all shaders in parallel & submits every compile/link to the driver before waiting on any of them.
+		 * With GL_KHR_parallel_shader_compile, the driver compiles them concurrently as well.
+		 * Returns true only if all shaders succeeded. */
+		static bool FromFile_Batch( const std::vector< FromFileParameters >& batch );
 
 		bool RecompileFromThis( Shader& new_shader );
 
+		/* Compiles a Shader whose compilation was deferred (see ShaderVariantCache) or whose program was evicted, from its recorded sources & Features.
+		 * No-op if the Shader is compiled already. */
+		bool CompileIfNeeded();
+
 /* Queries: */
 
 		inline		 ID								Id()							const { return program_id;							}
 		inline const std::string&					Name()							const { return name;								}
+		inline bool									IsCompiled()					const { return IsValid();							}
 		inline bool									HasGeometryStage()				const { return not geometry_source_path.empty();	}
 		inline const std::string&					VertexSourcePath()				const { return vertex_source_path;					}
 		inline const std::string&					GeometrySourcePath()			const { return geometry_source_path;				}
@@ -107,6 +131,8 @@ namespace Engine
 		inline const VertexLayout& GetActiveVertexLayout()	const { return vertex_layout_active; }
 
 		bool SourceFilesAreModified();
+		/* Whether the file is one of the source or (possibly nested) include files. */
+		bool DependsOn( const std::filesystem::path& file_path ) const;
 
 /* Uniform APIs: */
 
@@ -509,30 +535,85 @@ namespace Engine
 
 		void Delete();
 
+		/* Only records the sources & Features; Compilation happens on CompileIfNeeded(). */
+		void Defer( const std::string& vertex_shader_source_path,
+					const std::string& geometry_shader_source_path,
+					const std::string& fragment_shader_source_path,
+					const Features& features_to_set );
+
 /* Queries: */
 
 		inline bool IsValid() const { return program_id.IsValid(); }
 
 /* Compilation & Linkage: */
 
-		std::optional< std::string > ParseShaderFromFile( const char* file_path, const ShaderType shader_type );
-		std::vector< std::string > PreprocessShaderStage_GetIncludeFilePaths( std::string shader_source ) const;
-		void PreprocessShaderStage_StripDefinesToBeSet( std::string& shader_source_to_modify, const std::vector< std::string >& features_to_set );
-		std::unordered_map< std::string, Feature > PreProcessShaderStage_ParseFeatures( std::string shader_source );
+		/* State carried between the compilation phases below. */
+		struct CompilationContext
+		{
+			std::optional< std::string > vertex_shader_source;
+			std::optional< std::string > geometry_shader_source;
+			std::optional< std::string > fragment_shader_source;
+
+			unsigned int vertex_shader_id   = 0;
+			unsigned int geometry_shader_id = 0;
+			unsigned int fragment_shader_id = 0;
+
+			/* Offline-compiled modules (see PostBuild_CompileShadersToSPIRV.py); Either every stage has one or none is used. */
+			std::optional< std::vector< std::byte > > vertex_spirv_module;
+			std::optional< std::vector< std::byte > > geometry_spirv_module;
+			std::optional< std::vector< std::byte > > fragment_spirv_module;
+
+			ProgramBinaryCache::Entry program_binary_cache_entry;
+			bool is_loaded_from_program_binary_cache = false;
+			bool is_compiled_from_spirv = false;
+
+			/* Preprocess() may run on worker threads, where the GLLogger can not be used; Its errors are collected here & reported by LogErrors_Preprocessing(). */
+			std::vector< std::string > preprocessing_errors;
+		};
+
+		/* Reads & preprocesses the sources. Touches no GL state, hence can be called from worker threads. */
+		bool Preprocess( const VertexShaderSourcePath& vertex_shader_source_path,
+						 const GeometryShaderSourcePath& geometry_shader_source_path,
+						 const FragmentShaderSourcePath& fragment_shader_source_path,
+						 const Features& features_to_set,
+						 CompilationContext& context );
+		/* Either loads the program from the ProgramBinaryCache or issues the compile & link commands, without waiting for the driver to finish them. */
+		void SubmitCompilation( CompilationContext& context );
+		/* Never blocks. Always returns true without GL_KHR_parallel_shader_compile. */
+		bool IsCompilationComplete() const;
+		/* Blocks until linking is complete, reports errors & queries the reflection data (or loads it from the ProgramBinaryCache, along with the program). */
+		bool CompleteCompilation( CompilationContext& context );
+
+		std::optional< std::string > ParseShaderFromFile( const char* file_path, const ShaderType shader_type, CompilationContext& context );
+		/* Returns the directory of the program's modules for the requested Features, if there is one & they are newer than all the source & include files. */
+		std::optional< std::filesystem::path > FindSPIRVProgram() const;
+		static std::optional< std::vector< std::byte > > ReadSPIRVModule( const std::filesystem::path& module_path );
+		void PreprocessShaderStage_StripDefinesToBeSet( std::string& shader_source_to_modify, const std::vector< ShaderSourceScanner::Define >& defines,
+														const std::vector< std::string >& features_to_set );
+		std::unordered_map< std::string, Feature > PreProcessShaderStage_ParseFeatures( const ShaderSourceScanner::Result& directives );
 		void PreProcessShaderStage_SetFeatures( std::string& shader_source_to_modify,
+												const ShaderSourceScanner::Result& directives,
 												std::unordered_map< std::string, Feature >& defined_features,
 												const std::vector< std::string >& features_to_set );
-		bool PreProcessShaderStage_IncludeDirectives( const std::filesystem::path& shader_source_path, std::string& shader_source_to_modify, const ShaderType shader_type );
-		bool CompileShader( const char* source, unsigned int& shader_id, const ShaderType shader_type );
-		bool LinkProgram( const unsigned int vertex_shader_id, const unsigned int fragment_shader_id );
-		bool LinkProgram( const unsigned int vertex_shader_id, const unsigned int geometry_shader_id, const unsigned int fragment_shader_id );
+		/* Appends the paths of the included files to include_paths. */
+		bool PreProcessShaderStage_IncludeDirectives( const std::filesystem::path& shader_source_path, std::string& shader_source_to_modify,
+													  std::vector< std::string >& include_paths, const ShaderType shader_type, CompilationContext& context );
 
 		/*std::string ShaderSource_CommentsStripped( const std::string& shader_source );*/
 		void ParseShaderSource_UniformUsageHints( const std::string& shader_source, const ShaderType shader_type );
-		void ParseShaderSource_VertexLayout( std::string shader_source );
+		void ParseShaderSource_VertexLayout( const std::string_view shader_source );
 
 /* Shader Introspection: */
 
+		/* Queries the linked program & parses the preprocessed sources. */
+		void QueryReflectionData( const CompilationContext& context );
+		/* Everything QueryReflectionData() produces, in a form that survives the process; Pointers between the maps are stored as names. */
+		std::vector< std::byte > SerializeReflectionData() const;
+		/* Leaves the reflection data empty & returns false if the metadata is malformed. */
+		bool DeserializeReflectionData( const std::vector< std::byte >& metadata );
+
+		/* Reflection is name-based, but drivers are not required to keep names for programs created from SPIR-V. */
+		bool ProgramHasResourceNames() const;
 		void QueryVertexAttributes();
 
 		void GetUniformBookKeepingInfo();
@@ -552,6 +633,8 @@ namespace Engine
 /* Error Checking/Reporting: */
 
 		void LogErrors( const std::string& error_string ) const;
+		/* Has to be called on the GL thread. */
+		void LogErrors_Preprocessing( const CompilationContext& context ) const;
 		void LogErrors_Compilation( const int shader_id, const ShaderType shader_type ) const;
 		void LogErrors_Linking() const;
 		std::string FormatErrorLog( const char* log ) const;
@@ -0,0 +1,276 @@
+// Engine Includes.
+#include "ShaderIncludeCache.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace Engine::ShaderIncludeCache
+{
+	/* An #include "<file_name>" or #inject line. */
+	struct Directive
+	{
+		std::size_t begin;	// Offset of the line's start.
+		std::size_t end;	// Offset of the line's new-line (or the end of the text).
+		std::size_t file_name_begin;
+		std::size_t file_name_size;
+		int next_line;
+		bool is_inject;
+		// bool padding[ 3 ];
+	};
+
+	struct File
+	{
+		std::filesystem::file_time_type last_write_time;
+		std::string content;
+		std::vector< Directive > directives;
+	};
+
+	/* Pieces of the expanded source, in order. */
+	struct Expansion
+	{
+		std::vector< std::string_view > pieces;
+		std::deque< std::array< char, 24 > > line_directives;		// Storage for the #line directives among the pieces.
+		std::vector< std::shared_ptr< const File > > files_in_use;	// Keeps the included contents alive, even if their cache entries get replaced meanwhile.
+		std::size_t size = 0;
+	};
+
+	constexpr int MAX_INCLUDE_DEPTH = 32;
+
+	static std::shared_mutex file_map_mutex;
+	static std::unordered_map< std::string, std::shared_ptr< const File > > file_map;	// Keyed by canonical path.
+	static std::unordered_map< std::string, std::string > canonical_path_map;			// Resolved include path -> canonical path; Saves resolving the path on every look-up.
+
+	static std::atomic< unsigned int > hit_count  = 0;
+	static std::atomic< unsigned int > miss_count = 0;
+
+	/* Same rules as stb_include_find_includes(): Directives have to start their lines (after blanks) & #include needs a quoted file name. */
+	static std::vector< Directive > FindDirectives( const std::string_view text )
+	{
+		std::vector< Directive > directives;
+
+		const auto SkipBlanks = [ & ]( std::size_t offset )
+		{
+			while( offset < text.size() && ( text[ offset ] == ' ' || text[ offset ] == '\t' ) )
+				offset++;
+			return offset;
+		};
+		const auto SkipToNewLine = [ & ]( std::size_t offset )
+		{
+			while( offset < text.size() && text[ offset ] != '\r' && text[ offset ] != '\n' )
+				offset++;
+			return offset;
+		};
+		const auto IsSpace = [ & ]( const std::size_t offset )
+		{
+			return offset < text.size() && ( text[ offset ] == ' ' || text[ offset ] == '\t' || text[ offset ] == '\r' || text[ offset ] == '\n' );
+		};
+
+		int line_count = 1;
+		for( std::size_t current_pos = 0; current_pos < text.size(); line_count++ )
+		{
+			const auto line_begin = current_pos;
+
+			current_pos = SkipBlanks( current_pos );
+			if( current_pos < text.size() && text[ current_pos ] == '#' )
+			{
+				current_pos = SkipBlanks( current_pos + 1 );
+
+				if( text.substr( current_pos ).starts_with( "include" ) && IsSpace( current_pos + 7 ) )
+				{
+					current_pos = SkipBlanks( current_pos + 7 /* to get past "include" */ );
+					if( current_pos < text.size() && text[ current_pos ] == '"' )
+					{
+						const auto file_name_begin = current_pos + 1;
+						const auto file_name_end   = text.find_first_of( "\"\r\n", file_name_begin );
+						if( file_name_end != std::string_view::npos && text[ file_name_end ] == '"' )
+						{
+							current_pos = SkipToNewLine( file_name_end );
+							directives.push_back( { line_begin, current_pos, file_name_begin, file_name_end - file_name_begin, line_count + 1, false } );
+						}
+					}
+				}
+				else if( text.substr( current_pos ).starts_with( "inject" ) && ( IsSpace( current_pos + 6 ) || current_pos + 6 == text.size() ) )
+				{
+					current_pos = SkipToNewLine( current_pos );
+					directives.push_back( { line_begin, current_pos, 0, 0, line_count + 1, true } );
+				}
+			}
+
+			current_pos = SkipToNewLine( current_pos );
+
+			/* Either of "\r\n" & "\n\r" count as a single new-line. */
+			if( current_pos < text.size() )
+				current_pos += current_pos + 1 < text.size() && text[ current_pos ] + text[ current_pos + 1 ] == '\r' + '\n' ? 2 : 1;
+		}
+
+		return directives;
+	}
+
+	/* Same as stb_include_itoa(): Right-aligned into 7 characters, followed by a space. */
+	static void WriteNumber( char* destination, int number )
+	{
+		std::fill_n( destination, 8, ' ' );
+		for( int i = 1; i < 8; i++ )
+		{
+			destination[ 7 - i ] = char( '0' + number % 10 );
+			if( ( number /= 10 ) == 0 )
+				break;
+		}
+	}
+
+	static std::shared_ptr< const File > Load( const std::string& file_path )
+	{
+		std::error_code error_code;
+
+		const auto last_write_time = std::filesystem::last_write_time( file_path, error_code );
+		if( error_code )
+			return nullptr;
+
+		{
+			std::shared_lock lock( file_map_mutex );
+
+			if( const auto canonical_path_iterator = canonical_path_map.find( file_path );
+				canonical_path_iterator != canonical_path_map.cend() )
+			{
+				if( const auto iterator = file_map.find( canonical_path_iterator->second );
+					iterator != file_map.cend() && iterator->second->last_write_time == last_write_time )
+				{
+					hit_count++;
+					return iterator->second;
+				}
+			}
+		}
+
+		const auto canonical_path = std::filesystem::canonical( file_path, error_code );
+		if( error_code || not std::filesystem::is_regular_file( canonical_path, error_code ) )
+			return nullptr;
+
+		std::ifstream stream( canonical_path, std::ios::binary );
+		if( not stream )
+			return nullptr;
+
+		auto file = std::make_shared< File >();
+		file->last_write_time = last_write_time;
+		file->content.assign( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+		file->directives = FindDirectives( file->content );
+
+		miss_count++;
+
+		std::unique_lock lock( file_map_mutex );
+
+		const auto& key = canonical_path_map[ file_path ] = canonical_path.string();
+		return file_map[ key ] = std::move( file );
+	}
+
+	static bool Gather( const std::string_view text, const std::vector< Directive >& directives, const std::string& include_directory,
+						Expansion& expansion, std::vector< std::string >& include_paths, std::string& error_string, const int depth )
+	{
+		if( depth > MAX_INCLUDE_DEPTH )
+		{
+			error_string = "Error: include depth exceeds " + std::to_string( MAX_INCLUDE_DEPTH ) + " (circular include?)";
+			return false;
+		}
+
+		const auto Append = [ &expansion ]( const std::string_view piece )
+		{
+			expansion.pieces.push_back( piece );
+			expansion.size += piece.size();
+		};
+
+		const auto size_at_start = expansion.size;
+		std::size_t last_pos     = 0;
+
+		for( int index = 0; index < ( int )directives.size(); index++ )
+		{
+			const auto& directive = directives[ index ];
+
+			Append( text.substr( last_pos, directive.begin - last_pos ) );
+
+			/* GLSL's #version has to come first, so no #line at the very top. */
+			if( expansion.size != size_at_start )
+			{
+				auto& line_directive = expansion.line_directives.emplace_back();
+				std::copy_n( "#line ", 6, line_directive.data() );
+				WriteNumber( line_directive.data() + 6, 1 );
+				line_directive[ 14 ] = ' ';
+				WriteNumber( line_directive.data() + 15, index + 1 );
+				line_directive[ 23 ] = '\n';
+				Append( std::string_view( line_directive.data(), 24 ) );
+			}
+
+			if( not directive.is_inject )
+			{
+				const std::string file_path( include_directory + '/' + std::string( text.substr( directive.file_name_begin, directive.file_name_size ) ) );
+
+				const auto file = Load( file_path );
+				if( not file )
+				{
+					error_string = "Error: couldn't load '" + file_path + "'";
+					return false;
+				}
+
+				expansion.files_in_use.push_back( file );
+
+				if( std::find( include_paths.cbegin(), include_paths.cend(), file_path ) == include_paths.cend() )
+					include_paths.push_back( file_path );
+
+				if( not Gather( file->content, file->directives, include_directory, expansion, include_paths, error_string, depth + 1 ) )
+					return false;
+			}
+
+			/* No trailing new-line, as the directive's own new-line follows. */
+			auto& line_directive = expansion.line_directives.emplace_back();
+			std::copy_n( "\n#line", 6, line_directive.data() );
+			WriteNumber( line_directive.data() + 6, directive.next_line );
+			line_directive[ 14 ] = ' ';
+			WriteNumber( line_directive.data() + 15, 0 );
+			Append( std::string_view( line_directive.data(), 23 ) );
+
+			last_pos = directive.end;
+		}
+
+		Append( text.substr( last_pos ) );
+
+		return true;
+	}
+
+	bool Expand( std::string& source, const std::filesystem::path& include_directory, std::vector< std::string >& include_paths, std::string& error_string )
+	{
+		const auto directives = FindDirectives( source );
+		if( directives.empty() )
+			return true;
+
+		Expansion expansion;
+		if( not Gather( source, directives, include_directory.string(), expansion, include_paths, error_string, 0 ) )
+			return false;
+
+		std::string expanded_source;
+		expanded_source.reserve( expansion.size );
+
+		for( const auto& piece : expansion.pieces )
+			expanded_source.append( piece );
+
+		source = std::move( expanded_source );
+
+		return true;
+	}
+
+	unsigned int HitCount()
+	{
+		return hit_count;
+	}
+
+	unsigned int MissCount()
+	{
+		return miss_count;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// std Includes.
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Engine::ShaderIncludeCache
+{
+	/* Process-wide cache of include files, keyed by canonical path & validated against the file's last write time on every look-up.
+	 * Each include file is read & scanned for directives once (per modification), no matter how many shaders/stages/variants include it.
+	 * Thread-safe, as shaders are preprocessed in parallel (see Shader::FromFile_Batch()). */
+
+	/* Replaces the lines of the form #include "<file_name>" (resolved relative to include_directory, recursively) with the contents of the files.
+	 * Output is identical to what stb_include_string() (with STB_INCLUDE_LINE_GLSL) produces, #line directives included; It is assembled by splicing views into
+	 * the source & cached include contents into a single allocation.
+	 * Appends the paths of all included files (nested ones too, without duplicates) to include_paths; These are the files the source depends on.
+	 * Returns false & fills error_string on failure, in which case the source is left untouched. */
+	bool Expand( std::string& source, const std::filesystem::path& include_directory, std::vector< std::string >& include_paths, std::string& error_string );
+
+	unsigned int HitCount();
+	unsigned int MissCount();
+}
@@ -0,0 +1,216 @@
+// Engine Includes.
+#include "ShaderSourceScanner.h"
+
+// std Includes.
+#include <charconv>
+
+namespace Engine::ShaderSourceScanner
+{
+	/* Same character set as std::regex's \s. */
+	static constexpr bool IsWhitespace( const char character )
+	{
+		return character == ' ' || character == '\t' || character == '\n' || character == '\v' || character == '\f' || character == '\r';
+	}
+
+	/* Same character set as std::regex's \w & [_[:alnum:]]. */
+	static constexpr bool IsWordCharacter( const char character )
+	{
+		return ( character >= 'a' && character <= 'z' ) || ( character >= 'A' && character <= 'Z' ) || ( character >= '0' && character <= '9' ) || character == '_';
+	}
+
+	static constexpr bool IsDigit( const char character )
+	{
+		return character >= '0' && character <= '9';
+	}
+
+	template< auto Predicate >
+	static std::size_t SkipWhile( const std::string_view source, std::size_t offset )
+	{
+		while( offset < source.size() && Predicate( source[ offset ] ) )
+			offset++;
+
+		return offset;
+	}
+
+	static std::size_t SkipWhitespace( const std::string_view source, const std::size_t offset )
+	{
+		return SkipWhile< IsWhitespace >( source, offset );
+	}
+
+	static std::size_t SkipNonWhitespace( const std::string_view source, const std::size_t offset )
+	{
+		return SkipWhile< []( const char character ) { return not IsWhitespace( character ); } >( source, offset );
+	}
+
+	static bool Expect( const std::string_view source, const std::size_t offset, const std::string_view token )
+	{
+		return source.substr( std::min( offset, source.size() ) ).starts_with( token );
+	}
+
+	/* #include\s+"\s*(\S+)\s*" */
+	static std::optional< std::size_t > TryMatch_Include( const std::string_view source, const std::size_t offset, Result& result )
+	{
+		const auto quote_begin = SkipWhitespace( source, offset + 8 /* to get past "#include" */ );
+		if( quote_begin == offset + 8 || not Expect( source, quote_begin, "\"" ) )
+			return std::nullopt;
+
+		const auto path_begin = SkipWhitespace( source, quote_begin + 1 );
+		const auto path_end   = SkipNonWhitespace( source, path_begin );
+		if( path_begin == path_end )
+			return std::nullopt;
+
+		/* (\S+) is greedy & may contain quotes itself: Prefer the closing quote after the token, then fall back to the last quote inside the token. */
+		if( const auto quote_end = SkipWhitespace( source, path_end );
+			Expect( source, quote_end, "\"" ) )
+		{
+			result.include_paths.push_back( source.substr( path_begin, path_end - path_begin ) );
+			return quote_end + 1;
+		}
+
+		if( const auto quote_end = source.substr( path_begin + 1, path_end - path_begin - 1 ).rfind( '"' );
+			quote_end != std::string_view::npos )
+		{
+			result.include_paths.push_back( source.substr( path_begin, quote_end + 1 ) );
+			return path_begin + 1 + quote_end + 1;
+		}
+
+		return std::nullopt;
+	}
+
+	/* #pragma\s+feature\s*(\S+) */
+	static std::optional< std::size_t > TryMatch_PragmaFeature( const std::string_view source, const std::size_t offset, Result& result )
+	{
+		const auto feature_token_begin = SkipWhitespace( source, offset + 7 /* to get past "#pragma" */ );
+		if( feature_token_begin == offset + 7 || not Expect( source, feature_token_begin, "feature" ) )
+			return std::nullopt;
+
+		const auto name_begin = SkipWhitespace( source, feature_token_begin + 7 /* to get past "feature" */ );
+		const auto name_end   = SkipNonWhitespace( source, name_begin );
+		if( name_begin == name_end )
+			return std::nullopt;
+
+		result.feature_declarations.push_back( source.substr( name_begin, name_end - name_begin ) );
+		return name_end;
+	}
+
+	/* #define\s+([_[:alnum:]]+)\s*(\S+)?\s*\r?\n */
+	static std::optional< std::size_t > TryMatch_Define( const std::string_view source, const std::size_t offset, Result& result )
+	{
+		const auto name_begin = SkipWhitespace( source, offset + 7 /* to get past "#define" */ );
+		const auto name_end   = SkipWhile< IsWordCharacter >( source, name_begin );
+		if( name_begin == offset + 7 || name_begin == name_end )
+			return std::nullopt;
+
+		const std::string_view name( source.substr( name_begin, name_end - name_begin ) );
+
+		/* The value may be on a following line, as long as it is the only token up to the next new-line. */
+		const auto value_begin = SkipWhitespace( source, name_end );
+		if( value_begin < source.size() )
+		{
+			const auto value_end           = SkipNonWhitespace( source, value_begin );
+			const auto trailing_whitespace = source.substr( value_end, SkipWhitespace( source, value_end ) - value_end );
+
+			if( const auto first_new_line = trailing_whitespace.find( '\n' );
+				first_new_line != std::string_view::npos )
+			{
+				result.defines.push_back( { name, source.substr( value_begin, value_end - value_begin ), offset, value_end + first_new_line + 1 } );
+				return value_end + trailing_whitespace.rfind( '\n' ) + 1;
+			}
+		}
+
+		if( const auto last_new_line = source.substr( name_end, value_begin - name_end ).rfind( '\n' );
+			last_new_line != std::string_view::npos )
+		{
+			result.defines.push_back( { name, std::nullopt, offset, name_end + last_new_line + 1 } );
+			return name_end + last_new_line + 1;
+		}
+
+		return std::nullopt;
+	}
+
+	/* layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*in\s+(\w+)\s+(\w+)\s*; */
+	static std::optional< std::size_t > TryMatch_VertexInput( const std::string_view source, const std::size_t offset, Result& result )
+	{
+		auto current_pos = SkipWhitespace( source, offset + 6 /* to get past "layout" */ );
+		if( not Expect( source, current_pos, "(" ) )
+			return std::nullopt;
+
+		current_pos = SkipWhitespace( source, current_pos + 1 );
+		if( not Expect( source, current_pos, "location" ) )
+			return std::nullopt;
+
+		current_pos = SkipWhitespace( source, current_pos + 8 /* to get past "location" */ );
+		if( not Expect( source, current_pos, "=" ) )
+			return std::nullopt;
+
+		const auto location_begin = SkipWhitespace( source, current_pos + 1 );
+		const auto location_end   = SkipWhile< IsDigit >( source, location_begin );
+		if( location_begin == location_end )
+			return std::nullopt;
+
+		current_pos = SkipWhitespace( source, location_end );
+		if( not Expect( source, current_pos, ")" ) )
+			return std::nullopt;
+
+		current_pos = SkipWhitespace( source, current_pos + 1 );
+		if( not Expect( source, current_pos, "in" ) )
+			return std::nullopt;
+
+		const auto type_begin = SkipWhitespace( source, current_pos + 2 /* to get past "in" */ );
+		const auto type_end   = SkipWhile< IsWordCharacter >( source, type_begin );
+		if( type_begin == current_pos + 2 || type_begin == type_end )
+			return std::nullopt;
+
+		const auto name_begin = SkipWhitespace( source, type_end );
+		const auto name_end   = SkipWhile< IsWordCharacter >( source, name_begin );
+		if( name_begin == type_end || name_begin == name_end )
+			return std::nullopt;
+
+		current_pos = SkipWhitespace( source, name_end );
+		if( not Expect( source, current_pos, ";" ) )
+			return std::nullopt;
+
+		unsigned int location = 0;
+		std::from_chars( source.data() + location_begin, source.data() + location_end, location );
+
+		result.vertex_inputs.push_back( { source.substr( type_begin, type_end - type_begin ), source.substr( name_begin, name_end - name_begin ), location } );
+		return current_pos + 1;
+	}
+
+	Result Scan( const std::string_view source )
+	{
+		Result result;
+
+		/* Each directive kind resumes after its own previous match, just like consecutive std::regex_search() calls on the match suffix would. */
+		std::size_t include_resume_pos = 0, pragma_resume_pos = 0, define_resume_pos = 0, layout_resume_pos = 0;
+
+		for( std::size_t current_pos = source.find_first_of( "#l" ); current_pos != std::string_view::npos; current_pos = source.find_first_of( "#l", current_pos + 1 ) )
+		{
+			if( source[ current_pos ] == '#' )
+			{
+				if( current_pos >= include_resume_pos && Expect( source, current_pos, "#include" ) )
+				{
+					if( const auto match_end = TryMatch_Include( source, current_pos, result ) )
+						include_resume_pos = *match_end;
+				}
+				else if( current_pos >= pragma_resume_pos && Expect( source, current_pos, "#pragma" ) )
+				{
+					if( const auto match_end = TryMatch_PragmaFeature( source, current_pos, result ) )
+						pragma_resume_pos = *match_end;
+				}
+				else if( current_pos >= define_resume_pos && Expect( source, current_pos, "#define" ) )
+				{
+					if( const auto match_end = TryMatch_Define( source, current_pos, result ) )
+						define_resume_pos = *match_end;
+				}
+			}
+			else if( current_pos >= layout_resume_pos && Expect( source, current_pos, "layout" ) )
+			{
+				if( const auto match_end = TryMatch_VertexInput( source, current_pos, result ) )
+					layout_resume_pos = *match_end;
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+// std Includes.
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Engine::ShaderSourceScanner
+{
+	/* Matches what Shader's preprocessing used to extract via std::regex, including the corner cases:
+	 * Directives are recognized anywhere in the source (comments too) & whitespace (new-lines included) between tokens is skipped freely. */
+
+	/* #define <name> <optional_value>
+	 * Name consists of alphanumeric characters & underscores only (which excludes macros with parameters, mostly) & the value is a single token.
+	 * The directive only counts if a new-line follows the name/value. */
+	struct Define
+	{
+		std::string_view name;
+		std::optional< std::string_view > value;
+		std::size_t begin; // Offset of the '#'.
+		std::size_t end;   // Offset right after the first new-line following the directive.
+	};
+
+	/* layout( location = <location> ) in <type> <name>; */
+	struct VertexInput
+	{
+		std::string_view type;
+		std::string_view name;
+		unsigned int location;
+	};
+
+	struct Result
+	{
+		std::vector< std::string_view > include_paths;			/* #include "<path>"			*/
+		std::vector< std::string_view > feature_declarations;	/* #pragma feature <name>	*/
+		std::vector< Define > defines;
+		std::vector< VertexInput > vertex_inputs;
+	};
+
+	/* Extracts all of the above in a single, linear pass over the source.
+	 * Resulting string views point into the source; It has to outlive the result. */
+	Result Scan( const std::string_view source );
+}
@@ -6,6 +6,7 @@
 #include "Math/Vector.hpp"
 
 // std Includes.
+#include <cstdint>
 #include <stdexcept>
 #include <unordered_map>
 #include <variant>
@@ -63,6 +64,15 @@ namespace Engine::GL::Type
 			case GL_BOOL_VEC3			: return sizeof( Vector3B );
 			case GL_BOOL_VEC4			: return sizeof( Vector4B );
 
+			/* Vertex attribute only: */
+			case GL_BYTE						: return sizeof( std::int8_t );
+			case GL_UNSIGNED_BYTE				: return sizeof( std::uint8_t );
+			case GL_SHORT						: return sizeof( std::int16_t );
+			case GL_UNSIGNED_SHORT				: return sizeof( std::uint16_t );
+			case GL_HALF_FLOAT					: return sizeof( std::uint16_t );
+			case GL_INT_2_10_10_10_REV			: return sizeof( std::uint32_t ); // For all 4 components together.
+			case GL_UNSIGNED_INT_2_10_10_10_REV	: return sizeof( std::uint32_t ); // For all 4 components together.
+
 			/* Float matrices: */
 			case GL_FLOAT_MAT2 			: return sizeof( Matrix2x2 );
 			case GL_FLOAT_MAT3 			: return sizeof( Matrix3x3 );
@@ -160,6 +170,15 @@ namespace Engine::GL::Type
 			case GL_BOOL_VEC3			: return 3;
 			case GL_BOOL_VEC4			: return 4;
 
+			/* Vertex attribute only: */
+			case GL_BYTE						: return 1;
+			case GL_UNSIGNED_BYTE				: return 1;
+			case GL_SHORT						: return 1;
+			case GL_UNSIGNED_SHORT				: return 1;
+			case GL_HALF_FLOAT					: return 1;
+			case GL_INT_2_10_10_10_REV			: return 1; // Packed; Treated as a single unit.
+			case GL_UNSIGNED_INT_2_10_10_10_REV	: return 1; // Packed; Treated as a single unit.
+
 			/* Float matrices: */
 			case GL_FLOAT_MAT2 			: return 4;
 			case GL_FLOAT_MAT3 			: return 9;
@@ -188,6 +207,12 @@ namespace Engine::GL::Type
 		throw std::runtime_error( "ERROR::SHADER_TYPE::CountOf() called with an unknown GL type!" );
 	}
 
+	/* Packed vertex attribute formats store all of their components in a single SizeOf() bytes. */
+	inline bool IsPacked( const GLenum type )
+	{
+		return type == GL_INT_2_10_10_10_REV || type == GL_UNSIGNED_INT_2_10_10_10_REV;
+	}
+
 	inline std::pair< int, int > RowAndColumnCountOf( const GLenum type )
 	{
 		switch( type )
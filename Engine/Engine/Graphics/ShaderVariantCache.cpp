@@ -0,0 +1,125 @@
+// Engine Includes.
+#include "ShaderVariantCache.h"
+#include "Renderer.h"
+
+// std Includes.
+#include <algorithm>
+#include <stdexcept>
+
+namespace Engine
+{
+	/* Static member variable definitions: */
+	std::unordered_map< std::string, ShaderVariantCache::SourceSet > ShaderVariantCache::SOURCE_SET_MAP;
+
+	Shader* ShaderVariantCache::Get( const char* name,
+									 const VertexShaderSourcePath& vertex_shader_source_path,
+									 const FragmentShaderSourcePath& fragment_shader_source_path,
+									 const Shader::Features& features_to_set )
+	{
+		return Get( name, vertex_shader_source_path, GeometryShaderSourcePath(), fragment_shader_source_path, features_to_set );
+	}
+
+	Shader* ShaderVariantCache::Get( const char* name,
+									 const VertexShaderSourcePath& vertex_shader_source_path,
+									 const GeometryShaderSourcePath& geometry_shader_source_path,
+									 const FragmentShaderSourcePath& fragment_shader_source_path,
+									 const Shader::Features& features_to_set )
+	{
+		/* Paths are copied right away, as ShaderSourcePaths do not own theirs. */
+		const std::string vertex_source_path( ( std::string )vertex_shader_source_path );
+		const std::string geometry_source_path( geometry_shader_source_path.Empty() ? std::string() : ( std::string )geometry_shader_source_path );
+		const std::string fragment_source_path( ( std::string )fragment_shader_source_path );
+
+		auto& source_set = SOURCE_SET_MAP[ vertex_source_path + '|' + geometry_source_path + '|' + fragment_source_path ];
+
+		auto [ iterator, is_inserted ] = source_set.variant_map.try_emplace( MakeFeatureMask( source_set, features_to_set ), name );
+		auto& variant = iterator->second;
+
+		if( is_inserted )
+			variant.Defer( vertex_source_path, geometry_source_path, fragment_source_path, features_to_set );
+
+		return &variant;
+	}
+
+	bool ShaderVariantCache::Compile( const std::vector< Shader* >& variants )
+	{
+		std::vector< Shader::FromFileParameters > batch;
+		batch.reserve( variants.size() );
+
+		for( auto* variant : variants )
+		{
+			if( not variant->IsCompiled() )
+				batch.push_back( { .shader               = variant,
+								   .vertex_source_path   = variant->vertex_source_path,
+								   .geometry_source_path = variant->geometry_source_path,
+								   .fragment_source_path = variant->fragment_source_path,
+								   .features_to_set      = variant->features_requested } );
+		}
+
+		return batch.empty() || Shader::FromFile_Batch( batch );
+	}
+
+	unsigned int ShaderVariantCache::EvictUnused( const Renderer& renderer )
+	{
+		const auto shaders_registered = renderer.RegisteredShaders();
+
+		unsigned int evicted_count = 0;
+
+		for( auto& [ source_set_key, source_set ] : SOURCE_SET_MAP )
+		{
+			for( auto& [ feature_mask, variant ] : source_set.variant_map )
+			{
+				if( variant.IsCompiled() && not shaders_registered.contains( &variant ) )
+				{
+					variant.Delete();
+					evicted_count++;
+				}
+			}
+		}
+
+		return evicted_count;
+	}
+
+	unsigned int ShaderVariantCache::VariantCount()
+	{
+		unsigned int count = 0;
+		for( const auto& [ source_set_key, source_set ] : SOURCE_SET_MAP )
+			count += ( unsigned int )source_set.variant_map.size();
+
+		return count;
+	}
+
+	unsigned int ShaderVariantCache::CompiledVariantCount()
+	{
+		unsigned int count = 0;
+		for( const auto& [ source_set_key, source_set ] : SOURCE_SET_MAP )
+			count += ( unsigned int )std::count_if( source_set.variant_map.cbegin(), source_set.variant_map.cend(),
+													[]( const auto& mask_variant_pair ) { return mask_variant_pair.second.IsCompiled(); } );
+
+		return count;
+	}
+
+	ShaderVariantCache::FeatureMask ShaderVariantCache::MakeFeatureMask( SourceSet& source_set, const Shader::Features& features_to_set )
+	{
+		FeatureMask feature_mask = 0;
+
+		for( const auto& feature : features_to_set )
+		{
+			auto iterator = std::find( source_set.feature_names.cbegin(), source_set.feature_names.cend(), feature );
+			if( iterator == source_set.feature_names.cend() )
+			{
+				/* Not a debug-only check: Bits past the mask would alias other variants & hand out the wrong Shader silently. */
+				if( source_set.feature_names.size() == sizeof( FeatureMask ) * 8 )
+					throw std::runtime_error( "ERROR::SHADER_VARIANT_CACHE::MakeFeatureMask(): Too many distinct Features (> " + std::to_string( sizeof( FeatureMask ) * 8 ) +
+											  ") for a single source set; Can not add \"" + feature + "\"!" );
+
+				source_set.feature_names.push_back( feature );
+				iterator = std::prev( source_set.feature_names.cend() );
+			}
+
+			feature_mask |= FeatureMask( 1 ) << std::distance( source_set.feature_names.cbegin(), iterator );
+		}
+
+		return feature_mask;
+	}
+}
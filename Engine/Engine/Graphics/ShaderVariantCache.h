@@ -0,0 +1,62 @@
+#pragma once
+
+// Engine Includes.
+#include "Shader.hpp"
+
+// std Includes.
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+	/* Forward declarations: */
+	class Renderer;
+
+	/* Singleton.
+	 * Owns Shader variants, i.e., Shaders created from the same set of source files with different Features set.
+	 * Variants are created uncompiled & get compiled on first use (assignment to/binding via a Material or registration to the Renderer),
+	 * so that permutations a scene never uses cost neither startup time nor GPU memory. */
+	class ShaderVariantCache
+	{
+	public:
+		/* Bit i stands for the i-th distinct Feature requested for a given source set, so the mask does not depend on the order Features are passed in. */
+		using FeatureMask = std::uint64_t;
+
+		/* Returns the variant of given sources & Features; Creates it (uncompiled) on first request.
+		 * The name is only used when the variant is created. Throws if the sources are requested with more than 64 distinct Features in total (see FeatureMask). */
+		static Shader* Get( const char* name,
+							const VertexShaderSourcePath& vertex_shader_source_path,
+							const FragmentShaderSourcePath& fragment_shader_source_path,
+							const Shader::Features& features_to_set = {} );
+		static Shader* Get( const char* name,
+							const VertexShaderSourcePath& vertex_shader_source_path,
+							const GeometryShaderSourcePath& geometry_shader_source_path,
+							const FragmentShaderSourcePath& fragment_shader_source_path,
+							const Shader::Features& features_to_set = {} );
+
+		/* Compiles the given variants that are not compiled yet, in a single batch (see Shader::FromFile_Batch()); For variants known to be needed up-front. */
+		static bool Compile( const std::vector< Shader* >& variants );
+
+		/* Deletes the programs of compiled variants that are not registered to the renderer (i.e., not used by any Renderable) & returns how many were evicted.
+		 * Evicted variants keep their reflection data, so Materials referring to them stay intact; They are recompiled (typically from the ProgramBinaryCache) on next use. */
+		static unsigned int EvictUnused( const Renderer& renderer );
+
+		static unsigned int VariantCount();
+		static unsigned int CompiledVariantCount();
+
+	private:
+		struct SourceSet
+		{
+			std::vector< std::string > feature_names; // Index = bit index in FeatureMask.
+			std::unordered_map< FeatureMask, Shader > variant_map;
+		};
+
+		static FeatureMask MakeFeatureMask( SourceSet& source_set, const Shader::Features& features_to_set );
+
+	private:
+		/* Keyed by concatenated source paths. */
+		static std::unordered_map< std::string, SourceSet > SOURCE_SET_MAP;
+	};
+}
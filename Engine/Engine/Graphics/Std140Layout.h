@@ -0,0 +1,21 @@
+#pragma once
+
+namespace Engine::Std140Layout
+{
+	/* Compile-time counterparts of Uniform::Information, Uniform::BufferMemberInformation_Struct & Uniform::BufferMemberInformation_Array.
+	 * Instances are generated into Std140Layout_Generated.h by PreBuild_GenerateStd140Layouts.py (as a pre-build step), from glslang's reflection of the shaders. */
+
+	/* Non-aggregate & struct members alike. */
+	struct Member
+	{
+		int offset;
+		int size;
+	};
+
+	struct MemberArray
+	{
+		int offset;
+		int stride;
+		int element_count;
+	};
+}
@@ -8,6 +8,8 @@
 #include "Math/Vector.hpp"
 
 // std Includes.
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -73,6 +75,19 @@ namespace Engine
 
 		static constexpr ImportSettings DEFAULT_IMPORT_SETTINGS = {};
 
+		/* Pixels decoded from an image file, in the format the Loader uploads them in. */
+		struct DecodedImage
+		{
+			struct PixelsDeleter { void operator()( std::byte* pixels ) const; };
+
+			std::unique_ptr< std::byte, PixelsDeleter > pixels;
+			int width, height;
+		};
+
+		/* Decoding does not touch GL, so this can be called from any thread; Textures are then created from the decoded images on the GL thread,
+		 * via AssetDatabase< Texture >::CreateAsset(). Returns nullopt if the image can not be decoded. */
+		static std::optional< DecodedImage > DecodeImage( const std::byte* data, const int size, const bool flip_vertically );
+
 	private:
 		friend class AssetDatabase< Texture >;
 		
@@ -158,6 +173,11 @@ namespace Engine
 				 const Color4 border_color = Color4::Black(),
 				 const Filtering min_filter = Filtering::Linear_MipmapLinear, const Filtering mag_filter = Filtering::Linear );
 
+		/* Private decoded image constructor: Only the AssetDatabase< Texture > should be able to construct a Texture with data. */
+		Texture( const std::string_view name,
+				 const DecodedImage& decoded_image,
+				 const ImportSettings& import_settings );
+
 		/* Private cubemap constructor: Only the AssetDatabase< Texture > should be able to construct a cubemap Texture with data.
 		 * Parameter 'is_sRGB': Set this to true for albedo/diffuse maps, false for normal maps etc. (for linear color space textures).
 		 */
@@ -20,7 +20,7 @@ namespace Engine
 		//auto& instance = Instance();
 
 		// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
-		stbi_set_flip_vertically_on_load( import_settings.flip_vertically );
+		stbi_set_flip_vertically_on_load_thread( import_settings.flip_vertically );
 
 		std::optional< Texture > maybe_texture;
 
@@ -59,7 +59,7 @@ namespace Engine
 		/* OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
 		 *
 		 * BUT: cube-map coordinate space has the inverse v behavior, so the image's should not be flipped. */
-		stbi_set_flip_vertically_on_load( false ); // Override whatever is in import_settings.flip_vertically.
+		stbi_set_flip_vertically_on_load_thread( false ); // Override whatever is in import_settings.flip_vertically.
 
 		std::optional< Texture > maybe_texture;
 
@@ -126,25 +126,10 @@ namespace Engine
 			return maybe_texture;
 		}
 
-		// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
-		stbi_set_flip_vertically_on_load( import_settings.flip_vertically );
-
-
-		int width, height;
-		int number_of_channels = -1;
-		auto image_data = stbi_load_from_memory( ( stbi_uc* )data, size, &width, &height, &number_of_channels, DESIRED_CHANNELS );
-		if( image_data )
+		if( auto maybe_decoded_image = DecodeImage( data, size, import_settings.flip_vertically );
+			maybe_decoded_image )
 		{
-			/* Format from import_settings is not used at the moment. */
-			maybe_texture = Texture( name, 
-									 ( std::byte* )image_data, 
-									 FORMAT, 
-									 width, height, 
-									 import_settings.is_sRGB,
-									 import_settings.generate_mipmaps,
-									 import_settings.wrap_u, import_settings.wrap_v,
-									 import_settings.border_color,
-									 import_settings.min_filter, import_settings.mag_filter );
+			maybe_texture = Texture( name, *maybe_decoded_image, import_settings );
 		}
 		else
 		{
@@ -152,8 +137,43 @@ namespace Engine
 			ServiceLocator< GLLogger >::Get().Error( R"(Texture ")" + std::string(name) + R"(": Could not load image data from memory.)" "\n" );
 		}
 
-		stbi_image_free( image_data );
-		
 		return maybe_texture;
 	}
+
+	void Texture::DecodedImage::PixelsDeleter::operator()( std::byte* pixels ) const
+	{
+		stbi_image_free( pixels );
+	}
+
+	std::optional< Texture::DecodedImage > Texture::DecodeImage( const std::byte* data, const int size, const bool flip_vertically )
+	{
+		/* The flag is thread-local (as is stb's failure reason), so images can be decoded on multiple threads at once. */
+		// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
+		stbi_set_flip_vertically_on_load_thread( flip_vertically );
+
+		DecodedImage decoded_image;
+
+		int number_of_channels = -1;
+		decoded_image.pixels.reset( ( std::byte* )stbi_load_from_memory( ( stbi_uc* )data, size, &decoded_image.width, &decoded_image.height, &number_of_channels, DESIRED_CHANNELS ) );
+		if( not decoded_image.pixels )
+			return std::nullopt;
+
+		return decoded_image;
+	}
+
+	/* Private decoded image constructor: Only the AssetDatabase< Texture > should be able to construct a Texture with data. */
+	Texture::Texture( const std::string_view name, const DecodedImage& decoded_image, const ImportSettings& import_settings )
+		:
+		/* Format from import_settings is not used at the moment. */
+		Texture( name,
+				 decoded_image.pixels.get(),
+				 FORMAT,
+				 decoded_image.width, decoded_image.height,
+				 import_settings.is_sRGB,
+				 import_settings.generate_mipmaps,
+				 import_settings.wrap_u, import_settings.wrap_v,
+				 import_settings.border_color,
+				 import_settings.min_filter, import_settings.mag_filter )
+	{
+	}
 }
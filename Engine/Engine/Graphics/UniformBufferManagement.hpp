@@ -2,6 +2,7 @@
 
 // Engine Includes.
 #include "Buffer.hpp"
+#include "Std140Layout.h"
 #include "Std140StructTag.h"
 #include "Uniform.h"
 #include "UniformBufferManager.h"
@@ -164,6 +165,34 @@ namespace Engine
 			blob_map[ buffer_name ].Set( value, buffer_member_single_info->offset, buffer_member_single_info->size );
 		}
 
+	/* Uniform Set; Via compile-time layouts (see Std140Layout_Generated.h): 
+	 * Offsets & sizes are known at compile-time, so these skip the member information look-ups of the overloads above. Only the blob of the buffer is looked up. */
+
+		/* For PARTIAL setting of ARRAY uniforms INSIDE a Uniform Buffer. */
+		template< typename StructType > requires( std::is_base_of_v< Std140StructTag, StructType > )
+		void SetPartial_Array( const std::string& buffer_name, const Std140Layout::MemberArray member_array, const unsigned int array_index, const StructType& value )
+		{
+			ASSERT_DEBUG_ONLY( array_index < ( unsigned int )member_array.element_count );
+
+			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), member_array.offset + array_index * member_array.stride, member_array.stride );
+		}
+
+		/* For PARTIAL setting of STRUCT uniforms INSIDE a Uniform Buffer. */
+		template< typename StructType > requires( std::is_base_of_v< Std140StructTag, StructType > )
+		void SetPartial_Struct( const std::string& buffer_name, const Std140Layout::Member member_struct, const StructType& value )
+		{
+			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), member_struct.offset, member_struct.size );
+		}
+
+		/* For PARTIAL setting of NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
+		template< typename UniformType > requires( not std::is_pointer_v< UniformType > )
+		void SetPartial( const std::string& buffer_name, const Std140Layout::Member member, const UniformType& value )
+		{
+			ASSERT_DEBUG_ONLY( sizeof( UniformType ) >= ( std::size_t )member.size );
+
+			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), member.offset, member.size );
+		}
+
 	/* Uniform Upload: */
 		void UploadAll()
 		{
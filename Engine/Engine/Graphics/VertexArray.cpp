@@ -155,7 +155,7 @@ namespace Engine
 #endif // _DEBUG
 
 		vertex_buffer.Bind();
-		vertex_layout.SetAndEnableAttributes_NonInstanced();
+		vertex_layout.SetAndEnableAttributes_NonInstanced( vertex_buffer.Count() );
 	}
 
 	void VertexArray::CreateArrayAndRegisterVertexBufferAndAttributes( const VertexBuffer& vertex_buffer, const InstanceBuffer& instance_buffer, const VertexLayout& vertex_layout )
@@ -169,7 +169,7 @@ namespace Engine
 	#endif // _DEBUG
 
 		vertex_buffer.Bind();
-		vertex_layout.SetAndEnableAttributes_NonInstanced();
+		vertex_layout.SetAndEnableAttributes_NonInstanced( vertex_buffer.Count() );
 		instance_buffer.Bind();
 		vertex_layout.SetAndEnableAttributes_Instanced();
 	}
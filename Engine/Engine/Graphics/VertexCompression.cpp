@@ -0,0 +1,204 @@
+// Engine Includes.
+#include "VertexCompression.h"
+#include "Core/Assertion.h"
+#include "Math/FastMath.hpp"
+#include "Math/Math.hpp"
+#include "Math/Matrix.h"
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <bit>
+#include <cmath>
+
+namespace Engine::VertexCompression
+{
+	/* Fabian Giesen's float_to_half_fast3_rtne(). */
+	static std::uint16_t FloatToHalf( const float value )
+	{
+		constexpr std::uint32_t F32_INFINITY = 255u << 23;
+		constexpr std::uint32_t F16_MAX      = ( 127u + 16u ) << 23;
+		constexpr std::uint32_t DENORM_MAGIC = ( ( 127u - 15u ) + ( 23u - 10u ) + 1u ) << 23;
+
+		std::uint32_t bits = std::bit_cast< std::uint32_t >( value );
+		const std::uint32_t sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		std::uint32_t result;
+
+		if( bits >= F16_MAX ) // Inf or NaN.
+			result = bits > F32_INFINITY ? 0x7E00 : 0x7C00;
+		else if( bits < ( 113u << 23 ) ) // Subnormal or zero: Adding the magic value aligns the 10 mantissa bits at the bottom, rounding to nearest even.
+			result = std::bit_cast< std::uint32_t >( std::bit_cast< float >( bits ) + std::bit_cast< float >( DENORM_MAGIC ) ) - DENORM_MAGIC;
+		else
+		{
+			const std::uint32_t mantissa_is_odd = ( bits >> 13 ) & 1;
+			result = ( bits + ( ( 15u - 127u ) << 23 ) + 0xFFF + mantissa_is_odd ) >> 13;
+		}
+
+		return std::uint16_t( result | ( sign >> 16 ) );
+	}
+
+	static std::uint32_t PackUnitVector( const Vector3& vector )
+	{
+		/* Zero vectors stay zero thanks to the lower bound. */
+		const float inverse_length = Math::Fast::InverseSqrt( Math::Max( vector.SquareMagnitude(), 1.0e-30f ) );
+
+		auto Pack = [ & ]( const float component )
+		{
+			return std::uint32_t( std::lrint( Math::Clamp( component * inverse_length, -1.0f, +1.0f ) * 511.0f ) ) & 0x3FF;
+		};
+
+		return Pack( vector.X() ) | ( Pack( vector.Y() ) << 10 ) | ( Pack( vector.Z() ) << 20 );
+	}
+
+#ifdef ENGINE_MATH_SIMD_SSE
+	/* Same as FloatToHalf(), 4 values at a time. The upper 16 bits of each result are the sign extension of the lower 16, so the results can be narrowed with _mm_packs_epi32(). */
+	static __m128i FloatToHalfBlock( const __m128 value )
+	{
+		const __m128  sign     = _mm_and_ps( value, _mm_castsi128_ps( _mm_set1_epi32( 0x80000000 ) ) );
+		const __m128  absolute = _mm_xor_ps( value, sign );
+		const __m128i bits     = _mm_castps_si128( absolute );
+
+		const __m128i is_nan       = _mm_castps_si128( _mm_cmpunord_ps( absolute, absolute ) );
+		const __m128i is_regular   = _mm_cmpgt_epi32( _mm_set1_epi32( ( 127 + 16 ) << 23 ), bits );
+		const __m128i is_subnormal = _mm_cmpgt_epi32( _mm_set1_epi32( 113 << 23 ), bits );
+		const __m128i inf_or_nan   = _mm_or_si128( _mm_and_si128( is_nan, _mm_set1_epi32( 0x200 ) ), _mm_set1_epi32( 0x7C00 ) );
+
+		const __m128i denorm_magic = _mm_set1_epi32( ( ( 127 - 15 ) + ( 23 - 10 ) + 1 ) << 23 );
+		const __m128i subnormal    = _mm_sub_epi32( _mm_castps_si128( _mm_add_ps( absolute, _mm_castsi128_ps( denorm_magic ) ) ), denorm_magic );
+
+		/* Mantissa LSB moved to the sign bit & broadcast: -1 if odd, 0 otherwise. */
+		const __m128i mantissa_is_odd = _mm_srai_epi32( _mm_slli_epi32( bits, 31 - 13 ), 31 );
+		const __m128i normal          = _mm_srli_epi32( _mm_sub_epi32( _mm_add_epi32( bits, _mm_set1_epi32( 0xFFF - ( ( 127 - 15 ) << 23 ) ) ), mantissa_is_odd ), 13 );
+
+		const __m128i non_special = _mm_or_si128( _mm_and_si128( is_subnormal, subnormal ), _mm_andnot_si128( is_subnormal, normal ) );
+		const __m128i result      = _mm_or_si128( _mm_and_si128( is_regular, non_special ), _mm_andnot_si128( is_regular, inf_or_nan ) );
+
+		return _mm_or_si128( result, _mm_srai_epi32( _mm_castps_si128( sign ), 16 ) );
+	}
+#endif // ENGINE_MATH_SIMD_SSE
+
+	Matrix4x4 QuantizePositions( std::span< const Vector3 > positions, std::span< QuantizedPosition > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= positions.size() && "VertexCompression::QuantizePositions(): Result span is smaller than the input span!" );
+
+		if( positions.empty() )
+			return Matrix4x4{};
+
+		Vector3 minimum( positions.front() ), maximum( positions.front() );
+		for( const auto& position : positions )
+		{
+			for( auto axis = 0; axis < 3; axis++ )
+			{
+				minimum[ axis ] = Math::Min( minimum[ axis ], position[ axis ] );
+				maximum[ axis ] = Math::Max( maximum[ axis ], position[ axis ] );
+			}
+		}
+
+		const Vector3 center( ( minimum + maximum ) / 2.0f );
+		const Vector3 half_extents( ( maximum - minimum ) / 2.0f );
+
+		float extent = Math::Max( half_extents.X(), Math::Max( half_extents.Y(), half_extents.Z() ) );
+		if( extent == 0.0f ) // Single point or all positions are the same.
+			extent = 1.0f;
+
+		const float scale = 32767.0f / extent;
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const __m128 center_4 = _mm_setr_ps( center.X(), center.Y(), center.Z(), 0.0f );
+		const __m128 scale_4  = _mm_set1_ps( scale );
+
+		/* 2 positions at a time; w stays at zero as both the input & the center are zero on w. */
+		for( ; index + 2 <= positions.size(); index += 2 )
+		{
+			const Vector3& first  = positions[ index ];
+			const Vector3& second = positions[ index + 1 ];
+
+			const __m128i first_quantized  = _mm_cvtps_epi32( _mm_mul_ps( _mm_sub_ps( _mm_setr_ps( first.X(),  first.Y(),  first.Z(),  0.0f ), center_4 ), scale_4 ) );
+			const __m128i second_quantized = _mm_cvtps_epi32( _mm_mul_ps( _mm_sub_ps( _mm_setr_ps( second.X(), second.Y(), second.Z(), 0.0f ), center_4 ), scale_4 ) );
+
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( result.data() + index ), _mm_packs_epi32( first_quantized, second_quantized ) );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < positions.size(); index++ )
+		{
+			const Vector3 quantized( ( positions[ index ] - center ) * scale );
+			result[ index ] = QuantizedPosition{ std::int16_t( std::lrint( quantized.X() ) ), std::int16_t( std::lrint( quantized.Y() ) ), std::int16_t( std::lrint( quantized.Z() ) ), 0 };
+		}
+
+		/* Vertex fetch maps [-32767, +32767] to [-1, +1]. */
+		return Matrix::Scaling( extent ) * Matrix::Translation( center );
+	}
+
+	void PackUnitVectors( std::span< const Vector3 > vectors, std::span< PackedVector3 > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= vectors.size() && "VertexCompression::PackUnitVectors(): Result span is smaller than the input span!" );
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const __m128  minus_one = _mm_set1_ps( -1.0f );
+		const __m128  plus_one  = _mm_set1_ps( +1.0f );
+		const __m128  scale     = _mm_set1_ps( 511.0f );
+		const __m128i mask      = _mm_set1_epi32( 0x3FF );
+
+		auto Pack = [ & ]( const __m128 component )
+		{
+			return _mm_and_si128( _mm_cvtps_epi32( _mm_mul_ps( _mm_min_ps( _mm_max_ps( component, minus_one ), plus_one ), scale ) ), mask );
+		};
+
+		/* 4 vectors at a time, transposed into a register per component. */
+		for( ; index + 4 <= vectors.size(); index += 4 )
+		{
+			const Vector3* vector = vectors.data() + index;
+
+			const __m128 x = _mm_setr_ps( vector[ 0 ].X(), vector[ 1 ].X(), vector[ 2 ].X(), vector[ 3 ].X() );
+			const __m128 y = _mm_setr_ps( vector[ 0 ].Y(), vector[ 1 ].Y(), vector[ 2 ].Y(), vector[ 3 ].Y() );
+			const __m128 z = _mm_setr_ps( vector[ 0 ].Z(), vector[ 1 ].Z(), vector[ 2 ].Z(), vector[ 3 ].Z() );
+
+			/* Same as Math::Fast::InverseSqrt(). */
+			const __m128 square_length  = _mm_max_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) ), _mm_mul_ps( z, z ) ), _mm_set1_ps( 1.0e-30f ) );
+			const __m128 estimate       = _mm_rsqrt_ps( square_length );
+			const __m128 inverse_length = _mm_mul_ps( estimate, _mm_sub_ps( _mm_set1_ps( 1.5f ), _mm_mul_ps( _mm_mul_ps( _mm_mul_ps( _mm_set1_ps( 0.5f ), square_length ), estimate ), estimate ) ) );
+
+			const __m128i x_packed = Pack( _mm_mul_ps( x, inverse_length ) );
+			const __m128i y_packed = Pack( _mm_mul_ps( y, inverse_length ) );
+			const __m128i z_packed = Pack( _mm_mul_ps( z, inverse_length ) );
+
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( result.data() + index ), _mm_or_si128( x_packed, _mm_or_si128( _mm_slli_epi32( y_packed, 10 ), _mm_slli_epi32( z_packed, 20 ) ) ) );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < vectors.size(); index++ )
+			result[ index ] = PackUnitVector( vectors[ index ] );
+	}
+
+	void ConvertToHalf( std::span< const Vector2 > vectors, std::span< HalfVector2 > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= vectors.size() && "VertexCompression::ConvertToHalf(): Result span is smaller than the input span!" );
+
+		static_assert( sizeof( Vector2 ) == sizeof( float ) * 2 && sizeof( HalfVector2 ) == sizeof( std::uint16_t ) * 2 );
+
+		const float*   values      = reinterpret_cast< const float* >( vectors.data() );
+		std::uint16_t* half_values = reinterpret_cast< std::uint16_t* >( result.data() );
+
+		const std::size_t value_count = vectors.size() * 2;
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		for( ; index + 8 <= value_count; index += 8 )
+		{
+			const __m128i low  = FloatToHalfBlock( _mm_loadu_ps( values + index ) );
+			const __m128i high = FloatToHalfBlock( _mm_loadu_ps( values + index + 4 ) );
+
+			_mm_storeu_si128( reinterpret_cast< __m128i* >( half_values + index ), _mm_packs_epi32( low, high ) );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < value_count; index++ )
+			half_values[ index ] = FloatToHalf( values[ index ] );
+	}
+}
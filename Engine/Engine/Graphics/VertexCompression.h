@@ -0,0 +1,40 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <cstdint>
+#include <span>
+
+namespace Engine::VertexCompression
+{
+	/* Encoders for the compact vertex attribute formats (see Mesh::VertexCompression), run at import time.
+	 * Decoding is done by the vertex fetch itself (normalized integer & half float attribute formats), so shaders keep declaring plain vec2/vec3 inputs. */
+
+	/* 4x normalized signed 16-bit integers (GL_SHORT); w is always zero & only keeps the attribute 4-byte aligned. */
+	struct QuantizedPosition
+	{
+		std::int16_t x, y, z, w;
+	};
+
+	/* 2x half floats (GL_HALF_FLOAT). */
+	struct HalfVector2
+	{
+		std::uint16_t x, y;
+	};
+
+	/* Normalized GL_INT_2_10_10_10_REV: x, y & z in 10 bits each (starting from the least significant bit), w (always zero) in the upper 2. */
+	using PackedVector3 = std::uint32_t;
+
+	/* Quantizes positions into their bounding box & returns the dequantization transform, which maps the decoded [-1, +1] values back to the original positions.
+	 * The scale is uniform (the largest extent is used for all axes); Vertex shaders apply the transform before the world transform (see _Attributes.glsl). */
+	Matrix4x4 QuantizePositions( std::span< const Vector3 > positions, std::span< QuantizedPosition > result );
+
+	/* Only the directions are kept: Vectors are normalized before packing (zero vectors stay zero). Max. error per component: 1/1022. */
+	void PackUnitVectors( std::span< const Vector3 > vectors, std::span< PackedVector3 > result );
+
+	/* Rounds to nearest even; Out of range values become infinity. Relative precision is 2^-11, i.e. ~1/2048 texel for a 2048 pixel texture at uv = 1. */
+	void ConvertToHalf( std::span< const Vector2 > vectors, std::span< HalfVector2 > result );
+}
@@ -29,19 +29,25 @@ namespace Engine
 		} );
 	}
 
-	void VertexLayout::SetAndEnableAttributes_NonInstanced() const
+	void VertexLayout::SetAndEnableAttributes_NonInstanced( const unsigned int vertex_count ) const
 	{
 		const auto instanced_attributes_begin = std::find_if( attributes.cbegin(), attributes.cend(), []( const VertexAttribute& attribute ) { return attribute.is_instanced; } );
 
-		const unsigned int stride = Stride_NonInstanced();
+		const bool is_planar = arrangement == Arrangement::Planar;
+
+		unsigned int stride = Stride_NonInstanced();
 
-		constexpr int is_normalized = GL_FALSE;
 		unsigned int offset = 0;
 
 		for( auto iterator = attributes.cbegin(); iterator != instanced_attributes_begin; iterator++ )
 		{
 			const auto& attribute = *iterator;
 
+			/* Each attribute is tightly packed in its own block, following the previous attribute's block. */
+			const unsigned int block_start = offset;
+			if( is_planar )
+				stride = attribute.Size();
+
 			if( const auto underlying_count = GL::Type::CountOf( attribute.type );
 				underlying_count > 1 )
 			{
@@ -55,7 +61,7 @@ namespace Engine
 				for( auto slot_index = 0; slot_index < slot_count; slot_index++ )
 				{
 					const auto location = attribute.location + slot_index;
-					glVertexAttribPointer( location, slot_size, underlying_type, is_normalized, stride, BUFFER_OFFSET( offset ) );
+					glVertexAttribPointer( location, slot_size, underlying_type, GL_FALSE, stride, BUFFER_OFFSET( offset ) );
 					glEnableVertexAttribArray( location );
 
 					offset += slot_stride;
@@ -63,11 +69,14 @@ namespace Engine
 			}
 			else
 			{
-				glVertexAttribPointer( attribute.location, attribute.count, attribute.type, is_normalized, stride, BUFFER_OFFSET( offset ) );
+				glVertexAttribPointer( attribute.location, attribute.count, attribute.type, attribute.is_normalized ? GL_TRUE : GL_FALSE, stride, BUFFER_OFFSET( offset ) );
 				glEnableVertexAttribArray( attribute.location );
 
 				offset += attribute.Size();
 			}
+
+			if( is_planar )
+				offset = block_start + attribute.Size() * vertex_count;
 		}
 	}
 
@@ -151,8 +160,18 @@ namespace Engine
 		if( other.Count() != Count() )
 			return false;
 
+		/* Compact formats match float shader inputs at the same location, regardless of their own type & component count. */
+		auto Matches = []( const VertexAttribute& left, const VertexAttribute& right )
+		{
+			if( left == right )
+				return true;
+
+			return left.location == right.location && left.is_instanced == right.is_instanced &&
+				   ( ( left.IsConvertedToFloat() && right.type == GL_FLOAT ) || ( right.IsConvertedToFloat() && left.type == GL_FLOAT ) );
+		};
+
 		for( auto i = 0; i < attributes.size(); i++ )
-			if( other.attributes[ i ] != attributes[ i ] )
+			if( not Matches( attributes[ i ], other.attributes[ i ] ) )
 				return false;
 			
 		return true;
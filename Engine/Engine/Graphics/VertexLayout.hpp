@@ -7,6 +7,7 @@
 #include "Math/Concepts.h"
 
 // std Includes.
+#include <cstdint>
 #include <vector>
 
 namespace Engine
@@ -17,6 +18,8 @@ namespace Engine
 		GLenum type;
 		bool is_instanced;
 		unsigned int location;
+		/* Integer types are converted to [-1, +1] (signed) or [0, 1] (unsigned) floats by the vertex fetch when set; Has no effect on float types. */
+		bool is_normalized = false;
 
 		/* Comparison operators. */
 		constexpr bool operator ==( const VertexAttribute& other ) const = default;
@@ -24,9 +27,12 @@ namespace Engine
 
 		inline bool Empty() const { return count == 0; }
 
+		/* Compact (normalized integer & half float) formats, which the vertex fetch converts to floats. */
+		inline bool IsConvertedToFloat() const { return type == GL_HALF_FLOAT || ( is_normalized && type != GL_FLOAT ); }
+
 		/* Comparison operators. */
 
-		inline unsigned int Size() const { return count * GL::Type::SizeOf( type ); }
+		inline unsigned int Size() const { return GL::Type::IsPacked( type ) ? GL::Type::SizeOf( type ) : count * GL::Type::SizeOf( type ); }
 	};
 
 	struct VertexInstanceAttribute
@@ -48,6 +54,14 @@ namespace Engine
 
 	class VertexLayout
 	{
+	public:
+		/* How the non-instanced attributes are laid out in the vertex buffer. */
+		enum class Arrangement : std::uint8_t
+		{
+			Interleaved, // [ position, normal, ... ][ position, normal, ... ]...
+			Planar		 // [ all positions ][ all normals ]...; Passes reading a subset of the attributes (e.g., position-only shadow passes) fetch contiguous memory.
+		};
+
 	public:
 		VertexLayout();
 
@@ -55,7 +69,7 @@ namespace Engine
 
 		// This makes it possible to pass all attribute lists together in Mesh constructor, even though some of them may not be present.
 		template< typename Collection >
-		VertexLayout( Collection&& attribute_counts_and_types );
+		VertexLayout( Collection&& attribute_counts_and_types, const Arrangement arrangement = Arrangement::Interleaved );
 		// Definition is just below the class definition because this constructor calls Push(), and therefore, has to be defined after the Push() declaration.
 
 		~VertexLayout();
@@ -66,7 +80,8 @@ namespace Engine
 
 		void Push( const VertexInstanceAttribute& attribute );
 
-		void SetAndEnableAttributes_NonInstanced() const;
+		/* vertex_count is only needed for the Planar arrangement, to find where each attribute's block starts. */
+		void SetAndEnableAttributes_NonInstanced( const unsigned int vertex_count ) const;
 		void SetAndEnableAttributes_Instanced() const;
 
 		unsigned int Stride_Total() const;
@@ -74,6 +89,8 @@ namespace Engine
 		unsigned int Stride_Instanced() const;
 		
 		inline unsigned int Count() const { return ( unsigned int )attributes.size(); }
+		inline const std::vector< VertexAttribute >& Attributes() const { return attributes; }
+		inline Arrangement VertexArrangement() const { return arrangement; }
 
 		bool IsCompatibleWith( const VertexLayout& other ) const;
 
@@ -84,11 +101,14 @@ namespace Engine
 
 	private:
 		std::vector< VertexAttribute > attributes;
+		Arrangement arrangement = Arrangement::Interleaved;
 	};
 
 	// This makes it possible to pass all attribute lists together in Mesh constructor, even though some of them may not be present.
 	template< typename Collection >
-	VertexLayout::VertexLayout( Collection&& attribute_counts_and_types )
+	VertexLayout::VertexLayout( Collection&& attribute_counts_and_types, const Arrangement arrangement )
+		:
+		arrangement( arrangement )
 	{
 		for( const auto& attribute : attribute_counts_and_types )
 			if( !attribute.Empty() )
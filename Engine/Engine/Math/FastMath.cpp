@@ -0,0 +1,104 @@
+// Engine Includes.
+#include "FastMath.hpp"
+#include "Core/Assertion.h"
+
+namespace Engine::Math::Fast
+{
+#ifdef ENGINE_MATH_SIMD_SSE
+	namespace Detail
+	{
+		/* Same as the scalar SinCos(), 4 angles at a time.
+		 * The quadrant is rounded half to even instead of away from zero, which does not matter as both neighbouring quadrants are valid on the boundaries. */
+		void SinCosBlock( const __m128 angle, __m128& sin, __m128& cos )
+		{
+			const __m128i quadrant   = _mm_cvtps_epi32( _mm_mul_ps( angle, _mm_set1_ps( 0.636619772f ) ) );
+			const __m128  quadrant_f = _mm_cvtepi32_ps( quadrant );
+
+			__m128 x = _mm_sub_ps( angle, _mm_mul_ps( quadrant_f, _mm_set1_ps( 1.5703125f ) ) );
+			x = _mm_sub_ps( x, _mm_mul_ps( quadrant_f, _mm_set1_ps( 4.837512969970703125e-4f ) ) );
+			x = _mm_sub_ps( x, _mm_mul_ps( quadrant_f, _mm_set1_ps( 7.54978995489188216e-8f ) ) );
+
+			const __m128 x2 = _mm_mul_ps( x, x );
+
+			__m128 sin_x = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( -1.9515295891e-4f ), x2 ), _mm_set1_ps( 8.3321608736e-3f ) );
+			sin_x = _mm_sub_ps( _mm_mul_ps( sin_x, x2 ), _mm_set1_ps( 1.6666654611e-1f ) );
+			sin_x = _mm_add_ps( x, _mm_mul_ps( _mm_mul_ps( x, x2 ), sin_x ) );
+
+			__m128 cos_x = _mm_sub_ps( _mm_mul_ps( _mm_set1_ps( 2.443315711809948e-5f ), x2 ), _mm_set1_ps( 1.388731625493765e-3f ) );
+			cos_x = _mm_add_ps( _mm_mul_ps( cos_x, x2 ), _mm_set1_ps( 4.166664568298827e-2f ) );
+			cos_x = _mm_add_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), _mm_mul_ps( _mm_set1_ps( 0.5f ), x2 ) ), _mm_mul_ps( _mm_mul_ps( x2, x2 ), cos_x ) );
+
+			const __m128i one       = _mm_set1_epi32( 1 );
+			const __m128i two       = _mm_set1_epi32( 2 );
+			const __m128  swap_mask = _mm_castsi128_ps( _mm_cmpeq_epi32( _mm_and_si128( quadrant, one ), one ) );
+
+			/* Bit 1 of the quadrant moved to the sign bit. */
+			const __m128 sin_sign = _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( quadrant, two ), 30 ) );
+			const __m128 cos_sign = _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( _mm_add_epi32( quadrant, one ), two ), 30 ) );
+
+			sin = _mm_xor_ps( _mm_or_ps( _mm_and_ps( swap_mask, cos_x ), _mm_andnot_ps( swap_mask, sin_x ) ), sin_sign );
+			cos = _mm_xor_ps( _mm_or_ps( _mm_and_ps( swap_mask, sin_x ), _mm_andnot_ps( swap_mask, cos_x ) ), cos_sign );
+		}
+	}
+#endif // ENGINE_MATH_SIMD_SSE
+
+	void Sin( std::span< const float > angles, std::span< float > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= angles.size() && "Math::Fast::Sin(): Result span is smaller than the input span!" );
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		for( ; index + 4 <= angles.size(); index += 4 )
+		{
+			__m128 sin, cos;
+			Detail::SinCosBlock( _mm_loadu_ps( angles.data() + index ), sin, cos );
+			_mm_storeu_ps( result.data() + index, sin );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < angles.size(); index++ )
+			result[ index ] = Sin( Radians< float >( angles[ index ] ) );
+	}
+
+	void Cos( std::span< const float > angles, std::span< float > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= angles.size() && "Math::Fast::Cos(): Result span is smaller than the input span!" );
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		for( ; index + 4 <= angles.size(); index += 4 )
+		{
+			__m128 sin, cos;
+			Detail::SinCosBlock( _mm_loadu_ps( angles.data() + index ), sin, cos );
+			_mm_storeu_ps( result.data() + index, cos );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < angles.size(); index++ )
+			result[ index ] = Cos( Radians< float >( angles[ index ] ) );
+	}
+
+	void InverseSqrt( std::span< const float > values, std::span< float > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= values.size() && "Math::Fast::InverseSqrt(): Result span is smaller than the input span!" );
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		for( ; index + 4 <= values.size(); index += 4 )
+		{
+			const __m128 value    = _mm_loadu_ps( values.data() + index );
+			const __m128 estimate = _mm_rsqrt_ps( value );
+
+			/* estimate * ( 1.5 - 0.5 * value * estimate^2 ), same as the scalar version. */
+			const __m128 correction = _mm_sub_ps( _mm_set1_ps( 1.5f ), _mm_mul_ps( _mm_mul_ps( _mm_mul_ps( _mm_set1_ps( 0.5f ), value ), estimate ), estimate ) );
+			_mm_storeu_ps( result.data() + index, _mm_mul_ps( estimate, correction ) );
+		}
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < values.size(); index++ )
+			result[ index ] = InverseSqrt( values[ index ] );
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Angle.hpp"
+#include "Math/Constants.h"
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+/* Opt-in approximations of the Math functions, for hot paths that can tolerate the error in exchange for speed & predictable cost (no slow paths for large arguments etc.).
+ * The maximum errors documented below are measured over the whole valid input range. Only floats are supported. */
+namespace Engine::Math::Fast
+{
+	namespace Detail
+	{
+		/* Cody-Waite reduction of angle to [-pi/4, +pi/4], with pi/2 split into 3 parts so that the reduction stays accurate for |angle| up to ~10^4 radians.
+		 * Returns the index of the quadrant the angle falls into. */
+		inline int ReduceToQuadrant( const float angle, float& reduced_angle )
+		{
+			const int quadrant = static_cast< int >( angle * 0.636619772f + ( angle >= 0.0f ? 0.5f : -0.5f ) );
+			const float quadrant_f = static_cast< float >( quadrant );
+
+			reduced_angle = ( ( angle - quadrant_f * 1.5703125f ) - quadrant_f * 4.837512969970703125e-4f ) - quadrant_f * 7.54978995489188216e-8f;
+			return quadrant;
+		}
+
+		/* Minimax polynomials for [-pi/4, +pi/4] (from Cephes). */
+
+		inline float SinPolynomial( const float x )
+		{
+			const float x2 = x * x;
+			return x + x * x2 * ( ( -1.9515295891e-4f * x2 + 8.3321608736e-3f ) * x2 - 1.6666654611e-1f );
+		}
+
+		inline float CosPolynomial( const float x )
+		{
+			const float x2 = x * x;
+			return 1.0f - 0.5f * x2 + x2 * x2 * ( ( 2.443315711809948e-5f * x2 - 1.388731625493765e-3f ) * x2 + 4.166664568298827e-2f );
+		}
+	}
+
+/* Trigonometry. */
+
+	/* Max. absolute error: 1e-7 for |angle| <= 10^4 radians. */
+	inline float Sin( const Radians< float > angle )
+	{
+		float x;
+		const int quadrant = Detail::ReduceToQuadrant( float( angle ), x );
+
+		const float sin = quadrant & 1 ? Detail::CosPolynomial( x ) : Detail::SinPolynomial( x );
+		return quadrant & 2 ? -sin : sin;
+	}
+
+	/* Max. absolute error: 1e-7 for |angle| <= 10^4 radians. */
+	inline float Cos( const Radians< float > angle )
+	{
+		float x;
+		const int quadrant = Detail::ReduceToQuadrant( float( angle ), x );
+
+		const float cos = quadrant & 1 ? Detail::SinPolynomial( x ) : Detail::CosPolynomial( x );
+		return ( quadrant + 1 ) & 2 ? -cos : cos;
+	}
+
+	/* Shares the range reduction between the two. Max. absolute error: 1e-7 for |angle| <= 10^4 radians. */
+	inline void SinCos( const Radians< float > angle, float& sin, float& cos )
+	{
+		float x;
+		const int quadrant = Detail::ReduceToQuadrant( float( angle ), x );
+
+		const float sin_x = Detail::SinPolynomial( x );
+		const float cos_x = Detail::CosPolynomial( x );
+
+		sin = quadrant & 1 ? cos_x : sin_x;
+		cos = quadrant & 1 ? sin_x : cos_x;
+
+		if( quadrant & 2 )
+			sin = -sin;
+		if( ( quadrant + 1 ) & 2 )
+			cos = -cos;
+	}
+
+	/* Max. absolute error: 1.2e-5 radians (~0.0007 degrees). atan2( 0, 0 ) returns 0 (like std::atan2()). */
+	inline Radians< float > Atan2( const float y, const float x )
+	{
+		const float abs_x = std::abs( x ), abs_y = std::abs( y );
+		const float maximum = abs_x > abs_y ? abs_x : abs_y;
+		const float minimum = abs_x > abs_y ? abs_y : abs_x;
+
+		if( maximum == 0.0f )
+			return Radians< float >( 0.0f );
+
+		/* Abramowitz & Stegun 4.4.47, for atan() in [0, 1]. */
+		const float z  = minimum / maximum;
+		const float z2 = z * z;
+		float angle = z * ( 0.9998660f + z2 * ( -0.3302995f + z2 * ( 0.1801410f + z2 * ( -0.0851330f + z2 * 0.0208351f ) ) ) );
+
+		if( abs_y > abs_x )
+			angle = Constants< float >::Pi_Over_Two() - angle;
+		if( x < 0.0f )
+			angle = Constants< float >::Pi() - angle;
+
+		return Radians< float >( std::copysign( angle, y ) );
+	}
+
+	/* Expects cosine in [-1, +1]. Max. absolute error: 7e-5 radians (~0.004 degrees). */
+	inline Radians< float > Acos( const float cosine )
+	{
+		/* Abramowitz & Stegun 4.4.45, for acos() in [0, 1]. */
+		const float x = std::abs( cosine );
+		const float angle = std::sqrt( 1.0f - x ) * ( 1.5707288f + x * ( -0.2121144f + x * ( 0.0742610f - 0.0187293f * x ) ) );
+
+		return Radians< float >( cosine < 0.0f ? Constants< float >::Pi() - angle : angle );
+	}
+
+/* Arithmetic. */
+
+	/* Hardware estimate refined with Newton-Raphson. Expects value > 0. Max. relative error: 3e-7 (5e-6 without SIMD). */
+	inline float InverseSqrt( const float value )
+	{
+#if defined( ENGINE_MATH_SIMD_SSE )
+		const float estimate = _mm_cvtss_f32( _mm_rsqrt_ss( _mm_set_ss( value ) ) );
+		return estimate * ( 1.5f - 0.5f * value * estimate * estimate );
+#elif defined( ENGINE_MATH_SIMD_NEON )
+		/* NEON's estimate is only accurate to ~8 bits, so it takes two steps. */
+		const float32x2_t value_v = vdup_n_f32( value );
+		float32x2_t estimate = vrsqrte_f32( value_v );
+		estimate = vmul_f32( estimate, vrsqrts_f32( vmul_f32( value_v, estimate ), estimate ) );
+		estimate = vmul_f32( estimate, vrsqrts_f32( vmul_f32( value_v, estimate ), estimate ) );
+		return vget_lane_f32( estimate, 0 );
+#else
+		float estimate = std::bit_cast< float >( 0x5F375A86u - ( std::bit_cast< std::uint32_t >( value ) >> 1 ) );
+		estimate *= 1.5f - 0.5f * value * estimate * estimate;
+		return estimate * ( 1.5f - 0.5f * value * estimate * estimate );
+#endif
+	}
+
+	/* Expects value >= 0. Max. relative error: Same as InverseSqrt() for value >= 10^-30; Returns exactly 0 for 0. */
+	inline float Sqrt( const float value )
+	{
+		return value * InverseSqrt( value > 1.0e-30f ? value : 1.0e-30f );
+	}
+
+/* Arrays: Same as above, 4 elements at a time with SIMD. Result spans have to be (at least) as large as the input spans & may alias the inputs. */
+
+	/* Angles in radians. */
+	void Sin( std::span< const float > angles, std::span< float > result );
+	/* Angles in radians. */
+	void Cos( std::span< const float > angles, std::span< float > result );
+	void InverseSqrt( std::span< const float > values, std::span< float > result );
+}
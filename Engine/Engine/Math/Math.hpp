@@ -69,6 +69,13 @@ namespace Engine::Math
 		return ( vector_a - vector_b ).Magnitude();
 	}
 
+	/* Cheaper than Distance() (no square root) & preserves its ordering; Prefer for comparisons. */
+	template< typename Component, std::size_t Size > requires( Size > 1 )
+	constexpr Component SquareDistance( const Vector< Component, Size >& vector_a, const Vector< Component, Size >& vector_b )
+	{
+		return ( vector_a - vector_b ).SquareMagnitude();
+	}
+
 	int RoundToMultiple_PowerOf2( const int value, const int multiple );
 
 /* Trigonometry. */
@@ -4,9 +4,14 @@
 #include "Core/Assertion.h"  
 #include "Core/Initialization.h"
 #include "Math/Concepts.h"
+#include "Math/SIMD.h"
 #include "Math/TypeTraits.h"
 #include "Math/Vector.hpp"
 
+// std Includes.
+#include <array>
+#include <type_traits>
+
 namespace Engine::Math
 {
 	/* Row-major. Post-multiplies a row vector to transform it. */
@@ -275,6 +280,19 @@ namespace Engine::Math
 		template< std::size_t RowSizeOther, std::size_t ColumnSizeOther >
 		constexpr Matrix< Type, RowSize, ColumnSizeOther > operator* ( const Matrix< Type, RowSizeOther, ColumnSizeOther >& other ) const requires( ColumnSize == RowSizeOther )
 		{
+#ifdef ENGINE_MATH_SIMD
+			if constexpr( std::is_same_v< Type, float > && RowSize == 4 && ColumnSize == 4 && ColumnSizeOther == 4 )
+			{
+				/* Intrinsics are not constexpr; Constant evaluation takes the scalar path below. */
+				if( not std::is_constant_evaluated() )
+				{
+					Matrix< Type, RowSize, ColumnSizeOther > result( NO_INITIALIZATION );
+					SIMD::Multiply_4x4_4x4( &data[ 0 ][ 0 ], &other.data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] );
+					return result;
+				}
+			}
+#endif // ENGINE_MATH_SIMD
+
 			Matrix< Type, RowSize, ColumnSizeOther > result( ZERO_INITIALIZATION );
 			for( auto i = 0; i < RowSize; i++ )
 				for( auto j = 0; j < ColumnSizeOther; j++ )
@@ -337,9 +355,120 @@ namespace Engine::Math
 					data[ 0 ][ 0 ] * ( ( data[ 1 ][ 1 ] * data[ 2 ][ 2 ] ) - ( data[ 2 ][ 1 ] * data[ 1 ][ 2 ] ) ) -
 					data[ 0 ][ 1 ] * ( data[ 1 ][ 0 ] * data[ 2 ][ 2 ] - data[ 2 ][ 0 ] * data[ 1 ][ 2 ] ) +
 					data[ 0 ][ 2 ] * ( data[ 1 ][ 0 ] * data[ 2 ][ 1 ] - data[ 2 ][ 0 ] * data[ 1 ][ 1 ] );
+			if constexpr( RowSize == 4 && ColumnSize == 4 )
+			{
+				const auto upper = SubDeterminants_4x4( 0, 1 );
+				const auto lower = SubDeterminants_4x4( 2, 3 );
+
+				return upper[ 0 ] * lower[ 5 ] - upper[ 1 ] * lower[ 4 ] + upper[ 2 ] * lower[ 3 ] + upper[ 3 ] * lower[ 2 ] - upper[ 4 ] * lower[ 1 ] + upper[ 5 ] * lower[ 0 ];
+			}
+		}
+
+		/* General inverse, via the adjugate (cofactors) divided by the determinant; Assumes *this is invertible.
+		 * Prefer InverseAffine() or InverseRigid() when the matrix is known to be of those forms, as they are cheaper & more accurate. */
+		constexpr Matrix Inverse() const requires( RowSize == 4 && ColumnSize == 4 )
+		{
+#ifdef ENGINE_MATH_SIMD_SSE
+			if constexpr( std::is_same_v< Type, float > )
+			{
+				/* Intrinsics are not constexpr; Constant evaluation takes the scalar path below. */
+				if( not std::is_constant_evaluated() )
+				{
+					Matrix result( NO_INITIALIZATION );
+					SIMD::Inverse_4x4( &data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] );
+					return result;
+				}
+			}
+#endif // ENGINE_MATH_SIMD_SSE
+
+			/* 2x2 determinants of the upper two rows (s) & the lower two rows (c), shared among the cofactors & the determinant. */
+			const auto s = SubDeterminants_4x4( 0, 1 );
+			const auto c = SubDeterminants_4x4( 2, 3 );
+			const auto& m = data;
+
+			const Type reciprocal_determinant = Type( 1 ) / ( s[ 0 ] * c[ 5 ] - s[ 1 ] * c[ 4 ] + s[ 2 ] * c[ 3 ] + s[ 3 ] * c[ 2 ] - s[ 4 ] * c[ 1 ] + s[ 5 ] * c[ 0 ] );
+
+			Matrix result( NO_INITIALIZATION );
+			result.data[ 0 ][ 0 ] = (  m[ 1 ][ 1 ] * c[ 5 ] - m[ 1 ][ 2 ] * c[ 4 ] + m[ 1 ][ 3 ] * c[ 3 ] ) * reciprocal_determinant;
+			result.data[ 0 ][ 1 ] = ( -m[ 0 ][ 1 ] * c[ 5 ] + m[ 0 ][ 2 ] * c[ 4 ] - m[ 0 ][ 3 ] * c[ 3 ] ) * reciprocal_determinant;
+			result.data[ 0 ][ 2 ] = (  m[ 3 ][ 1 ] * s[ 5 ] - m[ 3 ][ 2 ] * s[ 4 ] + m[ 3 ][ 3 ] * s[ 3 ] ) * reciprocal_determinant;
+			result.data[ 0 ][ 3 ] = ( -m[ 2 ][ 1 ] * s[ 5 ] + m[ 2 ][ 2 ] * s[ 4 ] - m[ 2 ][ 3 ] * s[ 3 ] ) * reciprocal_determinant;
+
+			result.data[ 1 ][ 0 ] = ( -m[ 1 ][ 0 ] * c[ 5 ] + m[ 1 ][ 2 ] * c[ 2 ] - m[ 1 ][ 3 ] * c[ 1 ] ) * reciprocal_determinant;
+			result.data[ 1 ][ 1 ] = (  m[ 0 ][ 0 ] * c[ 5 ] - m[ 0 ][ 2 ] * c[ 2 ] + m[ 0 ][ 3 ] * c[ 1 ] ) * reciprocal_determinant;
+			result.data[ 1 ][ 2 ] = ( -m[ 3 ][ 0 ] * s[ 5 ] + m[ 3 ][ 2 ] * s[ 2 ] - m[ 3 ][ 3 ] * s[ 1 ] ) * reciprocal_determinant;
+			result.data[ 1 ][ 3 ] = (  m[ 2 ][ 0 ] * s[ 5 ] - m[ 2 ][ 2 ] * s[ 2 ] + m[ 2 ][ 3 ] * s[ 1 ] ) * reciprocal_determinant;
+
+			result.data[ 2 ][ 0 ] = (  m[ 1 ][ 0 ] * c[ 4 ] - m[ 1 ][ 1 ] * c[ 2 ] + m[ 1 ][ 3 ] * c[ 0 ] ) * reciprocal_determinant;
+			result.data[ 2 ][ 1 ] = ( -m[ 0 ][ 0 ] * c[ 4 ] + m[ 0 ][ 1 ] * c[ 2 ] - m[ 0 ][ 3 ] * c[ 0 ] ) * reciprocal_determinant;
+			result.data[ 2 ][ 2 ] = (  m[ 3 ][ 0 ] * s[ 4 ] - m[ 3 ][ 1 ] * s[ 2 ] + m[ 3 ][ 3 ] * s[ 0 ] ) * reciprocal_determinant;
+			result.data[ 2 ][ 3 ] = ( -m[ 2 ][ 0 ] * s[ 4 ] + m[ 2 ][ 1 ] * s[ 2 ] - m[ 2 ][ 3 ] * s[ 0 ] ) * reciprocal_determinant;
+
+			result.data[ 3 ][ 0 ] = ( -m[ 1 ][ 0 ] * c[ 3 ] + m[ 1 ][ 1 ] * c[ 1 ] - m[ 1 ][ 2 ] * c[ 0 ] ) * reciprocal_determinant;
+			result.data[ 3 ][ 1 ] = (  m[ 0 ][ 0 ] * c[ 3 ] - m[ 0 ][ 1 ] * c[ 1 ] + m[ 0 ][ 2 ] * c[ 0 ] ) * reciprocal_determinant;
+			result.data[ 3 ][ 2 ] = ( -m[ 3 ][ 0 ] * s[ 3 ] + m[ 3 ][ 1 ] * s[ 1 ] - m[ 3 ][ 2 ] * s[ 0 ] ) * reciprocal_determinant;
+			result.data[ 3 ][ 3 ] = (  m[ 2 ][ 0 ] * s[ 3 ] - m[ 2 ][ 1 ] * s[ 1 ] + m[ 2 ][ 2 ] * s[ 0 ] ) * reciprocal_determinant;
+
+			return result;
+		}
+
+		/* Assumes *this is an affine transformation with the last column being [0 0 0 1] (for example; an SRT matrix, with any scaling, even non-uniform).
+		 * Inverts the upper 3x3 portion only & brings the inverse of the translation to the space after the inverse of the upper 3x3 is applied. */
+		constexpr Matrix InverseAffine() const requires( RowSize == 4 && ColumnSize == 4 )
+		{
+			const auto& m = data;
+
+			/* Cofactors of the first column; Re-used for the determinant. */
+			const Type cofactor_00 = m[ 1 ][ 1 ] * m[ 2 ][ 2 ] - m[ 2 ][ 1 ] * m[ 1 ][ 2 ];
+			const Type cofactor_10 = m[ 2 ][ 1 ] * m[ 0 ][ 2 ] - m[ 0 ][ 1 ] * m[ 2 ][ 2 ];
+			const Type cofactor_20 = m[ 0 ][ 1 ] * m[ 1 ][ 2 ] - m[ 1 ][ 1 ] * m[ 0 ][ 2 ];
+
+			const Type reciprocal_determinant = Type( 1 ) / ( m[ 0 ][ 0 ] * cofactor_00 + m[ 1 ][ 0 ] * cofactor_10 + m[ 2 ][ 0 ] * cofactor_20 );
+
+			Matrix< Type, 3, 3 > inverse_upper_3x3( NO_INITIALIZATION );
+			inverse_upper_3x3.data[ 0 ][ 0 ] = cofactor_00 * reciprocal_determinant;
+			inverse_upper_3x3.data[ 0 ][ 1 ] = cofactor_10 * reciprocal_determinant;
+			inverse_upper_3x3.data[ 0 ][ 2 ] = cofactor_20 * reciprocal_determinant;
+			inverse_upper_3x3.data[ 1 ][ 0 ] = ( m[ 2 ][ 0 ] * m[ 1 ][ 2 ] - m[ 1 ][ 0 ] * m[ 2 ][ 2 ] ) * reciprocal_determinant;
+			inverse_upper_3x3.data[ 1 ][ 1 ] = ( m[ 0 ][ 0 ] * m[ 2 ][ 2 ] - m[ 2 ][ 0 ] * m[ 0 ][ 2 ] ) * reciprocal_determinant;
+			inverse_upper_3x3.data[ 1 ][ 2 ] = ( m[ 1 ][ 0 ] * m[ 0 ][ 2 ] - m[ 0 ][ 0 ] * m[ 1 ][ 2 ] ) * reciprocal_determinant;
+			inverse_upper_3x3.data[ 2 ][ 0 ] = ( m[ 1 ][ 0 ] * m[ 2 ][ 1 ] - m[ 2 ][ 0 ] * m[ 1 ][ 1 ] ) * reciprocal_determinant;
+			inverse_upper_3x3.data[ 2 ][ 1 ] = ( m[ 2 ][ 0 ] * m[ 0 ][ 1 ] - m[ 0 ][ 0 ] * m[ 2 ][ 1 ] ) * reciprocal_determinant;
+			inverse_upper_3x3.data[ 2 ][ 2 ] = ( m[ 0 ][ 0 ] * m[ 1 ][ 1 ] - m[ 1 ][ 0 ] * m[ 0 ][ 1 ] ) * reciprocal_determinant;
+
+			return Matrix( inverse_upper_3x3, -Vector< Type, 3 >( data[ 3 ][ 0 ], data[ 3 ][ 1 ], data[ 3 ][ 2 ] ) /* Translation. */ * inverse_upper_3x3 );
+		}
+
+		/* Assumes *this is a rigid transformation (i.e., rotation & translation only; for example, Transform of a Camera).
+		 * Rotation matrices are orthogonal, so the upper 3x3 portion is simply transposed. */
+		constexpr Matrix InverseRigid() const requires( RowSize == 4 && ColumnSize == 4 )
+		{
+			Matrix< Type, 3, 3 > inverse_rotation( NO_INITIALIZATION );
+			for( auto i = 0; i < 3; i++ )
+				for( auto j = 0; j < 3; j++ )
+					inverse_rotation.data[ i ][ j ] = data[ j ][ i ];
+
+			return Matrix( inverse_rotation, -Vector< Type, 3 >( data[ 3 ][ 0 ], data[ 3 ][ 1 ], data[ 3 ][ 2 ] ) /* Translation. */ * inverse_rotation );
 		}
 
 	protected:
+		/* 2x2 determinants of the given two rows, formed by the column pairs 01, 02, 03, 12, 13 & 23, respectively. */
+		constexpr std::array< Type, 6 > SubDeterminants_4x4( const unsigned int row_index_a, const unsigned int row_index_b ) const requires( RowSize == 4 && ColumnSize == 4 )
+		{
+			const auto& a = data[ row_index_a ];
+			const auto& b = data[ row_index_b ];
+
+			return
+			{
+				a[ 0 ] * b[ 1 ] - b[ 0 ] * a[ 1 ],
+				a[ 0 ] * b[ 2 ] - b[ 0 ] * a[ 2 ],
+				a[ 0 ] * b[ 3 ] - b[ 0 ] * a[ 3 ],
+				a[ 1 ] * b[ 2 ] - b[ 1 ] * a[ 2 ],
+				a[ 1 ] * b[ 3 ] - b[ 1 ] * a[ 3 ],
+				a[ 2 ] * b[ 3 ] - b[ 2 ] * a[ 3 ]
+			};
+		}
+
 		/* Row-major. */
 		Type data[ RowSize ][ ColumnSize ];
 	};
@@ -348,6 +477,23 @@ namespace Engine::Math
 	template< Concepts::Arithmetic Type_, std::size_t RowSize, std::size_t ColumnSize >
 	constexpr Vector< Type_, RowSize > operator* ( const Vector< Type_, RowSize >& vector, const Matrix< Type_, RowSize, ColumnSize >& matrix )
 	{
+#ifdef ENGINE_MATH_SIMD
+		if constexpr( std::is_same_v< Type_, float > && ( ( RowSize == 4 && ColumnSize == 4 ) || ( RowSize == 3 && ColumnSize == 3 ) ) )
+		{
+			/* Intrinsics are not constexpr; Constant evaluation takes the scalar path below. */
+			if( not std::is_constant_evaluated() )
+			{
+				Vector< Type_, RowSize > vector_transformed( NO_INITIALIZATION );
+				if constexpr( RowSize == 4 )
+					SIMD::Multiply_4_4x4( vector.Data(), &matrix.data[ 0 ][ 0 ], vector_transformed.Data() );
+				else
+					SIMD::Multiply_3_3x3( vector.Data(), &matrix.data[ 0 ][ 0 ], vector_transformed.Data() );
+
+				return vector_transformed;
+			}
+		}
+#endif // ENGINE_MATH_SIMD
+
 		Vector< Type_, RowSize > vector_transformed;
 		for( auto j = 0; j < ColumnSize; j++ )
 			for( auto k = 0; k < RowSize; k++ )
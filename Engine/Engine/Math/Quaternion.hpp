@@ -351,8 +351,8 @@ namespace Engine::Math
 		template< std::floating_point ComponentType_ >
 		friend constexpr Quaternion< ComponentType_ > EulerToQuaternion( const Degrees< ComponentType_ > heading_around_y, const Degrees< ComponentType_ > pitch_around_x, const Degrees< ComponentType_ > bank_around_z );
 
-		template< std::floating_point ComponentType >
-		static constexpr Quaternion< ComponentType > LookRotation_Naive( const Vector< ComponentType, 3 >& to_target_normalized, const Vector< ComponentType, 3 >& world_up_normalized = Vector< ComponentType, 3 >::Up() )
+		template< std::floating_point ComponentType_ >
+		static constexpr Quaternion< ComponentType_ > LookRotation_Naive( const Vector< ComponentType_, 3 >& to_target_normalized, const Vector< ComponentType_, 3 >& world_up_normalized = Vector< ComponentType_, 3 >::Up() )
 		{
 			ASSERT_DEBUG_ONLY( to_target_normalized.IsNormalized() && R"(Math::LookRotation(): "to_target_normalized" is not normalized!)" );
 			ASSERT_DEBUG_ONLY( world_up_normalized.IsNormalized() && R"(Math::LookRotation():  "world_up_normalized" is not normalized!)" );
@@ -360,15 +360,15 @@ namespace Engine::Math
 			const auto to_right_normalized = Math::Cross( world_up_normalized, to_target_normalized ).Normalized();
 			const auto to_up_normalized = Math::Cross( to_target_normalized, to_right_normalized ).Normalized();
 
-			return Quaternion< ComponentType >
+			return Quaternion< ComponentType_ >
 			{
-				Math::Angle( to_target_normalized, Vector< ComponentType, 3 >::Forward() ),				// 1 Dot() + 1 Acos().
-					Math::Cross( to_target_normalized, Vector< ComponentType, 3 >::Forward() ).Normalized() // 1 Cross() + 1 Vector3::Normalized().
+				Math::Angle( to_target_normalized, Vector< ComponentType_, 3 >::Forward() ),				// 1 Dot() + 1 Acos().
+					Math::Cross( to_target_normalized, Vector< ComponentType_, 3 >::Forward() ).Normalized() // 1 Cross() + 1 Vector3::Normalized().
 			};
 		}
 
-		template< std::floating_point ComponentType >
-		static constexpr Quaternion< ComponentType > LookRotation( const Vector< ComponentType, 3 >& to_target_normalized, const Vector< ComponentType, 3 >& world_up_normalized = Vector< ComponentType, 3 >::Up() )
+		template< std::floating_point ComponentType_ >
+		static constexpr Quaternion< ComponentType_ > LookRotation( const Vector< ComponentType_, 3 >& to_target_normalized, const Vector< ComponentType_, 3 >& world_up_normalized = Vector< ComponentType_, 3 >::Up() )
 		{
 			ASSERT_DEBUG_ONLY( to_target_normalized.IsNormalized() && R"(Math::LookRotation(): "to_target_normalized" is not normalized!)" );
 			ASSERT_DEBUG_ONLY( world_up_normalized.IsNormalized() && R"(Math::LookRotation():  "world_up_normalized" is not normalized!)" );
@@ -376,7 +376,7 @@ namespace Engine::Math
 			const auto to_right_normalized = Math::Cross( world_up_normalized, to_target_normalized ).Normalized();
 			const auto to_up_normalized = Math::Cross( to_target_normalized, to_right_normalized ).Normalized();
 
-			return MatrixToQuaternion( Matrix< ComponentType, 3, 3 >( to_right_normalized, to_up_normalized, to_target_normalized ) ).Normalized();
+			return MatrixToQuaternion( Matrix< ComponentType_, 3, 3 >( to_right_normalized, to_up_normalized, to_target_normalized ) ).Normalized();
 		}
 
 	private:
@@ -0,0 +1,470 @@
+// Engine Includes.
+#include "QuaternionBatch.h"
+#include "Core/Assertion.h"
+#include "Math/Math.hpp"
+#include "Math/SIMD.h"
+#include "Math/TypeTraits.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Engine::Math
+{
+	static_assert( sizeof( Quaternion< float > ) == sizeof( float ) * 4, "Batched operations assume quaternions to be laid out as [ x y z w ]." );
+	static_assert( sizeof( Vector3 )    == sizeof( float ) * 3 );
+	static_assert( sizeof( Matrix3x3 )  == sizeof( float ) * 9 );
+	static_assert( sizeof( Matrix4x4 )  == sizeof( float ) * 16 );
+
+	/* Calls simd_kernel( index ) for every 4 elements & scalar_kernel( index ) for the remaining ones (or all of them, if SIMD is not available). */
+	template< typename SIMDKernel, typename ScalarKernel >
+	static void ForEachBlockOf4( const std::size_t count, SIMDKernel&& simd_kernel, ScalarKernel&& scalar_kernel )
+	{
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		for( ; index + 4 <= count; index += 4 )
+			simd_kernel( index );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		for( ; index < count; index++ )
+			scalar_kernel( index );
+	}
+
+#ifdef ENGINE_MATH_SIMD_SSE
+	/* 4 quaternions, transposed to a register per component. */
+	struct QuaternionBlock
+	{
+		__m128 x, y, z, w;
+	};
+
+	/* 4 3D vectors, transposed to a register per component. */
+	struct Vector3Block
+	{
+		__m128 x, y, z;
+	};
+
+	static QuaternionBlock LoadQuaternionBlock( const Quaternion< float >* quaternions )
+	{
+		const float* components = reinterpret_cast< const float* >( quaternions );
+
+		QuaternionBlock block{ _mm_loadu_ps( components + 0 ), _mm_loadu_ps( components + 4 ), _mm_loadu_ps( components + 8 ), _mm_loadu_ps( components + 12 ) };
+		_MM_TRANSPOSE4_PS( block.x, block.y, block.z, block.w );
+		return block;
+	}
+
+	static QuaternionBlock BroadcastQuaternion( const Quaternion< float >& quaternion )
+	{
+		return { _mm_set1_ps( quaternion.X() ), _mm_set1_ps( quaternion.Y() ), _mm_set1_ps( quaternion.Z() ), _mm_set1_ps( quaternion.W() ) };
+	}
+
+	static void StoreQuaternionBlock( Quaternion< float >* quaternions, QuaternionBlock block )
+	{
+		float* components = reinterpret_cast< float* >( quaternions );
+
+		_MM_TRANSPOSE4_PS( block.x, block.y, block.z, block.w );
+		_mm_storeu_ps( components + 0,  block.x );
+		_mm_storeu_ps( components + 4,  block.y );
+		_mm_storeu_ps( components + 8,  block.z );
+		_mm_storeu_ps( components + 12, block.w );
+	}
+
+	static Vector3Block LoadVector3Block( const Vector3* vectors )
+	{
+		const float* components = reinterpret_cast< const float* >( vectors );
+
+		return
+		{
+			_mm_setr_ps( components[ 0 ], components[ 3 ], components[ 6 ], components[ 9  ] ),
+			_mm_setr_ps( components[ 1 ], components[ 4 ], components[ 7 ], components[ 10 ] ),
+			_mm_setr_ps( components[ 2 ], components[ 5 ], components[ 8 ], components[ 11 ] )
+		};
+	}
+
+	static void StoreVector3Block( Vector3* vectors, const Vector3Block& block )
+	{
+		float x[ 4 ], y[ 4 ], z[ 4 ];
+		_mm_storeu_ps( x, block.x );
+		_mm_storeu_ps( y, block.y );
+		_mm_storeu_ps( z, block.z );
+
+		float* components = reinterpret_cast< float* >( vectors );
+		for( auto i = 0; i < 4; i++ )
+		{
+			components[ i * 3 + 0 ] = x[ i ];
+			components[ i * 3 + 1 ] = y[ i ];
+			components[ i * 3 + 2 ] = z[ i ];
+		}
+	}
+
+	/* Same order of operations as Dot( q1, q2 ). */
+	static __m128 DotBlock( const QuaternionBlock& q1, const QuaternionBlock& q2 )
+	{
+		const __m128 xyz_dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( q1.x, q2.x ), _mm_mul_ps( q1.y, q2.y ) ), _mm_mul_ps( q1.z, q2.z ) );
+		return _mm_add_ps( _mm_mul_ps( q1.w, q2.w ), xyz_dot );
+	}
+
+	static QuaternionBlock ScaleBlock( const QuaternionBlock& q, const __m128 scalar )
+	{
+		return { _mm_mul_ps( q.x, scalar ), _mm_mul_ps( q.y, scalar ), _mm_mul_ps( q.z, scalar ), _mm_mul_ps( q.w, scalar ) };
+	}
+
+	static QuaternionBlock AddBlock( const QuaternionBlock& q1, const QuaternionBlock& q2 )
+	{
+		return { _mm_add_ps( q1.x, q2.x ), _mm_add_ps( q1.y, q2.y ), _mm_add_ps( q1.z, q2.z ), _mm_add_ps( q1.w, q2.w ) };
+	}
+
+	/* Same as Quaternion::Normalized(); Multiplies by the reciprocal of the magnitude. */
+	static QuaternionBlock NormalizedBlock( const QuaternionBlock& q )
+	{
+		return ScaleBlock( q, _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( DotBlock( q, q ) ) ) );
+	}
+
+	/* Same as Quaternion::operator*(): [ w1 * v2 + w2 * v1 + v1 x v2, w1 * w2 - v1 . v2 ]. */
+	static QuaternionBlock MultiplyBlock( const QuaternionBlock& q1, const QuaternionBlock& q2 )
+	{
+		const __m128 cross_x = _mm_sub_ps( _mm_mul_ps( q1.y, q2.z ), _mm_mul_ps( q1.z, q2.y ) );
+		const __m128 cross_y = _mm_sub_ps( _mm_mul_ps( q1.z, q2.x ), _mm_mul_ps( q1.x, q2.z ) );
+		const __m128 cross_z = _mm_sub_ps( _mm_mul_ps( q1.x, q2.y ), _mm_mul_ps( q1.y, q2.x ) );
+
+		const __m128 xyz_dot = _mm_add_ps( _mm_add_ps( _mm_mul_ps( q1.x, q2.x ), _mm_mul_ps( q1.y, q2.y ) ), _mm_mul_ps( q1.z, q2.z ) );
+
+		return
+		{
+			_mm_add_ps( _mm_add_ps( _mm_mul_ps( q1.w, q2.x ), _mm_mul_ps( q2.w, q1.x ) ), cross_x ),
+			_mm_add_ps( _mm_add_ps( _mm_mul_ps( q1.w, q2.y ), _mm_mul_ps( q2.w, q1.y ) ), cross_y ),
+			_mm_add_ps( _mm_add_ps( _mm_mul_ps( q1.w, q2.z ), _mm_mul_ps( q2.w, q1.z ) ), cross_z ),
+			_mm_sub_ps( _mm_mul_ps( q1.w, q2.w ), xyz_dot )
+		};
+	}
+
+	/* Same as Quaternion::Transform(): t = 2 * ( q.xyz x v ), v' = v + w * t - t x q.xyz. */
+	static Vector3Block RotateBlock( const QuaternionBlock& q, const Vector3Block& v )
+	{
+		const __m128 two = _mm_set1_ps( 2.0f );
+
+		const __m128 t_x = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( q.y, v.z ), _mm_mul_ps( q.z, v.y ) ) );
+		const __m128 t_y = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( q.z, v.x ), _mm_mul_ps( q.x, v.z ) ) );
+		const __m128 t_z = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( q.x, v.y ), _mm_mul_ps( q.y, v.x ) ) );
+
+		return
+		{
+			_mm_sub_ps( _mm_add_ps( v.x, _mm_mul_ps( q.w, t_x ) ), _mm_sub_ps( _mm_mul_ps( t_y, q.z ), _mm_mul_ps( t_z, q.y ) ) ),
+			_mm_sub_ps( _mm_add_ps( v.y, _mm_mul_ps( q.w, t_y ) ), _mm_sub_ps( _mm_mul_ps( t_z, q.x ), _mm_mul_ps( t_x, q.z ) ) ),
+			_mm_sub_ps( _mm_add_ps( v.z, _mm_mul_ps( q.w, t_z ) ), _mm_sub_ps( _mm_mul_ps( t_x, q.y ), _mm_mul_ps( t_y, q.x ) ) )
+		};
+	}
+
+	/* Same expressions as QuaternionToMatrix3x3(); Rows of the 4 matrices, transposed to a register per element of a row (with a zero 4th element). */
+	static void QuaternionBlockToMatrixRows( const QuaternionBlock& q, __m128 ( &rows )[ 3 ][ 4 ] )
+	{
+		const __m128 one = _mm_set1_ps( 1.0f );
+		const __m128 two = _mm_set1_ps( 2.0f );
+
+		const __m128 two_x2  = _mm_mul_ps( _mm_mul_ps( two, q.x ), q.x );
+		const __m128 two_y2  = _mm_mul_ps( _mm_mul_ps( two, q.y ), q.y );
+		const __m128 two_z2  = _mm_mul_ps( _mm_mul_ps( two, q.z ), q.z );
+		const __m128 two_x_y = _mm_mul_ps( _mm_mul_ps( two, q.x ), q.y );
+		const __m128 two_x_z = _mm_mul_ps( _mm_mul_ps( two, q.x ), q.z );
+		const __m128 two_y_z = _mm_mul_ps( _mm_mul_ps( two, q.y ), q.z );
+		const __m128 two_w_x = _mm_mul_ps( _mm_mul_ps( two, q.w ), q.x );
+		const __m128 two_w_y = _mm_mul_ps( _mm_mul_ps( two, q.w ), q.y );
+		const __m128 two_w_z = _mm_mul_ps( _mm_mul_ps( two, q.w ), q.z );
+
+		const __m128 zero = _mm_setzero_ps();
+
+		rows[ 0 ][ 0 ] = _mm_sub_ps( _mm_sub_ps( one, two_y2 ), two_z2 );
+		rows[ 0 ][ 1 ] = _mm_add_ps( two_x_y, two_w_z );
+		rows[ 0 ][ 2 ] = _mm_sub_ps( two_x_z, two_w_y );
+		rows[ 0 ][ 3 ] = zero;
+
+		rows[ 1 ][ 0 ] = _mm_sub_ps( two_x_y, two_w_z );
+		rows[ 1 ][ 1 ] = _mm_sub_ps( _mm_sub_ps( one, two_x2 ), two_z2 );
+		rows[ 1 ][ 2 ] = _mm_add_ps( two_y_z, two_w_x );
+		rows[ 1 ][ 3 ] = zero;
+
+		rows[ 2 ][ 0 ] = _mm_add_ps( two_x_z, two_w_y );
+		rows[ 2 ][ 1 ] = _mm_sub_ps( two_y_z, two_w_x );
+		rows[ 2 ][ 2 ] = _mm_sub_ps( _mm_sub_ps( one, two_x2 ), two_y2 );
+		rows[ 2 ][ 3 ] = zero;
+
+		/* Lanes -> elements; rows[ r ][ k ] then is the row r of the matrix of element k. */
+		for( auto& row : rows )
+			_MM_TRANSPOSE4_PS( row[ 0 ], row[ 1 ], row[ 2 ], row[ 3 ] );
+	}
+#endif // ENGINE_MATH_SIMD_SSE
+
+	void Normalize( std::span< Quaternion< float > > quaternions )
+	{
+		ForEachBlockOf4( quaternions.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreQuaternionBlock( quaternions.data() + index, NormalizedBlock( LoadQuaternionBlock( quaternions.data() + index ) ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 quaternions[ index ].Normalize();
+						 } );
+	}
+
+	void Multiply( std::span< const Quaternion< float > > lhs, std::span< const Quaternion< float > > rhs, std::span< Quaternion< float > > result )
+	{
+		ASSERT_DEBUG_ONLY( lhs.size() == rhs.size() && result.size() >= lhs.size() && "Math::Multiply(): Span sizes do not match!" );
+
+		ForEachBlockOf4( lhs.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreQuaternionBlock( result.data() + index, MultiplyBlock( LoadQuaternionBlock( lhs.data() + index ), LoadQuaternionBlock( rhs.data() + index ) ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = lhs[ index ] * rhs[ index ];
+						 } );
+	}
+
+	void Multiply( const Quaternion< float >& lhs, std::span< const Quaternion< float > > rhs, std::span< Quaternion< float > > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= rhs.size() && "Math::Multiply(): Span sizes do not match!" );
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const auto lhs_block = BroadcastQuaternion( lhs );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		ForEachBlockOf4( rhs.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreQuaternionBlock( result.data() + index, MultiplyBlock( lhs_block, LoadQuaternionBlock( rhs.data() + index ) ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = lhs * rhs[ index ];
+						 } );
+	}
+
+	void Multiply( std::span< const Quaternion< float > > lhs, const Quaternion< float >& rhs, std::span< Quaternion< float > > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= lhs.size() && "Math::Multiply(): Span sizes do not match!" );
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const auto rhs_block = BroadcastQuaternion( rhs );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		ForEachBlockOf4( lhs.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreQuaternionBlock( result.data() + index, MultiplyBlock( LoadQuaternionBlock( lhs.data() + index ), rhs_block ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = lhs[ index ] * rhs;
+						 } );
+	}
+
+	void Nlerp( std::span< const Quaternion< float > > q1, std::span< const Quaternion< float > > q2, const float t, std::span< Quaternion< float > > result )
+	{
+		ASSERT_DEBUG_ONLY( q1.size() == q2.size() && result.size() >= q1.size() && "Math::Nlerp(): Span sizes do not match!" );
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const __m128 weight_1 = _mm_set1_ps( 1.0f - t );
+		const __m128 weight_2 = _mm_set1_ps( t );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		ForEachBlockOf4( q1.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 const auto lerped = AddBlock( ScaleBlock( LoadQuaternionBlock( q1.data() + index ), weight_1 ),
+														   ScaleBlock( LoadQuaternionBlock( q2.data() + index ), weight_2 ) );
+							 StoreQuaternionBlock( result.data() + index, NormalizedBlock( lerped ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = Math::Nlerp( q1[ index ], q2[ index ], t );
+						 } );
+	}
+
+	void Slerp( std::span< const Quaternion< float > > q1, std::span< const Quaternion< float > > q2, const float t, std::span< Quaternion< float > > result )
+	{
+		ASSERT_DEBUG_ONLY( q1.size() == q2.size() && result.size() >= q1.size() && "Math::Slerp(): Span sizes do not match!" );
+
+		ForEachBlockOf4( q1.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 const auto block_1 = LoadQuaternionBlock( q1.data() + index );
+							 auto block_2       = LoadQuaternionBlock( q2.data() + index );
+
+							 const __m128 dot = DotBlock( block_1, block_2 );
+
+							 /* Negate q2 where the dot product is negative, to take the shorter 4D "arc". */
+							 const __m128 dot_sign = _mm_and_ps( dot, _mm_set1_ps( -0.0f ) );
+							 block_2 = { _mm_xor_ps( block_2.x, dot_sign ), _mm_xor_ps( block_2.y, dot_sign ), _mm_xor_ps( block_2.z, dot_sign ), _mm_xor_ps( block_2.w, dot_sign ) };
+
+							 /* The weights need trigonometric functions, which are done per-lane; The rest stays vectorized. */
+							 float cos_theta[ 4 ], weights_1[ 4 ], weights_2[ 4 ], scales[ 4 ];
+							 _mm_storeu_ps( cos_theta, _mm_andnot_ps( _mm_set1_ps( -0.0f ), dot ) );
+
+							 int nlerp_lane_mask = 0;
+							 for( auto lane = 0; lane < 4; lane++ )
+							 {
+								 if( cos_theta[ lane ] > TypeTraits< float >::OneMinusEpsilon() )
+								 {
+									 /* Quaternions are too close; Revert back to a simple Nlerp(). */
+									 weights_1[ lane ] = 1.0f - t;
+									 weights_2[ lane ] = t;
+									 scales[ lane ]    = 1.0f;
+									 nlerp_lane_mask  |= 1 << lane;
+								 }
+								 else
+								 {
+									 const Radians theta( Atan2( SinFromCos( cos_theta[ lane ] ), cos_theta[ lane ] ) );
+
+									 weights_1[ lane ] = Sin( ( 1.0f - t ) * theta );
+									 weights_2[ lane ] = Sin( t * theta );
+									 scales[ lane ]    = 1.0f / Sin( theta );
+								 }
+							 }
+
+							 auto slerped = ScaleBlock( AddBlock( ScaleBlock( block_1, _mm_loadu_ps( weights_1 ) ), ScaleBlock( block_2, _mm_loadu_ps( weights_2 ) ) ),
+														_mm_loadu_ps( scales ) );
+
+							 if( nlerp_lane_mask != 0 )
+							 {
+								 const auto normalized = NormalizedBlock( slerped );
+								 const __m128 mask = _mm_castsi128_ps( _mm_setr_epi32( nlerp_lane_mask & 1 ? -1 : 0, nlerp_lane_mask & 2 ? -1 : 0,
+																					   nlerp_lane_mask & 4 ? -1 : 0, nlerp_lane_mask & 8 ? -1 : 0 ) );
+								 const auto Select = [ & ]( const __m128 if_set, const __m128 if_not_set ) { return _mm_or_ps( _mm_and_ps( mask, if_set ), _mm_andnot_ps( mask, if_not_set ) ); };
+
+								 slerped = { Select( normalized.x, slerped.x ), Select( normalized.y, slerped.y ), Select( normalized.z, slerped.z ), Select( normalized.w, slerped.w ) };
+							 }
+
+							 StoreQuaternionBlock( result.data() + index, slerped );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = Math::Slerp( q1[ index ], q2[ index ], t );
+						 } );
+	}
+
+	void Rotate( std::span< const Quaternion< float > > rotations, std::span< const Vector3 > vectors, std::span< Vector3 > result )
+	{
+		ASSERT_DEBUG_ONLY( rotations.size() == vectors.size() && result.size() >= vectors.size() && "Math::Rotate(): Span sizes do not match!" );
+
+		ForEachBlockOf4( vectors.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreVector3Block( result.data() + index, RotateBlock( LoadQuaternionBlock( rotations.data() + index ), LoadVector3Block( vectors.data() + index ) ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = rotations[ index ].Transform( vectors[ index ] );
+						 } );
+	}
+
+	void Rotate( const Quaternion< float >& rotation, std::span< const Vector3 > vectors, std::span< Vector3 > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= vectors.size() && "Math::Rotate(): Span sizes do not match!" );
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		const auto rotation_block = BroadcastQuaternion( rotation );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		ForEachBlockOf4( vectors.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 StoreVector3Block( result.data() + index, RotateBlock( rotation_block, LoadVector3Block( vectors.data() + index ) ) );
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = rotation.Transform( vectors[ index ] );
+						 } );
+	}
+
+	void QuaternionToMatrix( std::span< const Quaternion< float > > quaternions, std::span< Matrix4x4 > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= quaternions.size() && "Math::QuaternionToMatrix(): Span sizes do not match!" );
+
+		ForEachBlockOf4( quaternions.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 __m128 rows[ 3 ][ 4 ];
+							 QuaternionBlockToMatrixRows( LoadQuaternionBlock( quaternions.data() + index ), rows );
+
+							 for( auto k = 0; k < 4; k++ )
+							 {
+								 float* elements = reinterpret_cast< float* >( result.data() + index + k );
+								 _mm_storeu_ps( elements + 0,  rows[ 0 ][ k ] );
+								 _mm_storeu_ps( elements + 4,  rows[ 1 ][ k ] );
+								 _mm_storeu_ps( elements + 8,  rows[ 2 ][ k ] );
+								 _mm_storeu_ps( elements + 12, _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f ) );
+							 }
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = Math::QuaternionToMatrix( quaternions[ index ] );
+						 } );
+	}
+
+	void QuaternionToMatrix3x3( std::span< const Quaternion< float > > quaternions, std::span< Matrix3x3 > result )
+	{
+		ASSERT_DEBUG_ONLY( result.size() >= quaternions.size() && "Math::QuaternionToMatrix3x3(): Span sizes do not match!" );
+
+		ForEachBlockOf4( quaternions.size(),
+#ifdef ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 __m128 rows[ 3 ][ 4 ];
+							 QuaternionBlockToMatrixRows( LoadQuaternionBlock( quaternions.data() + index ), rows );
+
+							 for( auto k = 0; k < 4; k++ )
+							 {
+								 /* The 4-wide stores of the first two rows spill into the next row, which is written right after; The last row is stored as 2 + 1 floats. */
+								 float* elements = reinterpret_cast< float* >( result.data() + index + k );
+								 _mm_storeu_ps( elements + 0, rows[ 0 ][ k ] );
+								 _mm_storeu_ps( elements + 3, rows[ 1 ][ k ] );
+								 _mm_storel_pi( reinterpret_cast< __m64* >( elements + 6 ), rows[ 2 ][ k ] );
+								 _mm_store_ss( elements + 8, _mm_movehl_ps( rows[ 2 ][ k ], rows[ 2 ][ k ] ) );
+							 }
+						 },
+#else
+						 []( const std::size_t ) {},
+#endif // ENGINE_MATH_SIMD_SSE
+						 [ & ]( const std::size_t index )
+						 {
+							 result[ index ] = Math::QuaternionToMatrix3x3( quaternions[ index ] );
+						 } );
+	}
+}
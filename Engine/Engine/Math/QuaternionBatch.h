@@ -0,0 +1,38 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/Vector.hpp"
+
+// std Includes.
+#include <span>
+
+namespace Engine::Math
+{
+	/* Batched counterparts of the scalar Quaternion operations, for animation/particle workloads operating on many quaternions at once.
+	 * Work is done 4 quaternions at a time with SIMD (transposed into one register per component), with the remainder falling back to the scalar operations.
+	 * Results match the scalar operations (barring the last bit or so for Slerp(), due to the order of operations).
+	 * Result spans have to be (at least) as large as the input spans & may alias the inputs (i.e., in-place operation is fine). */
+
+	void Normalize( std::span< Quaternion< float > > quaternions );
+
+	/* result[ i ] = lhs[ i ] * rhs[ i ]. */
+	void Multiply( std::span< const Quaternion< float > > lhs, std::span< const Quaternion< float > > rhs, std::span< Quaternion< float > > result );
+	/* result[ i ] = lhs * rhs[ i ]. */
+	void Multiply( const Quaternion< float >& lhs, std::span< const Quaternion< float > > rhs, std::span< Quaternion< float > > result );
+	/* result[ i ] = lhs[ i ] * rhs. */
+	void Multiply( std::span< const Quaternion< float > > lhs, const Quaternion< float >& rhs, std::span< Quaternion< float > > result );
+
+	/* Assume unit quaternions. */
+	void Nlerp( std::span< const Quaternion< float > > q1, std::span< const Quaternion< float > > q2, const float t, std::span< Quaternion< float > > result );
+	void Slerp( std::span< const Quaternion< float > > q1, std::span< const Quaternion< float > > q2, const float t, std::span< Quaternion< float > > result );
+
+	/* Same as Quaternion::Transform(); Assumes unit quaternions. */
+	void Rotate( std::span< const Quaternion< float > > rotations, std::span< const Vector3 > vectors, std::span< Vector3 > result );
+	void Rotate( const Quaternion< float >& rotation, std::span< const Vector3 > vectors, std::span< Vector3 > result );
+
+	/* Same as QuaternionToMatrix() & QuaternionToMatrix3x3(); Assume unit quaternions. */
+	void QuaternionToMatrix( std::span< const Quaternion< float > > quaternions, std::span< Matrix4x4 > result );
+	void QuaternionToMatrix3x3( std::span< const Quaternion< float > > quaternions, std::span< Matrix3x3 > result );
+}
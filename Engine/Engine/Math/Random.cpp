@@ -0,0 +1,209 @@
+// Engine Includes.
+#include "Random.hpp"
+#include "Math/FastMath.hpp"
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <algorithm>
+#include <atomic>
+#include <random>
+
+namespace Engine::Math
+{
+	/* Seeds threads which have not called RandomGenerator::ThisThread() yet; Each thread also mixes in the order it first asked for its generator. */
+	static std::atomic< std::uint64_t > THREAD_SEED  = RandomGenerator::DEFAULT_SEED;
+	static std::atomic< std::uint64_t > THREAD_COUNT = 0;
+
+	/* Used to expand 64-bit seeds into full generator states, as recommended by the authors of xoshiro. */
+	static std::uint64_t SplitMix64( std::uint64_t& state )
+	{
+		std::uint64_t result = ( state += 0x9E3779B97F4A7C15ull );
+		result = ( result ^ ( result >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		result = ( result ^ ( result >> 27 ) ) * 0x94D049BB133111EBull;
+		return result ^ ( result >> 31 );
+	}
+
+	/* 4 xoshiro128+ streams run side by side; state[ word ][ stream ]. */
+	struct RandomStreams
+	{
+		alignas( 16 ) std::uint32_t state[ 4 ][ 4 ];
+	};
+
+	static RandomStreams SplitIntoStreams( RandomGenerator& generator )
+	{
+		RandomStreams streams;
+
+		for( auto stream = 0; stream < 4; stream++ )
+		{
+			std::uint64_t seed = ( std::uint64_t( generator.Next() ) << 32 ) | generator.Next();
+
+			const std::uint64_t low  = SplitMix64( seed );
+			const std::uint64_t high = SplitMix64( seed );
+
+			streams.state[ 0 ][ stream ] = std::uint32_t( low );
+			streams.state[ 1 ][ stream ] = std::uint32_t( low >> 32 );
+			streams.state[ 2 ][ stream ] = std::uint32_t( high );
+			streams.state[ 3 ][ stream ] = std::uint32_t( high >> 32 );
+		}
+
+		return streams;
+	}
+
+	/* Writes count floats in [min, max) to output, 4 at a time (one from each stream). Same formula as RandomGenerator::Generate< float >(). */
+	static void FillUniform( RandomGenerator& generator, float* output, const std::size_t count, const float min, const float max )
+	{
+		RandomStreams streams = SplitIntoStreams( generator );
+
+		const float range = max - min;
+
+		std::size_t index = 0;
+
+#ifdef ENGINE_MATH_SIMD_SSE
+		__m128i s0 = _mm_load_si128( reinterpret_cast< const __m128i* >( streams.state[ 0 ] ) );
+		__m128i s1 = _mm_load_si128( reinterpret_cast< const __m128i* >( streams.state[ 1 ] ) );
+		__m128i s2 = _mm_load_si128( reinterpret_cast< const __m128i* >( streams.state[ 2 ] ) );
+		__m128i s3 = _mm_load_si128( reinterpret_cast< const __m128i* >( streams.state[ 3 ] ) );
+
+		const __m128 min_4   = _mm_set1_ps( min );
+		const __m128 range_4 = _mm_set1_ps( range );
+		const __m128 scale_4 = _mm_set1_ps( 0x1.0p-24f );
+
+		for( ; index + 4 <= count; index += 4 )
+		{
+			const __m128i result = _mm_add_epi32( s0, s3 );
+			const __m128i t      = _mm_slli_epi32( s1, 9 );
+
+			s2 = _mm_xor_si128( s2, s0 );
+			s3 = _mm_xor_si128( s3, s1 );
+			s1 = _mm_xor_si128( s1, s2 );
+			s0 = _mm_xor_si128( s0, s3 );
+			s2 = _mm_xor_si128( s2, t );
+			s3 = _mm_or_si128( _mm_slli_epi32( s3, 11 ), _mm_srli_epi32( s3, 21 ) );
+
+			const __m128 unit = _mm_mul_ps( _mm_cvtepi32_ps( _mm_srli_epi32( result, 8 ) ), scale_4 );
+			_mm_storeu_ps( output + index, _mm_add_ps( min_4, _mm_mul_ps( range_4, unit ) ) );
+		}
+
+		_mm_store_si128( reinterpret_cast< __m128i* >( streams.state[ 0 ] ), s0 );
+		_mm_store_si128( reinterpret_cast< __m128i* >( streams.state[ 1 ] ), s1 );
+		_mm_store_si128( reinterpret_cast< __m128i* >( streams.state[ 2 ] ), s2 );
+		_mm_store_si128( reinterpret_cast< __m128i* >( streams.state[ 3 ] ), s3 );
+#endif // ENGINE_MATH_SIMD_SSE
+
+		/* Remaining elements (or all of them, if SIMD is not available); Steps all 4 streams at once, to produce the same values as the SIMD path. */
+		for( ; index < count; index += 4 )
+		{
+			auto& [ word_0, word_1, word_2, word_3 ] = streams.state;
+
+			for( auto stream = 0; stream < 4; stream++ )
+			{
+				const std::uint32_t result = word_0[ stream ] + word_3[ stream ];
+				const std::uint32_t t      = word_1[ stream ] << 9;
+
+				word_2[ stream ] ^= word_0[ stream ];
+				word_3[ stream ] ^= word_1[ stream ];
+				word_1[ stream ] ^= word_2[ stream ];
+				word_0[ stream ] ^= word_3[ stream ];
+				word_2[ stream ] ^= t;
+				word_3[ stream ] = ( word_3[ stream ] << 11 ) | ( word_3[ stream ] >> 21 );
+
+				if( index + stream < count )
+					output[ index + stream ] = min + range * ( float( result >> 8 ) * 0x1.0p-24f );
+			}
+		}
+	}
+
+	/* Shoemake's method; u1, u2 & u3 in [0, 1). */
+	static Quaternion< float > UnitQuaternionFromUniform( const float u1, const float u2, const float u3 )
+	{
+		const float a = Math::Sqrt( 1.0f - u1 );
+		const float b = Math::Sqrt( u1 );
+
+		float sin_1, cos_1, sin_2, cos_2;
+		Fast::SinCos( Radians< float >( Constants< float >::Two_Pi() * u2 ), sin_1, cos_1 );
+		Fast::SinCos( Radians< float >( Constants< float >::Two_Pi() * u3 ), sin_2, cos_2 );
+
+		return Quaternion< float >( a * sin_1, a * cos_1, b * sin_2, b * cos_2 );
+	}
+
+	RandomGenerator::RandomGenerator( const std::uint64_t seed )
+	{
+		std::uint64_t split_mix_state = seed;
+
+		const std::uint64_t low  = SplitMix64( split_mix_state );
+		const std::uint64_t high = SplitMix64( split_mix_state );
+
+		state[ 0 ] = std::uint32_t( low );
+		state[ 1 ] = std::uint32_t( low >> 32 );
+		state[ 2 ] = std::uint32_t( high );
+		state[ 3 ] = std::uint32_t( high >> 32 );
+	}
+
+	RandomGenerator RandomGenerator::ForJob( const std::uint64_t seed, const std::uint64_t job_index )
+	{
+		/* Mixing the job index first keeps the SplitMix64 sequences of neighbouring jobs from overlapping. */
+		std::uint64_t job_state = job_index;
+		return RandomGenerator( seed ^ SplitMix64( job_state ) );
+	}
+
+	RandomGenerator& RandomGenerator::ThisThread()
+	{
+		thread_local RandomGenerator generator( ForJob( THREAD_SEED.load( std::memory_order_relaxed ), THREAD_COUNT.fetch_add( 1, std::memory_order_relaxed ) ) );
+		return generator;
+	}
+
+	void RandomGenerator::SeedThreads( const std::uint64_t seed )
+	{
+		THREAD_SEED.store( seed, std::memory_order_relaxed );
+		ThisThread() = ForJob( seed, 0 );
+	}
+
+	Quaternion< float > RandomGenerator::GenerateUnitQuaternion()
+	{
+		const float u1 = Generate< float >();
+		const float u2 = Generate< float >();
+		const float u3 = Generate< float >();
+
+		return UnitQuaternionFromUniform( u1, u2, u3 );
+	}
+
+	void RandomGenerator::Fill( std::span< float > values, const float min, const float max )
+	{
+		FillUniform( *this, values.data(), values.size(), min, max );
+	}
+
+	void RandomGenerator::Fill( std::span< Vector3 > vectors, const Vector3& min, const Vector3& max )
+	{
+		static_assert( sizeof( Vector3 ) == sizeof( float ) * 3 );
+
+		FillUniform( *this, reinterpret_cast< float* >( vectors.data() ), vectors.size() * 3, 0.0f, 1.0f );
+
+		const Vector3 range( max - min );
+
+		for( auto& vector : vectors )
+			vector = min + range * vector;
+	}
+
+	void RandomGenerator::FillUnitQuaternions( std::span< Quaternion< float > > quaternions )
+	{
+		/* Uniform values are generated in batches, to keep them in cache until they are consumed. */
+		constexpr std::size_t BATCH_SIZE = 256;
+
+		float uniform[ BATCH_SIZE * 3 ];
+
+		for( std::size_t batch_start = 0; batch_start < quaternions.size(); batch_start += BATCH_SIZE )
+		{
+			const std::size_t batch_count = std::min( BATCH_SIZE, quaternions.size() - batch_start );
+
+			FillUniform( *this, uniform, batch_count * 3, 0.0f, 1.0f );
+
+			for( std::size_t index = 0; index < batch_count; index++ )
+				quaternions[ batch_start + index ] = UnitQuaternionFromUniform( uniform[ index * 3 + 0 ], uniform[ index * 3 + 1 ], uniform[ index * 3 + 2 ] );
+		}
+	}
+
+	void Random::SeedRandom()
+	{
+		RandomGenerator::SeedThreads( ( std::uint64_t( std::random_device()() ) << 32 ) | std::random_device()() );
+	}
+}
@@ -2,62 +2,88 @@
 
 // Engince Includes.
 #include "Concepts.h"
+#include "Quaternion.hpp"
 #include "Vector.hpp"
 #include "Graphics/Color.hpp"
 
 // std Includes.
-#include <random>
+#include <array>
+#include <cstdint>
+#include <span>
 
 namespace Engine::Math
 {
-	// Singleton.
-	class Random
+	/* xoshiro128+ generator; 16 bytes of state & cheap to construct, so each thread/job should own one instead of sharing one between threads.
+	 * Only the upper bits of the output (which are of full quality for xoshiro128+) are used for floating point values. */
+	class RandomGenerator
 	{
 	public:
-		DELETE_COPY_AND_MOVE_CONSTRUCTORS( Random );
+		static constexpr std::uint64_t DEFAULT_SEED = 0x853C49E6748FEA9Bull;
 
-		static void Seed( const unsigned int seed )
-		{
-			Instance( seed );
-		}
+		explicit RandomGenerator( const std::uint64_t seed = DEFAULT_SEED );
+
+		DEFAULT_COPY_AND_MOVE_CONSTRUCTORS( RandomGenerator );
+
+		/* Deterministic per-job seeding: The same seed & job_index always produce the same sequence, regardless of which thread runs the job.
+		 * Different job indices produce unrelated sequences. */
+		static RandomGenerator ForJob( const std::uint64_t seed, const std::uint64_t job_index );
+
+		/* The calling thread's own generator. Threads are seeded in the order they first call this, so prefer ForJob() when reproducibility matters. */
+		static RandomGenerator& ThisThread();
+
+		/* Sets the seed used for threads that have not called ThisThread() yet & reseeds the calling thread's generator. */
+		static void SeedThreads( const std::uint64_t seed );
 
-		static void SeedRandom()
+		inline std::uint32_t Next()
 		{
-			Instance( std::random_device()( ) );
+			const std::uint32_t result = state[ 0 ] + state[ 3 ];
+			const std::uint32_t t      = state[ 1 ] << 9;
+
+			state[ 2 ] ^= state[ 0 ];
+			state[ 3 ] ^= state[ 1 ];
+			state[ 1 ] ^= state[ 2 ];
+			state[ 0 ] ^= state[ 3 ];
+			state[ 2 ] ^= t;
+			state[ 3 ] = ( state[ 3 ] << 11 ) | ( state[ 3 ] >> 21 );
+
+			return result;
 		}
 
+		/* Integers are generated in [min, max], floating point values in [min, max). */
 		template< Concepts::Arithmetic Type >
-		static Type Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
+		Type Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
 		{
-			auto& instance = Instance();
-
 			if constexpr( std::is_integral_v< Type > )
 			{
-				std::uniform_int_distribution< Type > uniform_dist( min, max );
-				return uniform_dist( instance.engine );
+				using UnsignedType = std::make_unsigned_t< Type >;
+
+				const std::uint64_t range = std::uint64_t( UnsignedType( max ) - UnsignedType( min ) ) + 1;
+
+				if( range == 0 ) // Full range of a 64-bit type.
+					return Type( Next64() );
+
+				/* Lemire's multiply-shift for 32-bit ranges; Its bias (range / 2^32 at most) is negligible for the engine's purposes, as is the modulo bias for larger ones. */
+				if( range <= std::uint64_t( 1 ) << 32 )
+					return Type( UnsignedType( min ) + UnsignedType( ( std::uint64_t( Next() ) * range ) >> 32 ) );
+
+				return Type( UnsignedType( min ) + UnsignedType( Next64() % range ) );
 			}
+			else if constexpr( std::is_same_v< Type, float > )
+				return min + ( max - min ) * ( float( Next() >> 8 ) * 0x1.0p-24f );
 			else
-			{
-				std::uniform_real_distribution< Type > uniform_dist( min, max );
-				return uniform_dist( instance.engine );
-			}
+				return min + ( max - min ) * ( Type( Next64() >> 11 ) * Type( 0x1.0p-53 ) );
 		}
 
 		template< Concepts::Angular AngleType >
-		static AngleType Generate( const AngleType min = AngleType( 0 ), const AngleType max = AngleType( 1 ) )
+		AngleType Generate( const AngleType min = AngleType( 0 ), const AngleType max = AngleType( 1 ) )
 		{
-			auto& instance = Instance();
-
-			std::uniform_real_distribution< AngleType::UnderlyingType > uniform_dist( min.Value(), max.Value() );
-			return AngleType( uniform_dist( instance.engine ) );
+			return AngleType( Generate( min.Value(), max.Value() ) );
 		}
 
 		template< typename VectorType > requires( VectorType::Dimension() > 1 )
-		static VectorType Generate( const VectorType& min = VectorType::Zero(), 
-									const VectorType& max = VectorType::One() )
+		VectorType Generate( const VectorType& min = VectorType::Zero(),
+							 const VectorType& max = VectorType::One() )
 		{
-			auto& instance = Instance();
-
 			VectorType vector;
 
 			for( auto i = 0; i < VectorType::Dimension(); i++ )
@@ -67,10 +93,8 @@ namespace Engine::Math
 		}
 
 		template< Concepts::Arithmetic Type, std::size_t Length >
-		static std::array< Type, Length > Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
+		std::array< Type, Length > Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
 		{
-			auto& instance = Instance();
-
 			std::array< Type, Length > result;
 
 			for( auto i = 0; i < Length; i++ )
@@ -79,20 +103,78 @@ namespace Engine::Math
 			return result;
 		}
 
+		/* Uniformly distributed over all rotations. */
+		Quaternion< float > GenerateUnitQuaternion();
+
+	/* Bulk Generation: */
+
+		/* These run 4 streams (derived from this generator's state) side by side with SIMD.
+		 * Results are identical with or without SIMD, but differ from calling Generate() repeatedly. */
+
+		void Fill( std::span< float > values, const float min = 0.0f, const float max = 1.0f );
+
+		template< Concepts::Angular AngleType > requires( std::is_same_v< typename AngleType::UnderlyingType, float > )
+		void Fill( std::span< AngleType > angles, const AngleType min, const AngleType max )
+		{
+			static_assert( sizeof( AngleType ) == sizeof( float ) );
+			Fill( std::span< float >( reinterpret_cast< float* >( angles.data() ), angles.size() ), min.Value(), max.Value() );
+		}
+
+		void Fill( std::span< Vector3 > vectors, const Vector3& min = Vector3::Zero(), const Vector3& max = Vector3::One() );
+
+		/* Uniformly distributed over all rotations. */
+		void FillUnitQuaternions( std::span< Quaternion< float > > quaternions );
+
 	private:
-		Random( const unsigned int seed )
-			:
-			engine( seed )
-		{}
+		inline std::uint64_t Next64()
+		{
+			const std::uint64_t high = Next();
+			return ( high << 32 ) | Next();
+		}
 
-		static Random& Instance( const unsigned int seed = std::default_random_engine::default_seed )
+	private:
+		std::uint32_t state[ 4 ];
+	};
+
+	/* Convenience interface to the calling thread's RandomGenerator; Safe to call from multiple threads at once. */
+	class Random
+	{
+	public:
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( Random );
+
+		static void Seed( const unsigned int seed )
+		{
+			RandomGenerator::SeedThreads( seed );
+		}
+
+		static void SeedRandom();
+
+		template< Concepts::Arithmetic Type >
+		static Type Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
+		{
+			return RandomGenerator::ThisThread().Generate( min, max );
+		}
+
+		template< Concepts::Angular AngleType >
+		static AngleType Generate( const AngleType min = AngleType( 0 ), const AngleType max = AngleType( 1 ) )
+		{
+			return RandomGenerator::ThisThread().Generate( min, max );
+		}
+
+		template< typename VectorType > requires( VectorType::Dimension() > 1 )
+		static VectorType Generate( const VectorType& min = VectorType::Zero(),
+									const VectorType& max = VectorType::One() )
+		{
+			return RandomGenerator::ThisThread().Generate( min, max );
+		}
+
+		template< Concepts::Arithmetic Type, std::size_t Length >
+		static std::array< Type, Length > Generate( const Type min = Type( 0 ), const Type max = Type( 1 ) )
 		{
-			static Random instance( seed );
-			return instance;
+			return RandomGenerator::ThisThread().Generate< Type, Length >( min, max );
 		}
 
 	private:
-		std::random_device device;
-		std::default_random_engine engine;
+		Random() = delete;
 	};
 }
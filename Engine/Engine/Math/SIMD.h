@@ -0,0 +1,215 @@
+#pragma once
+
+/* SSE is part of every x64 target; AVX kernels are used when the compiler targets it (/arch:AVX or higher on MSVC, -mavx on GCC/Clang).
+ * NEON kernels have to be opted into by defining ENGINE_MATH_SIMD_ENABLE_NEON, as they are not exercised by the Windows builds. */
+#if defined( _M_X64 ) || defined( __x86_64__ ) || defined( __SSE2__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define ENGINE_MATH_SIMD_SSE
+#include <immintrin.h>
+#elif defined( ENGINE_MATH_SIMD_ENABLE_NEON ) && ( defined( _M_ARM64 ) || defined( __aarch64__ ) )
+#define ENGINE_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined( ENGINE_MATH_SIMD_SSE ) || defined( ENGINE_MATH_SIMD_NEON )
+#define ENGINE_MATH_SIMD
+#endif
+
+#ifdef ENGINE_MATH_SIMD
+
+namespace Engine::Math::SIMD
+{
+	/* Kernels for the hot Matrix operations (see Matrix.hpp), operating on row-major float arrays of any alignment.
+	 * Products are summed in the same order as the scalar loops & no fused multiply-adds are used, so results match the scalar path (barring the sign of zero). */
+
+	/* result = left * right; 4x4 matrices. result may not alias the inputs. */
+	inline void Multiply_4x4_4x4( const float* left, const float* right, float* result )
+	{
+#if defined( ENGINE_MATH_SIMD_SSE ) && defined( __AVX__ )
+		/* Two rows of the result at a time; Each 128-bit lane works on one row. */
+		const __m256 right_row_0 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( right + 0  ) );
+		const __m256 right_row_1 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( right + 4  ) );
+		const __m256 right_row_2 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( right + 8  ) );
+		const __m256 right_row_3 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( right + 12 ) );
+
+		for( int row = 0; row < 4; row += 2 )
+		{
+			const __m256 left_rows = _mm256_loadu_ps( left + row * 4 );
+
+			__m256 result_rows =                         _mm256_mul_ps( _mm256_permute_ps( left_rows, 0x00 ), right_row_0 );
+			result_rows = _mm256_add_ps( result_rows,    _mm256_mul_ps( _mm256_permute_ps( left_rows, 0x55 ), right_row_1 ) );
+			result_rows = _mm256_add_ps( result_rows,    _mm256_mul_ps( _mm256_permute_ps( left_rows, 0xAA ), right_row_2 ) );
+			result_rows = _mm256_add_ps( result_rows,    _mm256_mul_ps( _mm256_permute_ps( left_rows, 0xFF ), right_row_3 ) );
+
+			_mm256_storeu_ps( result + row * 4, result_rows );
+		}
+#elif defined( ENGINE_MATH_SIMD_SSE )
+		const __m128 right_row_0 = _mm_loadu_ps( right + 0  );
+		const __m128 right_row_1 = _mm_loadu_ps( right + 4  );
+		const __m128 right_row_2 = _mm_loadu_ps( right + 8  );
+		const __m128 right_row_3 = _mm_loadu_ps( right + 12 );
+
+		for( int row = 0; row < 4; row++ )
+		{
+			const float* left_row = left + row * 4;
+
+			__m128 result_row =                       _mm_mul_ps( _mm_set1_ps( left_row[ 0 ] ), right_row_0 );
+			result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( left_row[ 1 ] ), right_row_1 ) );
+			result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( left_row[ 2 ] ), right_row_2 ) );
+			result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( left_row[ 3 ] ), right_row_3 ) );
+
+			_mm_storeu_ps( result + row * 4, result_row );
+		}
+#elif defined( ENGINE_MATH_SIMD_NEON )
+		const float32x4_t right_row_0 = vld1q_f32( right + 0  );
+		const float32x4_t right_row_1 = vld1q_f32( right + 4  );
+		const float32x4_t right_row_2 = vld1q_f32( right + 8  );
+		const float32x4_t right_row_3 = vld1q_f32( right + 12 );
+
+		for( int row = 0; row < 4; row++ )
+		{
+			const float* left_row = left + row * 4;
+
+			/* Not vmlaq/vfmaq; Separate multiplies & adds keep the results identical to the scalar path. */
+			float32x4_t result_row =                 vmulq_n_f32( right_row_0, left_row[ 0 ] );
+			result_row = vaddq_f32( result_row,      vmulq_n_f32( right_row_1, left_row[ 1 ] ) );
+			result_row = vaddq_f32( result_row,      vmulq_n_f32( right_row_2, left_row[ 2 ] ) );
+			result_row = vaddq_f32( result_row,      vmulq_n_f32( right_row_3, left_row[ 3 ] ) );
+
+			vst1q_f32( result + row * 4, result_row );
+		}
+#endif
+	}
+
+	/* result = vector * matrix; Row vector of 4 & a 4x4 matrix. result may alias vector. */
+	inline void Multiply_4_4x4( const float* vector, const float* matrix, float* result )
+	{
+#if defined( ENGINE_MATH_SIMD_SSE )
+		__m128 result_row =                       _mm_mul_ps( _mm_set1_ps( vector[ 0 ] ), _mm_loadu_ps( matrix + 0  ) );
+		result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( vector[ 1 ] ), _mm_loadu_ps( matrix + 4  ) ) );
+		result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( vector[ 2 ] ), _mm_loadu_ps( matrix + 8  ) ) );
+		result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( vector[ 3 ] ), _mm_loadu_ps( matrix + 12 ) ) );
+
+		_mm_storeu_ps( result, result_row );
+#elif defined( ENGINE_MATH_SIMD_NEON )
+		float32x4_t result_row =                 vmulq_n_f32( vld1q_f32( matrix + 0  ), vector[ 0 ] );
+		result_row = vaddq_f32( result_row,      vmulq_n_f32( vld1q_f32( matrix + 4  ), vector[ 1 ] ) );
+		result_row = vaddq_f32( result_row,      vmulq_n_f32( vld1q_f32( matrix + 8  ), vector[ 2 ] ) );
+		result_row = vaddq_f32( result_row,      vmulq_n_f32( vld1q_f32( matrix + 12 ), vector[ 3 ] ) );
+
+		vst1q_f32( result, result_row );
+#endif
+	}
+
+	/* result = vector * matrix; Row vector of 3 & a 3x3 matrix. result may alias vector.
+	 * Rows are loaded as 2 + 1 floats, as a 4-wide load of the last row would read past the matrix. */
+	inline void Multiply_3_3x3( const float* vector, const float* matrix, float* result )
+	{
+#if defined( ENGINE_MATH_SIMD_SSE )
+		const auto LoadRow = []( const float* row )
+		{
+			return _mm_movelh_ps( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast< const __m64* >( row ) ), _mm_load_ss( row + 2 ) );
+		};
+
+		__m128 result_row =                       _mm_mul_ps( _mm_set1_ps( vector[ 0 ] ), LoadRow( matrix + 0 ) );
+		result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( vector[ 1 ] ), LoadRow( matrix + 3 ) ) );
+		result_row = _mm_add_ps( result_row,      _mm_mul_ps( _mm_set1_ps( vector[ 2 ] ), LoadRow( matrix + 6 ) ) );
+
+		_mm_storel_pi( reinterpret_cast< __m64* >( result ), result_row );
+		_mm_store_ss( result + 2, _mm_movehl_ps( result_row, result_row ) );
+#elif defined( ENGINE_MATH_SIMD_NEON )
+		const auto LoadRow = []( const float* row )
+		{
+			return vcombine_f32( vld1_f32( row ), vld1_dup_f32( row + 2 ) );
+		};
+
+		float32x4_t result_row =                 vmulq_n_f32( LoadRow( matrix + 0 ), vector[ 0 ] );
+		result_row = vaddq_f32( result_row,      vmulq_n_f32( LoadRow( matrix + 3 ), vector[ 1 ] ) );
+		result_row = vaddq_f32( result_row,      vmulq_n_f32( LoadRow( matrix + 6 ), vector[ 2 ] ) );
+
+		vst1_f32( result, vget_low_f32( result_row ) );
+		vst1q_lane_f32( result + 2, result_row, 2 );
+#endif
+	}
+
+#if defined( ENGINE_MATH_SIMD_SSE )
+	/* result = inverse of matrix; 4x4 matrix, assumed to be invertible. result may alias matrix.
+	 * Treats the matrix as 2x2 blocks [ A B ; C D ], each held in a single register as [ m00 m01 m10 m11 ], & applies the block-wise inverse
+	 * using 2x2 adjugates (denoted by #), which needs a single division for the reciprocal of the determinant.
+	 * Based on https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html. */
+	inline void Inverse_4x4( const float* matrix, float* result )
+	{
+#define ENGINE_MATH_SIMD_SHUFFLE( vector_1, vector_2, x, y, z, w ) _mm_shuffle_ps( vector_1, vector_2, _MM_SHUFFLE( w, z, y, x ) )
+#define ENGINE_MATH_SIMD_SWIZZLE( vector, x, y, z, w ) ENGINE_MATH_SIMD_SHUFFLE( vector, vector, x, y, z, w )
+
+		/* 2x2 products of block registers; A * B, A# * B & A * B#. */
+		const auto Multiply_2x2 = []( const __m128 a, const __m128 b )
+		{
+			return _mm_add_ps( _mm_mul_ps( a, ENGINE_MATH_SIMD_SWIZZLE( b, 0, 3, 0, 3 ) ),
+							   _mm_mul_ps( ENGINE_MATH_SIMD_SWIZZLE( a, 1, 0, 3, 2 ), ENGINE_MATH_SIMD_SWIZZLE( b, 2, 1, 2, 1 ) ) );
+		};
+		const auto AdjugateMultiply_2x2 = []( const __m128 a, const __m128 b )
+		{
+			return _mm_sub_ps( _mm_mul_ps( ENGINE_MATH_SIMD_SWIZZLE( a, 3, 3, 0, 0 ), b ),
+							   _mm_mul_ps( ENGINE_MATH_SIMD_SWIZZLE( a, 1, 1, 2, 2 ), ENGINE_MATH_SIMD_SWIZZLE( b, 2, 3, 0, 1 ) ) );
+		};
+		const auto MultiplyAdjugate_2x2 = []( const __m128 a, const __m128 b )
+		{
+			return _mm_sub_ps( _mm_mul_ps( a, ENGINE_MATH_SIMD_SWIZZLE( b, 3, 0, 3, 0 ) ),
+							   _mm_mul_ps( ENGINE_MATH_SIMD_SWIZZLE( a, 1, 0, 3, 2 ), ENGINE_MATH_SIMD_SWIZZLE( b, 2, 1, 2, 1 ) ) );
+		};
+
+		const __m128 row_0 = _mm_loadu_ps( matrix + 0  );
+		const __m128 row_1 = _mm_loadu_ps( matrix + 4  );
+		const __m128 row_2 = _mm_loadu_ps( matrix + 8  );
+		const __m128 row_3 = _mm_loadu_ps( matrix + 12 );
+
+		const __m128 a = _mm_movelh_ps( row_0, row_1 );
+		const __m128 b = _mm_movehl_ps( row_1, row_0 );
+		const __m128 c = _mm_movelh_ps( row_2, row_3 );
+		const __m128 d = _mm_movehl_ps( row_3, row_2 );
+
+		/* [ |A| |B| |C| |D| ]. */
+		const __m128 sub_determinants = _mm_sub_ps( _mm_mul_ps( ENGINE_MATH_SIMD_SHUFFLE( row_0, row_2, 0, 2, 0, 2 ), ENGINE_MATH_SIMD_SHUFFLE( row_1, row_3, 1, 3, 1, 3 ) ),
+													_mm_mul_ps( ENGINE_MATH_SIMD_SHUFFLE( row_0, row_2, 1, 3, 1, 3 ), ENGINE_MATH_SIMD_SHUFFLE( row_1, row_3, 0, 2, 0, 2 ) ) );
+		const __m128 determinant_a = ENGINE_MATH_SIMD_SWIZZLE( sub_determinants, 0, 0, 0, 0 );
+		const __m128 determinant_b = ENGINE_MATH_SIMD_SWIZZLE( sub_determinants, 1, 1, 1, 1 );
+		const __m128 determinant_c = ENGINE_MATH_SIMD_SWIZZLE( sub_determinants, 2, 2, 2, 2 );
+		const __m128 determinant_d = ENGINE_MATH_SIMD_SWIZZLE( sub_determinants, 3, 3, 3, 3 );
+
+		const __m128 d_adjugate_c = AdjugateMultiply_2x2( d, c );
+		const __m128 a_adjugate_b = AdjugateMultiply_2x2( a, b );
+
+		/* Adjugates of the blocks of the result (before the division by |M|):
+		 * X# = |D|A - B(D#C), Y# = |B|C - D(A#B)#, Z# = |C|B - A(D#C)#, W# = |A|D - C(A#B). */
+		__m128 x = _mm_sub_ps( _mm_mul_ps( determinant_d, a ), Multiply_2x2( b, d_adjugate_c ) );
+		__m128 y = _mm_sub_ps( _mm_mul_ps( determinant_b, c ), MultiplyAdjugate_2x2( d, a_adjugate_b ) );
+		__m128 z = _mm_sub_ps( _mm_mul_ps( determinant_c, b ), MultiplyAdjugate_2x2( a, d_adjugate_c ) );
+		__m128 w = _mm_sub_ps( _mm_mul_ps( determinant_a, d ), Multiply_2x2( c, a_adjugate_b ) );
+
+		/* |M| = |A||D| + |B||C| - tr((A#B)(D#C)); The trace is summed horizontally with shuffles, which is SSE2-only. */
+		__m128 trace = _mm_mul_ps( a_adjugate_b, ENGINE_MATH_SIMD_SWIZZLE( d_adjugate_c, 0, 2, 1, 3 ) );
+		trace = _mm_add_ps( trace, ENGINE_MATH_SIMD_SWIZZLE( trace, 2, 3, 0, 1 ) );
+		trace = _mm_add_ps( trace, ENGINE_MATH_SIMD_SWIZZLE( trace, 1, 0, 3, 2 ) );
+
+		const __m128 determinant = _mm_sub_ps( _mm_add_ps( _mm_mul_ps( determinant_a, determinant_d ), _mm_mul_ps( determinant_b, determinant_c ) ), trace );
+
+		/* The signs take the adjugates of the blocks back to the blocks themselves, along with the swaps of the diagonals in the shuffles below. */
+		const __m128 reciprocal_determinant = _mm_div_ps( _mm_setr_ps( 1.0f, -1.0f, -1.0f, 1.0f ), determinant );
+
+		x = _mm_mul_ps( x, reciprocal_determinant );
+		y = _mm_mul_ps( y, reciprocal_determinant );
+		z = _mm_mul_ps( z, reciprocal_determinant );
+		w = _mm_mul_ps( w, reciprocal_determinant );
+
+		_mm_storeu_ps( result + 0,  ENGINE_MATH_SIMD_SHUFFLE( x, y, 3, 1, 3, 1 ) );
+		_mm_storeu_ps( result + 4,  ENGINE_MATH_SIMD_SHUFFLE( x, y, 2, 0, 2, 0 ) );
+		_mm_storeu_ps( result + 8,  ENGINE_MATH_SIMD_SHUFFLE( z, w, 3, 1, 3, 1 ) );
+		_mm_storeu_ps( result + 12, ENGINE_MATH_SIMD_SHUFFLE( z, w, 2, 0, 2, 0 ) );
+
+#undef ENGINE_MATH_SIMD_SWIZZLE
+#undef ENGINE_MATH_SIMD_SHUFFLE
+	}
+#endif // ENGINE_MATH_SIMD_SSE
+}
+
+#endif // ENGINE_MATH_SIMD
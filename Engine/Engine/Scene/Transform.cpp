@@ -216,24 +216,9 @@ namespace Engine
 
 	const Matrix4x4 Transform::GetInverseOfFinalMatrix()
 	{
-		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our two current matrices:
-		 * Scaling Matrix: We can simply use the inverses (with respect to multiplication) of diagonal elements' values to reverse the scaling operation.
-		 * Rotation And Translation Matrix:
-		 *		We can simply transpose the rotation part (upper 3x3 portion of the 4x4 matrix) since rotation matrices are orthogonal.
-		 *		We can simply use the inverse (with respect to addition) of the translation part (first 3 elements of the last row of the 4x4 matrix) to reverse the translation operation.
-		*/
-
-		// Force-update the matrices to get up-to-date values.
-		GetScalingMatrix();
-		GetRotationAndTranslationMatrix();
-
-		const Vector4 inverse_scale( 1.0f / scaling_matrix[ 0 ][ 0 ], 1.0f / scaling_matrix[ 1 ][ 1 ], 1.0f / scaling_matrix[ 2 ][ 2 ], 1.0f );
-
-		const Matrix4x4 inverse_scaling_matrix( inverse_scale );
-		const Matrix4x4 inverse_rotation_matrix( rotation_and_translation_matrix.SubMatrix< 3 >().Transposed() );
-		const Matrix4x4 inverse_translation_matrix( Matrix4x4{}.SetTranslation( -rotation_and_translation_matrix.GetRow< 3 >( 3 /* Last Row. */ ) ) );
-
-		return inverse_translation_matrix * inverse_rotation_matrix * inverse_scaling_matrix;
+		/* The final matrix is an SRT matrix; The inverse of the upper 3x3 portion (scaling & rotation) & the inverse of the translation suffice,
+		 * which is cheaper (and more accurate) than a general 4x4 inverse or composing & multiplying separate inverse scaling, rotation & translation matrices. */
+		return GetFinalMatrix().InverseAffine();
 	}
 
 	/* If the caller knows there's no scaling involved (for example; Transform of a Camera), calling this function is more preferrable. */
@@ -241,21 +226,9 @@ namespace Engine
 	{
 		ASSERT_DEBUG_ONLY( scale == Vector3::One() );
 
-		// Force-update the rotation part get up-to-date values.
-		UpdateRotationPartOfMatrixIfDirty();
-
-		/* Instead of actually calculating the inverse of the matrix, we'll leverage the information we have on our Rotation And Translation Matrix:
-		 *		We can simply transpose the rotation part (upper 3x3 portion of the 4x4 matrix) since rotation matrices are orthogonal.
-		 *		We can simply use the inverse of the translation to reverse the translation operation.
-		 *
-		 * Since the scaling is uniform (and in this case, 1), we can simply combine the inverse rotation (3x3 matrix) and the inverse translation (3D vector) in-place,
-		 * to construct a 4x4 transformation matrix, instead of creating two separate matrices and multiplying them together, saving us some cycles.
-		 *			BUT the inverse translation needs to be rotated by the inverse rotation first, to bring it to the correct space after the rotation is applied.
-		 *			(Also, RT != (Ti)(Rt) (where i = inverse & t = transpose), so we can't just plug the Rt & Ti into a single matrix and call it a day).
-		*/
-
-		const Matrix3x3 inverse_rotation_matrix_3x3( rotation_and_translation_matrix.SubMatrix< 3 >().Transposed() );
-		return Matrix4x4( inverse_rotation_matrix_3x3, -translation.XYZ() * inverse_rotation_matrix_3x3 );
+		/* Rotation matrices are orthogonal, so the rotation part is simply transposed, & the inverse translation is brought to the space after the inverse rotation is applied.
+		 * No need for the final matrix either, as it equals the rotation & translation matrix when there's no scaling. */
+		return GetRotationAndTranslationMatrix().InverseRigid();
 	}
 
 	const Vector3& Transform::Right()
@@ -0,0 +1,299 @@
+// Engine Includes.
+#include "TransformArray.h"
+#include "Math/Matrix.h"
+#include "Math/SIMD.h"
+
+// std Includes.
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <execution>
+#include <numeric>
+
+namespace Engine
+{
+	constexpr std::size_t ELEMENTS_PER_DIRTY_WORD = 64;
+
+	TransformArray::TransformArray()
+		:
+		count( 0 )
+	{
+	}
+
+	TransformArray::TransformArray( const std::size_t count )
+		:
+		count( 0 )
+	{
+		Resize( count );
+	}
+
+	TransformArray::~TransformArray()
+	{
+	}
+
+	void TransformArray::Resize( const std::size_t new_count )
+	{
+		const auto padded_count = ( new_count + ELEMENTS_PER_DIRTY_WORD - 1 ) / ELEMENTS_PER_DIRTY_WORD * ELEMENTS_PER_DIRTY_WORD;
+
+		/* Padding is initialized to identity too; It is composed along with the actual elements, but never written out. */
+		scale_x.resize( padded_count, 1.0f );
+		scale_y.resize( padded_count, 1.0f );
+		scale_z.resize( padded_count, 1.0f );
+		rotation_x.resize( padded_count, 0.0f );
+		rotation_y.resize( padded_count, 0.0f );
+		rotation_z.resize( padded_count, 0.0f );
+		rotation_w.resize( padded_count, 1.0f );
+		translation_x.resize( padded_count, 0.0f );
+		translation_y.resize( padded_count, 0.0f );
+		translation_z.resize( padded_count, 0.0f );
+
+		dirty_bits.resize( padded_count / ELEMENTS_PER_DIRTY_WORD, 0 );
+
+		dirty_word_indices.resize( dirty_bits.size() );
+		std::iota( dirty_word_indices.begin(), dirty_word_indices.end(), 0 );
+
+		/* Elements that were in the padding after a previous shrink may hold stale values. */
+		for( auto index = count; index < new_count; index++ )
+		{
+			SetScaling( index, 1.0f );
+			SetRotation( index, Quaternion() );
+			SetTranslation( index, Vector3::Zero() );
+		}
+
+		if( const auto remainder = new_count % ELEMENTS_PER_DIRTY_WORD;
+			remainder != 0 )
+			dirty_bits.back() &= ( std::uint64_t( 1 ) << remainder ) - 1;
+
+		count = new_count;
+	}
+
+	TransformArray& TransformArray::SetScaling( const std::size_t index, const float new_uniform_scale )
+	{
+		return SetScaling( index, Vector3( new_uniform_scale, new_uniform_scale, new_uniform_scale ) );
+	}
+
+	TransformArray& TransformArray::SetScaling( const std::size_t index, const Vector3& new_scale )
+	{
+		scale_x[ index ] = new_scale.X();
+		scale_y[ index ] = new_scale.Y();
+		scale_z[ index ] = new_scale.Z();
+
+		MarkDirty( index );
+
+		return *this;
+	}
+
+	TransformArray& TransformArray::SetRotation( const std::size_t index, const Quaternion& new_rotation )
+	{
+		rotation_x[ index ] = new_rotation.X();
+		rotation_y[ index ] = new_rotation.Y();
+		rotation_z[ index ] = new_rotation.Z();
+		rotation_w[ index ] = new_rotation.W();
+
+		MarkDirty( index );
+
+		return *this;
+	}
+
+	TransformArray& TransformArray::SetTranslation( const std::size_t index, const Vector3& new_translation )
+	{
+		translation_x[ index ] = new_translation.X();
+		translation_y[ index ] = new_translation.Y();
+		translation_z[ index ] = new_translation.Z();
+
+		MarkDirty( index );
+
+		return *this;
+	}
+
+	Vector3 TransformArray::GetScaling( const std::size_t index ) const
+	{
+		return Vector3( scale_x[ index ], scale_y[ index ], scale_z[ index ] );
+	}
+
+	Quaternion TransformArray::GetRotation( const std::size_t index ) const
+	{
+		return Quaternion( rotation_x[ index ], rotation_y[ index ], rotation_z[ index ], rotation_w[ index ] );
+	}
+
+	Vector3 TransformArray::GetTranslation( const std::size_t index ) const
+	{
+		return Vector3( translation_x[ index ], translation_y[ index ], translation_z[ index ] );
+	}
+
+	Matrix4x4 TransformArray::GetFinalMatrix( const std::size_t index ) const
+	{
+		return Matrix::SRT( GetScaling( index ), GetRotation( index ), GetTranslation( index ) );
+	}
+
+	void TransformArray::WriteTransposedFinalMatrices( std::span< Matrix4x4 > output, const bool dirty_only ) const
+	{
+		static_assert( sizeof( Matrix4x4 ) == sizeof( float ) * 16 );
+		ASSERT_DEBUG_ONLY( output.size() >= count && "TransformArray::WriteTransposedFinalMatrices(): output is smaller than the element count!" );
+
+		WriteTransposedFinalMatrices< 4 >( reinterpret_cast< float* >( output.data() ), dirty_only );
+	}
+
+	void TransformArray::WriteTransposedFinalMatrices( std::span< Matrix3x4 > output, const bool dirty_only ) const
+	{
+		static_assert( sizeof( Matrix3x4 ) == sizeof( float ) * 12 );
+		ASSERT_DEBUG_ONLY( output.size() >= count && "TransformArray::WriteTransposedFinalMatrices(): output is smaller than the element count!" );
+
+		WriteTransposedFinalMatrices< 3 >( reinterpret_cast< float* >( output.data() ), dirty_only );
+	}
+
+	bool TransformArray::IsDirty( const std::size_t index ) const
+	{
+		return dirty_bits[ index / ELEMENTS_PER_DIRTY_WORD ] & ( std::uint64_t( 1 ) << ( index % ELEMENTS_PER_DIRTY_WORD ) );
+	}
+
+	bool TransformArray::IsAnyDirty() const
+	{
+		return std::any_of( dirty_bits.cbegin(), dirty_bits.cend(), []( const std::uint64_t word ) { return word != 0; } );
+	}
+
+	std::pair< std::size_t, std::size_t > TransformArray::DirtyRange() const
+	{
+		const auto IsNotZero = []( const std::uint64_t word ) { return word != 0; };
+
+		const auto first_word = std::find_if( dirty_bits.cbegin(), dirty_bits.cend(), IsNotZero );
+		if( first_word == dirty_bits.cend() )
+			return { 0, 0 };
+
+		const auto last_word = std::find_if( dirty_bits.crbegin(), dirty_bits.crend(), IsNotZero );
+
+		const std::size_t first = ( first_word - dirty_bits.cbegin() ) * ELEMENTS_PER_DIRTY_WORD + std::countr_zero( *first_word );
+		const std::size_t last  = ( dirty_bits.crend() - last_word ) * ELEMENTS_PER_DIRTY_WORD - std::countl_zero( *last_word );
+
+		return { first, last };
+	}
+
+	void TransformArray::ResetDirtyFlags()
+	{
+		std::fill( dirty_bits.begin(), dirty_bits.end(), 0 );
+	}
+
+	void TransformArray::MarkDirty( const std::size_t index )
+	{
+		/* Atomic, as neighbouring elements share the same word & may be set from different threads. */
+		std::atomic_ref( dirty_bits[ index / ELEMENTS_PER_DIRTY_WORD ] ).fetch_or( std::uint64_t( 1 ) << ( index % ELEMENTS_PER_DIRTY_WORD ), std::memory_order_relaxed );
+	}
+
+	template< std::size_t RowCount >
+	void TransformArray::WriteTransposedFinalMatrices( float* output, const bool dirty_only ) const
+	{
+		constexpr std::size_t ELEMENT_STRIDE = RowCount * 4;
+
+		/* Same expressions as Math::QuaternionToMatrix3x3() & Matrix::SRT(), so the results match Transform::GetFinalMatrix() (barring the sign of zero).
+		 * Row j of the transposed matrix is [ scale.x * R0j, scale.y * R1j, scale.z * R2j, translation[ j ] ]. */
+
+		/* Each word of dirty bits makes up a job; Jobs never share output elements. */
+		std::for_each( std::execution::par, dirty_word_indices.cbegin(), dirty_word_indices.cend(), [ & ]( const std::size_t word_index )
+		{
+			const std::uint64_t dirty_word = dirty_bits[ word_index ];
+			if( dirty_only && dirty_word == 0 )
+				return;
+
+			for( std::size_t group_start = 0; group_start < ELEMENTS_PER_DIRTY_WORD; group_start += 4 )
+			{
+				const std::size_t first = word_index * ELEMENTS_PER_DIRTY_WORD + group_start;
+				if( first >= count )
+					break;
+
+				/* Groups of 4 elements are composed together; Clean elements in a dirty group are re-written with the same values, which is harmless. */
+				if( dirty_only && ( ( dirty_word >> group_start ) & 0b1111 ) == 0 )
+					continue;
+
+				const std::size_t group_count = std::min< std::size_t >( 4, count - first );
+
+#ifdef ENGINE_MATH_SIMD_SSE
+				const __m128 x = _mm_loadu_ps( rotation_x.data() + first );
+				const __m128 y = _mm_loadu_ps( rotation_y.data() + first );
+				const __m128 z = _mm_loadu_ps( rotation_z.data() + first );
+				const __m128 w = _mm_loadu_ps( rotation_w.data() + first );
+
+				const __m128 one = _mm_set1_ps( 1.0f );
+				const __m128 two = _mm_set1_ps( 2.0f );
+
+				const __m128 two_x2  = _mm_mul_ps( _mm_mul_ps( two, x ), x );
+				const __m128 two_y2  = _mm_mul_ps( _mm_mul_ps( two, y ), y );
+				const __m128 two_z2  = _mm_mul_ps( _mm_mul_ps( two, z ), z );
+				const __m128 two_x_y = _mm_mul_ps( _mm_mul_ps( two, x ), y );
+				const __m128 two_x_z = _mm_mul_ps( _mm_mul_ps( two, x ), z );
+				const __m128 two_y_z = _mm_mul_ps( _mm_mul_ps( two, y ), z );
+				const __m128 two_w_x = _mm_mul_ps( _mm_mul_ps( two, w ), x );
+				const __m128 two_w_y = _mm_mul_ps( _mm_mul_ps( two, w ), y );
+				const __m128 two_w_z = _mm_mul_ps( _mm_mul_ps( two, w ), z );
+
+				const __m128 scale_row_0 = _mm_loadu_ps( scale_x.data() + first );
+				const __m128 scale_row_1 = _mm_loadu_ps( scale_y.data() + first );
+				const __m128 scale_row_2 = _mm_loadu_ps( scale_z.data() + first );
+
+				/* Columns of the final matrix; Each lane holds a different element. */
+				__m128 columns[ 3 ][ 4 ] =
+				{
+					{
+						_mm_mul_ps( scale_row_0, _mm_sub_ps( _mm_sub_ps( one, two_y2 ), two_z2 ) ),
+						_mm_mul_ps( scale_row_1, _mm_sub_ps( two_x_y, two_w_z ) ),
+						_mm_mul_ps( scale_row_2, _mm_add_ps( two_x_z, two_w_y ) ),
+						_mm_loadu_ps( translation_x.data() + first )
+					},
+					{
+						_mm_mul_ps( scale_row_0, _mm_add_ps( two_x_y, two_w_z ) ),
+						_mm_mul_ps( scale_row_1, _mm_sub_ps( _mm_sub_ps( one, two_x2 ), two_z2 ) ),
+						_mm_mul_ps( scale_row_2, _mm_sub_ps( two_y_z, two_w_x ) ),
+						_mm_loadu_ps( translation_y.data() + first )
+					},
+					{
+						_mm_mul_ps( scale_row_0, _mm_sub_ps( two_x_z, two_w_y ) ),
+						_mm_mul_ps( scale_row_1, _mm_add_ps( two_y_z, two_w_x ) ),
+						_mm_mul_ps( scale_row_2, _mm_sub_ps( _mm_sub_ps( one, two_x2 ), two_y2 ) ),
+						_mm_loadu_ps( translation_z.data() + first )
+					}
+				};
+
+				/* Transposing each column set turns lanes into elements; columns[ j ][ k ] then is the row j of the transposed matrix of element k. */
+				for( auto& column : columns )
+					_MM_TRANSPOSE4_PS( column[ 0 ], column[ 1 ], column[ 2 ], column[ 3 ] );
+
+				for( std::size_t k = 0; k < group_count; k++ )
+				{
+					float* element_output = output + ( first + k ) * ELEMENT_STRIDE;
+					_mm_storeu_ps( element_output + 0, columns[ 0 ][ k ] );
+					_mm_storeu_ps( element_output + 4, columns[ 1 ][ k ] );
+					_mm_storeu_ps( element_output + 8, columns[ 2 ][ k ] );
+					if constexpr( RowCount == 4 )
+						_mm_storeu_ps( element_output + 12, _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f ) );
+				}
+#else
+				for( std::size_t index = first; index < first + group_count; index++ )
+				{
+					const float x = rotation_x[ index ], y = rotation_y[ index ], z = rotation_z[ index ], w = rotation_w[ index ];
+
+					const float two_x2  = 2.0f * x * x;
+					const float two_y2  = 2.0f * y * y;
+					const float two_z2  = 2.0f * z * z;
+					const float two_x_y = 2.0f * x * y;
+					const float two_x_z = 2.0f * x * z;
+					const float two_y_z = 2.0f * y * z;
+					const float two_w_x = 2.0f * w * x;
+					const float two_w_y = 2.0f * w * y;
+					const float two_w_z = 2.0f * w * z;
+
+					const float sx = scale_x[ index ], sy = scale_y[ index ], sz = scale_z[ index ];
+
+					const float transposed_final_matrix[ 16 ] =
+					{
+						sx * ( 1.0f - two_y2 - two_z2 ),	sy * ( two_x_y - two_w_z ),			sz * ( two_x_z + two_w_y ),			translation_x[ index ],
+						sx * ( two_x_y + two_w_z ),			sy * ( 1.0f - two_x2 - two_z2 ),	sz * ( two_y_z - two_w_x ),			translation_y[ index ],
+						sx * ( two_x_z - two_w_y ),			sy * ( two_y_z + two_w_x ),			sz * ( 1.0f - two_x2 - two_y2 ),	translation_z[ index ],
+						0.0f,								0.0f,								0.0f,								1.0f
+					};
+
+					std::copy_n( transposed_final_matrix, ELEMENT_STRIDE, output + index * ELEMENT_STRIDE );
+				}
+#endif // ENGINE_MATH_SIMD_SSE
+			}
+		} );
+	}
+}
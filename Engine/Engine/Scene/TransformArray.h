@@ -0,0 +1,88 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/Vector.hpp"
+#include "Core/Macros.h"
+
+// std Includes.
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+	/* Structure-of-arrays counterpart of Transform, for large numbers of objects (e.g., hundreds of thousands of instances) animated every frame.
+	 * Each component of scale, rotation & translation is stored in its own array, so final matrices of 4 elements can be composed at once with SIMD.
+	 * No matrices are cached (unlike Transform); Final matrices are written straight into instance data by the WriteTransposedFinalMatrices() functions instead.
+	 * Setters of different elements are safe to call from multiple threads; Setters & the functions writing matrices out are not safe to call concurrently. */
+	class TransformArray
+	{
+	public:
+		TransformArray();
+		TransformArray( const std::size_t count );
+
+		DEFAULT_COPY_AND_MOVE_CONSTRUCTORS( TransformArray );
+
+		~TransformArray();
+
+	/* Modification: */
+
+		/* New elements are initialized to identity & are marked as dirty. */
+		void Resize( const std::size_t new_count );
+
+		TransformArray& SetScaling( const std::size_t index, const float new_uniform_scale );
+		TransformArray& SetScaling( const std::size_t index, const Vector3& new_scale );
+		TransformArray& SetRotation( const std::size_t index, const Quaternion& new_rotation );
+		TransformArray& SetTranslation( const std::size_t index, const Vector3& new_translation );
+
+	/* Queries: */
+
+		inline std::size_t Count() const { return count; }
+
+		Vector3 GetScaling( const std::size_t index ) const;
+		Quaternion GetRotation( const std::size_t index ) const;
+		Vector3 GetTranslation( const std::size_t index ) const;
+
+		/* SRT = Scale * Rotate * Translate. Same as Transform::GetFinalMatrix() but not cached; Prefer the batched functions below for many elements. */
+		Matrix4x4 GetFinalMatrix( const std::size_t index ) const;
+
+	/* Batched Output: */
+
+		/* Writes the transposed final matrices (as vertex attribute matrices' major can not be flipped in GLSL) into output[ index ], in parallel.
+		 * Only dirty elements are written, unless dirty_only is false. output has to have at least Count() elements. */
+		void WriteTransposedFinalMatrices( std::span< Matrix4x4 > output, const bool dirty_only = true ) const;
+		/* Same as above, but drops the last row of the transposed matrices, which is always [0 0 0 1]; For 4x3 instance attributes, saving 25% of the bandwidth. */
+		void WriteTransposedFinalMatrices( std::span< Matrix3x4 > output, const bool dirty_only = true ) const;
+
+	/* Dirty Flags: */
+
+		/* These must be reset via ResetDirtyFlags() at the beginning (or end) of every frame, IF is_dirty flag/behaviour is desired. */
+		bool IsDirty( const std::size_t index ) const;
+		bool IsAnyDirty() const;
+		/* Returns the [first, last) range covering all dirty elements (empty if there are none); Handy for partial instance buffer updates. */
+		std::pair< std::size_t, std::size_t > DirtyRange() const;
+		void ResetDirtyFlags();
+
+	private:
+		void MarkDirty( const std::size_t index );
+
+		template< std::size_t RowCount >
+		void WriteTransposedFinalMatrices( float* output, const bool dirty_only ) const;
+
+	private:
+		/* Arrays are padded to a multiple of 64 elements (with identity), so that batches never need to handle partial loads. */
+		std::vector< float > scale_x, scale_y, scale_z;
+		std::vector< float > rotation_x, rotation_y, rotation_z, rotation_w;
+		std::vector< float > translation_x, translation_y, translation_z;
+
+		/* One bit per element, 64 elements per word. */
+		std::vector< std::uint64_t > dirty_bits;
+		/* 0, 1, 2, ... for each word of dirty bits; Parallel loops iterate over these, as they may pass copies of the (trivially copyable) words themselves. */
+		std::vector< std::size_t > dirty_word_indices;
+
+		std::size_t count;
+	};
+}
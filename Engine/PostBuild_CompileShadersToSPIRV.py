@@ -0,0 +1,120 @@
+import itertools
+import os
+import re
+import shutil
+import subprocess
+
+# Looked up in GLSLANG_PATH if it is defined, in PATH otherwise.
+glslang_validator_path = shutil.which( 'glslangValidator', path = os.environ.get( 'GLSLANG_PATH' ) )
+if glslang_validator_path == None:
+    print( 'glslangValidator could not be found (in \"GLSLANG_PATH\" or \"PATH\"). Skipping post-build SPIR-V compilation.' )
+    exit()
+
+print( '\nPostBuild_CompileShadersToSPIRV.py: Compiling all built-in shader programs (& their Feature combinations) to SPIR-V via glslangValidator...' )
+
+root_directory_path          = os.path.dirname(os.path.realpath(__file__))
+shaders_directory_path       = os.path.join( root_directory_path, 'Engine\\Asset\\Shader' )
+output_directory_path        = os.path.join( shaders_directory_path, 'SPIR-V' ) # Shader::FindSPIRVProgram() expects the modules here.
+internal_shaders_source_path = os.path.join( root_directory_path, 'Engine\\Graphics\\InternalShaders.cpp' )
+
+# Every combination of a program's Features is a separate set of modules; Programs declaring more than this many Features are left to runtime GLSL compilation.
+max_feature_count = 6
+
+include_pattern = re.compile( r'^\s*#\s*include\s+"([^"]+)"', re.MULTILINE )
+feature_pattern = re.compile( r'^\s*#\s*pragma\s+feature\s+(\w+)', re.MULTILINE )
+
+# The stages of a program are compiled & linked together (glslangValidator -l), so that the automatically assigned uniform & varying locations agree across them;
+# Compiled separately, every stage would start assigning from location 0 & the modules would not link. The programs are taken from InternalShaders.cpp.
+program_pattern = re.compile( r'Add(?:_WithGeometryStage)?\(\s*"[^"]*",\s*'
+                              r'FullShaderPath\(\s*"([^"]+)"_vert\s*\),\s*'
+                              r'(?:FullShaderPath\(\s*"([^"]+)"_geom\s*\),\s*)?'
+                              r'FullShaderPath\(\s*"([^"]+)"_frag\s*\)' )
+
+# Returns the paths of the stage file & all the files it includes, recursively.
+def GatherDependencies( file_path, dependencies ):
+    if file_path in dependencies:
+        return dependencies
+
+    dependencies.append( file_path )
+
+    with open( file_path, 'r' ) as file:
+        for included_file_name in include_pattern.findall( file.read() ):
+            GatherDependencies( os.path.join( os.path.dirname( file_path ), included_file_name ), dependencies )
+
+    return dependencies
+
+def GatherFeatures( dependencies ):
+    features = set()
+    for dependency in dependencies:
+        with open( dependency, 'r' ) as file:
+            features.update( feature_pattern.findall( file.read() ) )
+
+    return sorted( features )
+
+# Has to match Shader::FindSPIRVProgram(): <vertex stage file name>+[<geometry stage file name>+]<fragment stage file name>[.<feature>...]/, Features sorted.
+# glslangValidator names the modules after their stages: vert.spv, geom.spv & frag.spv.
+def ModuleDirectoryPath( stage_file_names, features ):
+    return os.path.join( output_directory_path, '.'.join( [ '+'.join( stage_file_names ) ] + list( features ) ) )
+
+def IsUpToDate( module_directory_path, stage_count, dependencies ):
+    module_paths = [ os.path.join( module_directory_path, module_file_name ) for module_file_name in os.listdir( module_directory_path ) ] if os.path.isdir( module_directory_path ) else []
+    if len( module_paths ) != stage_count:
+        return False
+
+    module_time = min( os.path.getmtime( module_path ) for module_path in module_paths )
+    return all( os.path.getmtime( dependency ) <= module_time for dependency in dependencies )
+
+def CompileProgram( stage_file_paths, features, module_directory_path ):
+    os.makedirs( module_directory_path, exist_ok = True )
+
+    # -G: SPIR-V for OpenGL (GL_ARB_gl_spirv). Uniforms & varyings need explicit locations there, which the sources do not specify.
+    result = subprocess.run( [ glslang_validator_path, '-G', '-l', '--auto-map-locations', '-I' + shaders_directory_path ] +
+                             [ '-D' + feature for feature in features ] +
+                             stage_file_paths,
+                             cwd = module_directory_path, capture_output = True, text = True )
+
+    if result.returncode != 0:
+        print( result.stdout )
+        print( 'error: Shader program "' + '+'.join( os.path.basename( path ) for path in stage_file_paths ) + '" could not be compiled to SPIR-V with Features: ' + str( features ) )
+        for module_file_name in os.listdir( module_directory_path ):
+            os.remove( os.path.join( module_directory_path, module_file_name ) ) # Partial output would pass as up-to-date otherwise.
+        return False
+
+    return True
+
+with open( internal_shaders_source_path, 'r' ) as file:
+    programs = sorted( set( tuple( stage for stage in match if stage ) for match in program_pattern.findall( file.read() ) ) )
+
+os.makedirs( output_directory_path, exist_ok = True )
+
+success        = True
+compiled_count = 0
+skipped_count  = 0
+
+for stage_file_names in programs:
+    stage_file_paths = [ os.path.join( shaders_directory_path, stage_file_name ) for stage_file_name in stage_file_names ]
+
+    dependencies = []
+    for stage_file_path in stage_file_paths:
+        GatherDependencies( stage_file_path, dependencies )
+    features = GatherFeatures( dependencies )
+
+    if len( features ) > max_feature_count:
+        print( 'PostBuild_CompileShadersToSPIRV.py: Skipping "' + '+'.join( stage_file_names ) + '"; Too many Features (' + str( len( features ) ) + ').' )
+        continue
+
+    for feature_count in range( len( features ) + 1 ):
+        for feature_combination in itertools.combinations( features, feature_count ):
+            module_directory_path = ModuleDirectoryPath( stage_file_names, feature_combination )
+
+            if IsUpToDate( module_directory_path, len( stage_file_paths ), dependencies ):
+                skipped_count += 1
+            elif CompileProgram( stage_file_paths, feature_combination, module_directory_path ):
+                compiled_count += 1
+            else:
+                success = False
+
+if success:
+    print( 'PostBuild_CompileShadersToSPIRV.py: ' + str( compiled_count ) + ' SPIR-V program(s) compiled, ' + str( skipped_count ) + ' up-to-date.' )
+else:
+    print( '\nError: PostBuild_CompileShadersToSPIRV.py: Some shader programs could not be compiled to SPIR-V. They will be compiled from GLSL at runtime.' )
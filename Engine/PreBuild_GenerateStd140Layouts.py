@@ -0,0 +1,268 @@
+import os
+import re
+import shutil
+import subprocess
+import sys
+from collections import defaultdict # Provides dictionary of lists.
+
+# Generates Engine/Graphics/Std140Layout_Generated.h from glslang's reflection of the internal shaders:
+#   Every uniform block gets a struct of constexpr member offsets/sizes & every Std140StructTag struct bound below gets static_assert'ed against the reflected layout,
+#   so that a layout drift between GLSL & C++ fails the build instead of silently corrupting uniform buffers at runtime.
+# The header is a build output (it is not checked in), so glslangValidator is required to build the engine.
+
+root_directory_path    = os.path.dirname( os.path.realpath( __file__ ) )
+shaders_directory_path = os.path.join( root_directory_path, 'Engine', 'Asset', 'Shader' )
+output_file_path       = os.path.join( root_directory_path, 'Engine', 'Graphics', 'Std140Layout_Generated.h' )
+
+allowed_shader_extensions = [ '.vert', '.geom', '.frag' ]
+
+# Uniform block (or uniform block member) -> hand-written Std140StructTag struct that is uploaded into it as a whole.
+# Members are matched by name; Members named "padding" are skipped as they are not expected to be mirrored on the C++ side.
+cpp_struct_bindings = {
+    '_Intrinsic_Lighting._INTRINSIC_DIRECTIONAL_LIGHT' : 'Engine::Lighting::DirectionalLightData',
+    '_Intrinsic_Lighting._INTRINSIC_POINT_LIGHTS'      : 'Engine::Lighting::PointLightData',
+    '_Intrinsic_Lighting._INTRINSIC_SPOT_LIGHTS'       : 'Engine::Lighting::SpotLightData',
+    'BlinnPhongMaterialData'                           : 'Engine::MaterialData::BlinnPhongMaterialData',
+}
+
+cpp_struct_binding_includes = [ 'Lighting/Lighting.h', 'MaterialData/MaterialData.h' ]
+
+# GL type enum -> size in bytes, under std140 rules. Same as GL::Type::SizeOf() in ShaderTypeInformation.h, except for bools, which take up 4 bytes per component in std140.
+# Arrays are sized via their reflected stride instead (see MemberSize()).
+gl_type_sizes = {
+    0x1406 : 4,  0x8B50 : 8,  0x8B51 : 12, 0x8B52 : 16, # float, vec2, vec3, vec4.
+    0x140A : 8,  0x8FFC : 16, 0x8FFD : 24, 0x8FFE : 32, # double, dvec2, dvec3, dvec4.
+    0x1404 : 4,  0x8B53 : 8,  0x8B54 : 12, 0x8B55 : 16, # int, ivec2, ivec3, ivec4.
+    0x1405 : 4,  0x8DC6 : 8,  0x8DC7 : 12, 0x8DC8 : 16, # uint, uvec2, uvec3, uvec4.
+    0x8B56 : 4,  0x8B57 : 8,  0x8B58 : 12, 0x8B59 : 16, # bool, bvec2, bvec3, bvec4.
+    0x8B5A : 16, 0x8B5B : 36, 0x8B5C : 64,              # mat2, mat3, mat4.
+    0x8B65 : 24, 0x8B66 : 32, 0x8B67 : 24,              # mat2x3, mat2x4, mat3x2.
+    0x8B68 : 48, 0x8B69 : 32, 0x8B6A : 48,              # mat3x4, mat4x2, mat4x3.
+}
+
+reflection_entry_pattern = re.compile( r'^(?P<name>[^:]+): offset (?P<offset>-?\d+), type (?P<type>[0-9a-fA-F]+), (?:array)?[sS]ize (?P<size>-?\d+), index (?P<index>-?\d+)' )
+array_stride_pattern     = re.compile( r', arrayStride (?P<array_stride>\d+)' ) # Only printed for arrays.
+feature_pattern          = re.compile( r'#pragma\s+feature\s+(\w+)' )
+
+# Looked up in GLSLANG_PATH if it is defined, in PATH otherwise (same as PostBuild_CompileShadersToSPIRV.py).
+def FindGlslangValidator():
+    return shutil.which( 'glslangValidator', path = os.environ.get( 'GLSLANG_PATH' ) )
+
+def CollectShaderPrograms():
+    shader_programs = defaultdict( list )
+    for file in sorted( os.listdir( shaders_directory_path ) ):
+        file_name_alone, file_extension = os.path.splitext( file )
+        if file_extension in allowed_shader_extensions:
+            shader_programs[ file_name_alone ].append( os.path.join( shaders_directory_path, file ) )
+
+    return shader_programs
+
+def CollectFeatures( shader_stage_file_paths ):
+    features = set()
+    for shader_stage_file_path in shader_stage_file_paths:
+        with open( shader_stage_file_path, 'r' ) as file:
+            features.update( feature_pattern.findall( file.read() ) )
+
+    return sorted( features )
+
+# Returns ( uniforms, blocks ), where uniforms = [ ( name, offset, type, array_size, array_stride, block_index ) ] & blocks = [ ( name, size ) ], in reflection order (block index = list index).
+# array_stride is 0 for non-arrays.
+def ParseReflection( reflection_output ):
+    uniforms, blocks = [], []
+    section = None
+    for line in reflection_output.splitlines():
+        line = line.strip()
+        if line.endswith( 'reflection:' ):
+            section = line
+            continue
+
+        match = reflection_entry_pattern.match( line )
+        if match == None:
+            continue
+
+        if section == 'Uniform reflection:':
+            array_stride_match = array_stride_pattern.search( line )
+            array_stride       = int( array_stride_match[ 'array_stride' ] ) if array_stride_match else 0
+            uniforms.append( ( match[ 'name' ], int( match[ 'offset' ] ), int( match[ 'type' ], 16 ), int( match[ 'size' ] ), array_stride, int( match[ 'index' ] ) ) )
+        elif section == 'Uniform block reflection:':
+            blocks.append( ( match[ 'name' ], int( match[ 'size' ] ) ) )
+
+    return uniforms, blocks
+
+def ReflectProgram( glslang_validator_path, shader_name, shader_stage_file_paths ):
+    defines = [ '-D' + feature for feature in CollectFeatures( shader_stage_file_paths ) ]
+    result = subprocess.run( [ glslang_validator_path ] + shader_stage_file_paths + defines + [ '-I' + shaders_directory_path, '-l', '-q', '--reflect-all-block-variables' ],
+                             capture_output = True, text = True )
+    if result.returncode != 0:
+        print( result.stdout )
+        print( 'error: Shader "' + shader_name + '" could not be reflected.' )
+        return None
+
+    return ParseReflection( result.stdout )
+
+# std140 pads every array element to (at least) a vec4, so an array takes up stride * element count bytes rather than the size of its element type times the count.
+def MemberSize( type, array_size, array_stride ):
+    return array_stride * array_size if array_stride != 0 else gl_type_sizes[ type ]
+
+# Groups the flat reflection into { block_name : { 'size', 'singles', 'structs', 'arrays' } }.
+def BuildLayouts( uniforms, blocks ):
+    layouts = {}
+    for block_index, ( block_name, block_size ) in enumerate( blocks ):
+        singles = {}
+        structs = defaultdict( dict )
+        arrays  = defaultdict( dict )
+
+        for ( uniform_name, offset, type, array_size, array_stride, index ) in uniforms:
+            if index != block_index:
+                continue
+
+            member_name = uniform_name[ len( block_name ) + 1 : ] if uniform_name.startswith( block_name + '.' ) else uniform_name
+            size        = MemberSize( type, array_size, array_stride )
+
+            array_match = re.match( r'^(\w+)\[(\d+)\]\.(\w+)$', member_name )
+            if array_match:
+                arrays[ array_match[ 1 ] ].setdefault( int( array_match[ 2 ] ), {} )[ array_match[ 3 ] ] = ( offset, size )
+            elif '.' in member_name:
+                aggregate_name, inner_name = member_name.split( '.', 1 )
+                structs[ aggregate_name ][ inner_name ] = ( offset, size )
+            else:
+                singles[ member_name.replace( '[0]', '' ) ] = ( offset, size )
+
+        layouts[ block_name ] = { 'size' : block_size, 'singles' : singles, 'structs' : dict( structs ), 'arrays' : dict( arrays ) }
+
+    return layouts
+
+def MergeLayouts( merged_layouts, new_layouts, shader_name ):
+    success = True
+    for block_name, layout in new_layouts.items():
+        if block_name in merged_layouts and merged_layouts[ block_name ] != layout:
+            print( 'error: Uniform block "' + block_name + '" in shader "' + shader_name + '" has a different layout than in other shaders.' )
+            success = False
+
+        merged_layouts[ block_name ] = layout
+
+    return success
+
+def Identifier( glsl_name ):
+    return glsl_name.lstrip( '_' ) # Leading underscore + uppercase letter names are reserved in C++.
+
+def EmitStructBindingChecks( lines, cpp_struct, members, base_offset, aggregate_size ):
+    for member_name, ( offset, size ) in sorted( members.items(), key = lambda item : item[ 1 ][ 0 ] ):
+        if member_name.startswith( 'padding' ):
+            continue
+
+        lines.append( '\tstatic_assert( offsetof( ' + cpp_struct + ', ' + member_name + ' ) == ' + str( offset - base_offset ) + ', "' +
+                      cpp_struct + '::' + member_name + ' does not match its GLSL offset." );' )
+
+    lines.append( '\tstatic_assert( sizeof( ' + cpp_struct + ' ) >= ' + str( aggregate_size ) + ', "' + cpp_struct + ' is smaller than its GLSL counterpart." );' )
+
+def EmitHeader( layouts ):
+    lines = [ '#pragma once',
+              '',
+              '/* GENERATED by PreBuild_GenerateStd140Layouts.py from the glslang reflection of the shaders in Engine/Asset/Shader. Do NOT edit manually. */',
+              '',
+              '// Engine Includes.',
+              '#include "Std140Layout.h"' ]
+    lines += [ '#include "' + include + '"' for include in cpp_struct_binding_includes ]
+    lines += [ '',
+               '// std Includes.',
+               '#include <cstddef> // offsetof.',
+               '',
+               'namespace Engine::Std140Layout',
+               '{' ]
+
+    checks = []
+
+    for block_index, ( block_name, layout ) in enumerate( sorted( layouts.items() ) ):
+        if block_index > 0:
+            lines.append( '' )
+
+        lines.append( '\tstruct ' + Identifier( block_name ) )
+        lines.append( '\t{' )
+        lines.append( '\t\tstatic constexpr const char* NAME = "' + block_name + '";' )
+        lines.append( '\t\tstatic constexpr int SIZE = ' + str( layout[ 'size' ] ) + ';' )
+
+        singles = { name : member for name, member in layout[ 'singles' ].items() if not name.startswith( 'padding' ) }
+        if singles:
+            lines.append( '' )
+        for member_name, ( offset, size ) in sorted( singles.items(), key = lambda item : item[ 1 ][ 0 ] ):
+            lines.append( '\t\tstatic constexpr Member ' + Identifier( member_name ) + '{ .offset = ' + str( offset ) + ', .size = ' + str( size ) + ' };' )
+
+        if layout[ 'structs' ]:
+            lines.append( '' )
+        for struct_name, members in sorted( layout[ 'structs' ].items(), key = lambda item : min( item[ 1 ].values() ) ):
+            struct_offset = min( offset for ( offset, size ) in members.values() )
+            struct_size   = ( max( offset + size for ( offset, size ) in members.values() ) - struct_offset + 15 ) // 16 * 16 # Std140 rounds structs up to vec4 alignment.
+            lines.append( '\t\tstatic constexpr Member ' + Identifier( struct_name ) + '{ .offset = ' + str( struct_offset ) + ', .size = ' + str( struct_size ) + ' };' )
+
+            if block_name + '.' + struct_name in cpp_struct_bindings:
+                EmitStructBindingChecks( checks, cpp_struct_bindings[ block_name + '.' + struct_name ], members, struct_offset, struct_size )
+
+        if layout[ 'arrays' ]:
+            lines.append( '' )
+        for array_name, elements in sorted( layout[ 'arrays' ].items(), key = lambda item : min( item[ 1 ][ 0 ].values() ) ):
+            array_offset  = min( offset for ( offset, size ) in elements[ 0 ].values() )
+            element_count = max( elements.keys() ) + 1
+            stride        = ( min( offset for ( offset, size ) in elements[ 1 ].values() ) - array_offset ) if 1 in elements else \
+                            ( max( offset + size for ( offset, size ) in elements[ 0 ].values() ) - array_offset + 15 ) // 16 * 16
+            lines.append( '\t\tstatic constexpr MemberArray ' + Identifier( array_name ) +
+                          '{ .offset = ' + str( array_offset ) + ', .stride = ' + str( stride ) + ', .element_count = ' + str( element_count ) + ' };' )
+
+            if block_name + '.' + array_name in cpp_struct_bindings:
+                EmitStructBindingChecks( checks, cpp_struct_bindings[ block_name + '.' + array_name ], elements[ 0 ], array_offset, stride )
+
+        lines.append( '\t};' )
+
+        if block_name in cpp_struct_bindings:
+            EmitStructBindingChecks( checks, cpp_struct_bindings[ block_name ], layout[ 'singles' ], 0, layout[ 'size' ] )
+
+    lines.append( '' )
+    lines.append( '/* C++ <-> GLSL layout checks: */' )
+    lines.append( '' )
+    lines += checks
+    lines.append( '}' )
+
+    return '\n'.join( lines ) + '\n'
+
+def Main():
+    glslang_validator_path = FindGlslangValidator()
+    if glslang_validator_path == None:
+        if os.path.isfile( output_file_path ):
+            print( 'PreBuild_GenerateStd140Layouts.py: glslangValidator could not be found (in "GLSLANG_PATH" or "PATH"). Keeping the existing ' +
+                   os.path.basename( output_file_path ) + ', which may be out of date.' )
+            return 0
+
+        print( 'Error: PreBuild_GenerateStd140Layouts.py: glslangValidator could not be found (in "GLSLANG_PATH" or "PATH"), so ' +
+               os.path.basename( output_file_path ) + ' can not be generated. Install the Vulkan SDK (or glslang) & set GLSLANG_PATH.' )
+        return 1
+
+    print( '\nPreBuild_GenerateStd140Layouts.py: Reflecting uniform blocks of all GLSL shaders via glslangValidator...' )
+
+    layouts = {}
+    success = True
+    for shader_name, shader_stage_file_paths in CollectShaderPrograms().items():
+        reflection = ReflectProgram( glslang_validator_path, shader_name, shader_stage_file_paths )
+        if reflection == None:
+            success = False
+            continue
+
+        success &= MergeLayouts( layouts, BuildLayouts( *reflection ), shader_name )
+
+    if not success:
+        print( '\nError: PreBuild_GenerateStd140Layouts.py: Some shaders could not be reflected.' )
+        return 1
+
+    header = EmitHeader( layouts )
+
+    # Only touch the file when it changes, to not trigger needless rebuilds.
+    if not os.path.isfile( output_file_path ) or open( output_file_path, 'r' ).read() != header:
+        with open( output_file_path, 'w', newline = '\n' ) as file:
+            file.write( header )
+        print( 'PreBuild_GenerateStd140Layouts.py: ' + os.path.basename( output_file_path ) + ' is updated.' )
+    else:
+        print( 'PreBuild_GenerateStd140Layouts.py: ' + os.path.basename( output_file_path ) + ' is up-to-date.' )
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit( Main() )
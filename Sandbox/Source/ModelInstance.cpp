@@ -2,6 +2,8 @@
 #include "ModelInstance.h"
 #include "Graphics/InternalTextures.h"
 
+#include "Engine/Asset/Shader/_Attributes.glsl"
+
 ModelInstance::ModelInstance()
 	:
 	model( nullptr )
@@ -13,49 +15,102 @@ ModelInstance::ModelInstance( const Engine::Model* model, Engine::Shader* const
 							  const Engine::RenderQueue::ID queue_id,
 							  Engine::Material* material,
 							  const bool has_shadows,
-							  const Vector4 texture_scale_and_offset )
+							  const Vector4 texture_scale_and_offset,
+							  const bool is_instanced )
 	:
 	model( model )
 {
 	ASSERT_DEBUG_ONLY( model != nullptr );
 
-	SetMaterialData( shader, texture_scale_and_offset );
-
-	/* Initialize Transforms, Materials & Renderables of Nodes: */
-
-	const auto mesh_instance_count = model->MeshInstanceCount();
-	const auto& meshes             = model->Meshes();
-	const auto& nodes              = model->Nodes();
-
-	node_transform_array.resize( mesh_instance_count );
-	node_renderable_array.resize( mesh_instance_count );
-
-	for( auto i = 0; i < mesh_instance_count; i++ )
-	{
-		node_renderable_array[ i ] = Engine::Renderable( &meshes[ i ], ( material ? material : &node_material_array[ i ] ),
-														 node_material_array[ i ].HasUniform( "uniform_transform_world" ) ? &node_transform_array[ i ] : nullptr,
-														 has_shadows );
-	}
+	const auto& nodes = model->Nodes();
 
 	/* Apply scene-graph transformations: */
 
-	int mesh_index = 0;
+	std::vector< Matrix4x4 > node_world_transforms( nodes.size() );
 	std::function< void( const std::size_t, const Matrix4x4& ) > ProcessNode = [ & ]( const std::size_t node_index, const Matrix4x4& parent_transform )
 	{
 		const auto& node = nodes[ node_index ];
 
-		auto transform_so_far = node.transform_local * parent_transform;
+		const auto transform_so_far = node.transform_local * parent_transform;
+		node_world_transforms[ node_index ] = transform_so_far;
 
 		for( auto& child_index : node.children )
 			ProcessNode( child_index, transform_so_far );
-
-		if( node.mesh_group )
-			for( auto& sub_mesh : node.mesh_group->sub_meshes )
-				node_transform_array[ mesh_index++ ].SetFromSRTMatrix( transform_so_far );
 	};
 
 	for( auto top_level_node_index : model->TopLevelNodeIndices() )
 		ProcessNode( top_level_node_index, Engine::Matrix::Scaling( scale ) * Engine::Math::QuaternionToMatrix( rotation ) * Engine::Matrix::Translation( translation ) );
+
+	/* Gather the SubMeshes to draw; Either one draw per SubMesh of every Node, or one instanced draw per SubMesh of every MeshGroup: */
+
+	if( is_instanced )
+	{
+		const auto& mesh_groups = model->MeshGroups();
+
+		instanced_mesh_array.reserve( model->MeshCount() ); // Renderables point into this vector.
+
+		for( auto& mesh_group : mesh_groups )
+		{
+			if( mesh_group.node_indices.empty() )
+				continue;
+
+			std::vector< float > instance_data;
+			instance_data.reserve( mesh_group.node_indices.size() * 16 );
+			for( const auto node_index : mesh_group.node_indices )
+			{
+				const Matrix4x4 transform_transposed( node_world_transforms[ node_index ].Transposed() ); // Vertex attribute matrices' major can not be flipped in GLSL.
+				instance_data.insert( instance_data.end(), transform_transposed.Data(), transform_transposed.Data() + 16 );
+			}
+
+			for( auto& sub_mesh : mesh_group.sub_meshes )
+			{
+				node_sub_mesh_array.push_back( &sub_mesh );
+				instanced_mesh_array.push_back( Engine::Mesh( sub_mesh.mesh,
+															  {
+																  Engine::VertexInstanceAttribute{ 1, GL_FLOAT_MAT4, INSTANCED_ATTRIBUTE_START } // Transform.
+															  },
+															  instance_data,
+															  ( int )mesh_group.node_indices.size() ) );
+			}
+		}
+	}
+	else
+	{
+		node_transform_array.reserve( model->MeshInstanceCount() );
+
+		for( auto node_index = 0; node_index < nodes.size(); node_index++ )
+		{
+			if( const auto& node = nodes[ node_index ];
+				node.mesh_group ) // Only process Nodes with Meshes.
+			{
+				for( auto& sub_mesh : node.mesh_group->sub_meshes )
+				{
+					node_sub_mesh_array.push_back( &sub_mesh );
+					node_transform_array.emplace_back().SetFromSRTMatrix( node_world_transforms[ node_index ] );
+				}
+			}
+		}
+	}
+
+	SetMaterialData( shader, texture_scale_and_offset );
+
+	/* Initialize Renderables: */
+
+	const auto renderable_count = node_sub_mesh_array.size();
+
+	node_renderable_array.resize( renderable_count );
+
+	for( auto i = 0; i < renderable_count; i++ )
+	{
+		auto& node_material = material ? *material : node_material_array[ i ];
+
+		if( is_instanced )
+			node_renderable_array[ i ] = Engine::Renderable( &instanced_mesh_array[ i ], &node_material, nullptr /* => Transforms are provided as instance data. */, has_shadows );
+		else
+			node_renderable_array[ i ] = Engine::Renderable( &node_sub_mesh_array[ i ]->mesh, &node_material,
+															 node_material_array[ i ].HasUniform( "uniform_transform_world" ) ? &node_transform_array[ i ] : nullptr,
+															 has_shadows );
+	}
 }
 
 ModelInstance::~ModelInstance()
@@ -64,56 +119,45 @@ ModelInstance::~ModelInstance()
 
 void ModelInstance::SetMaterialData( Engine::Shader* const shader, const Vector4 texture_scale_and_offset )
 {
-	int material_index = 0;
+	const auto material_count = node_sub_mesh_array.size();
 
-	node_material_array.resize( model->MeshInstanceCount() );
-	blinn_phong_material_data_array.resize( model->MeshInstanceCount() );
+	node_material_array.resize( material_count );
+	blinn_phong_material_data_array.resize( material_count );
 
-	const auto node_count = model->NodeCount();
-	const auto& nodes = model->Nodes();
+	for( auto material_index = 0; material_index < material_count; material_index++ )
+	{
+		const auto& sub_mesh = *node_sub_mesh_array[ material_index ];
 
-	const auto& model_textures = model->Textures();
+		auto& material = node_material_array[ material_index ] = Engine::Material( model->Name() + "_" + sub_mesh.name, shader );
 
-	for( auto& node : nodes )
-	{
-		if( node.mesh_group ) // Only process Nodes with Meshes.
+		if( sub_mesh.texture_albedo )
 		{
-			for( auto& sub_mesh : node.mesh_group->sub_meshes )
+			blinn_phong_material_data_array[ material_index ] =
 			{
-				auto& material = node_material_array[ material_index ] = Engine::Material( model->Name() + "_" + sub_mesh.name, shader );
-
-				if( sub_mesh.texture_albedo )
-				{
-					blinn_phong_material_data_array[ material_index ] =
-					{
-						.color_diffuse       = {},
-						.has_texture_diffuse = 1,
-						.shininess           = 32.0f
-					};
-
-					material.SetTexture( "uniform_diffuse_map_slot", sub_mesh.texture_albedo );
-				}
-				else if( sub_mesh.color_albedo )
-				{
-					blinn_phong_material_data_array[ material_index ] =
-					{
-						.color_diffuse       = *sub_mesh.color_albedo,
-						.has_texture_diffuse = 0,
-						.shininess           = 32.0f
-					};
-				}
+				.color_diffuse       = {},
+				.has_texture_diffuse = 1,
+				.shininess           = 32.0f
+			};
 
-				static const auto default_normal_map_texture = Engine::InternalTextures::Get( "Normal Map" );
-				static const auto white_texture              = Engine::InternalTextures::Get( "White" );
+			material.SetTexture( "uniform_diffuse_map_slot", sub_mesh.texture_albedo );
+		}
+		else if( sub_mesh.color_albedo )
+		{
+			blinn_phong_material_data_array[ material_index ] =
+			{
+				.color_diffuse       = *sub_mesh.color_albedo,
+				.has_texture_diffuse = 0,
+				.shininess           = 32.0f
+			};
+		}
 
-				material.SetTexture( "uniform_normal_map_slot", sub_mesh.texture_normal ? sub_mesh.texture_normal : default_normal_map_texture );
-				material.SetTexture( "uniform_specular_map_slot", white_texture );
+		static const auto default_normal_map_texture = Engine::InternalTextures::Get( "Normal Map" );
+		static const auto white_texture              = Engine::InternalTextures::Get( "White" );
 
-				material.Set( "uniform_texture_scale_and_offset", texture_scale_and_offset );
+		material.SetTexture( "uniform_normal_map_slot", sub_mesh.texture_normal ? sub_mesh.texture_normal : default_normal_map_texture );
+		material.SetTexture( "uniform_specular_map_slot", white_texture );
 
-				material_index++;
-			}
-		}
+		material.Set( "uniform_texture_scale_and_offset", texture_scale_and_offset );
 	}
 
 	for( auto i = 0; i < blinn_phong_material_data_array.size(); i++ )
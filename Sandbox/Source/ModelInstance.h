@@ -22,7 +22,9 @@ public:
 				   const Engine::RenderQueue::ID queue_id,
 				   Engine::Material* material,
 				   const bool has_shadows = false,
-				   const Vector4 texture_scale_and_offset = Vector4( 1.0f, 1.0f, 0.0f, 0.0f ) );
+				   const Vector4 texture_scale_and_offset = Vector4( 1.0f, 1.0f, 0.0f, 0.0f ),
+				   /* Draws every SubMesh once, instanced over all the Nodes referencing its MeshGroup; Requires an instanced shader. */
+				   const bool is_instanced = false );
 
 	DELETE_COPY_CONSTRUCTORS( ModelInstance );
 	DEFAULT_MOVE_CONSTRUCTORS( ModelInstance );
@@ -38,8 +40,10 @@ public:
 private:
 	const Engine::Model* model;
 	Engine::RenderQueue::ID queue_id;
+	std::vector< const Engine::Model::SubMesh* > node_sub_mesh_array; // One per Renderable.
 	std::vector< Engine::Renderable > node_renderable_array;
 	std::vector< Engine::Material > node_material_array;
-	std::vector< Engine::Transform > node_transform_array;
+	std::vector< Engine::Transform > node_transform_array; // Empty when instanced.
+	std::vector< Engine::Mesh > instanced_mesh_array;
 	std::vector< Engine::MaterialData::BlinnPhongMaterialData > blinn_phong_material_data_array;
 };
@@ -13,6 +13,7 @@
 #include "Engine/Graphics/GLLogger.h"
 #include "Engine/Graphics/InternalShaders.h"
 #include "Engine/Graphics/MeshUtility.hpp"
+#include "Engine/Graphics/ShaderVariantCache.h"
 #include "Engine/Graphics/Primitive/Primitive_Cube.h"
 #include "Engine/Graphics/Primitive/Primitive_Cube_FullScreen.h"
 #include "Engine/Graphics/Primitive/Primitive_Quad.h"
@@ -194,18 +195,27 @@ void SandboxApplication::Initialize()
 		constexpr Vector3 minimum_offset( -1.0f, -0.4f, -1.0f );
 		constexpr Vector3 maximum_offset( +1.0f, +0.4f, +1.0f );
 
+		/* Random angles are generated up front, in bulk: Nothing random is shared between the threads below & the layout is the same on every run. */
+		constexpr Radians inclination_limit = 15.0_deg;
+		std::vector< Radians > random_xz_angles( CUBE_COUNT ), inclination_angles( CUBE_COUNT );
+		Engine::Math::RandomGenerator random_generator;
+		random_generator.Fill( std::span( random_xz_angles ), 0.0_rad, Engine::Constants< Radians >::Two_Pi() );
+		random_generator.Fill( std::span( inclination_angles ), 0.0_rad, inclination_limit );
+
 		// Skip the first cube and process the rest.
-		std::for_each_n( std::execution::par, cube_transform_array.begin() + 1, CUBE_COUNT - 1, [ & ]( auto&& cube_transform )
+		std::vector< int > cube_indices( CUBE_COUNT - 1 );
+		std::iota( cube_indices.begin(), cube_indices.end(), 1 );
+
+		std::for_each( std::execution::par, cube_indices.cbegin(), cube_indices.cend(), [ & ]( const int cube_index )
 		{
-			const int cube_index = ( int )( &cube_transform - cube_transform_array.data() );
-			Radians random_xz_angle( Engine::Math::Random::Generate( 0.0_rad, Engine::Constants< Radians >::Two_Pi() ) );
-			constexpr Radians inclination_limit = 15.0_deg;
-			const Radians inclination_angle( Engine::Math::Random::Generate( 0.0_rad,inclination_limit ) );
+			const Radians random_xz_angle( random_xz_angles[ cube_index ] );
+			const Radians inclination_angle( inclination_angles[ cube_index ] );
 			Degrees angle( 20.0f * cube_index + inclination_angle );
-			cube_transform_array[ cube_index ]
-				.SetScaling( 0.3f )
-				.SetRotation( Quaternion( angle, Vector3{ 1.0f, 0.3f, 0.5f }.Normalized() ) )
-				.SetTranslation( CUBES_ORIGIN + 
+			cube_transform_array
+				.SetScaling( cube_index, 0.3f )
+				.SetRotation( cube_index, Quaternion( angle, Vector3{ 1.0f, 0.3f, 0.5f }.Normalized() ) )
+				.SetTranslation( cube_index,
+								 CUBES_ORIGIN + 
 								 Vector3( Engine::Math::Cos( random_xz_angle ), 
 										  Engine::Math::Sin( inclination_angle ),
 										  Engine::Math::Sin( random_xz_angle ) )
@@ -213,12 +223,12 @@ void SandboxApplication::Initialize()
 		} );
 
 		/* First cube is reserved: Put it on the ground to test shadows etc. */
-		cube_transform_array[ 0 ]
-			.SetTranslation( 1.0f, 0.5f, -3.0f );
+		cube_transform_array
+			.SetTranslation( 0, Vector3( 1.0f, 0.5f, -3.0f ) );
 	}
 
-	for( auto cube_index = 0; cube_index < CUBE_COUNT; cube_index++ )
-		cube_instance_data_array[ cube_index ] = cube_transform_array[ cube_index ].GetFinalMatrix().Transposed(); // Vertex attribute matrices' major can not be flipped in GLSL.
+	cube_transform_array.WriteTransposedFinalMatrices( cube_instance_data_array, false /* => Write all. */ );
+	cube_transform_array.ResetDirtyFlags();
 
 	window_transform_array[ 0 ].SetTranslation( Vector3( -1.5f,	5.0f, -0.48f ) );
 	window_transform_array[ 1 ].SetTranslation( Vector3(  1.5f,	5.0f,  0.51f ) );
@@ -468,12 +478,16 @@ void SandboxApplication::Update()
 
 	/* Instanced cube's transform: */
 	{
-		Radians old_heading, old_pitch, old_bank;
-		Engine::Math::QuaternionToEuler( cube_transform_array[ 0 ].GetRotation(), old_heading, old_pitch, old_bank );
-		cube_transform_array[ 0 ].SetRotation( old_heading + angle_increment * time_delta, old_pitch, old_bank );
-		cube_instance_data_array[ 0 ] = cube_transform_array[ 0 ].GetFinalMatrix().Transposed(); // Vertex attribute matrices' major can not be flipped in GLSL.
-		
-		cube_mesh_instanced.UpdateInstanceData_Partial( std::span( cube_instance_data_array.data(), 1 ), 0 );
+		/* Pre-multiplying by a rotation around world up increments the heading, without the round trip through Euler angles. */
+		cube_transform_array.SetRotation( 0, ( Quaternion( angle_increment * time_delta, Vector3::Up() ) * cube_transform_array.GetRotation( 0 ) ).Normalized() );
+
+		/* Only the dirty cubes are written & uploaded. */
+		const auto [ dirty_begin, dirty_end ] = cube_transform_array.DirtyRange();
+		cube_transform_array.WriteTransposedFinalMatrices( cube_instance_data_array );
+		cube_transform_array.ResetDirtyFlags();
+
+		cube_mesh_instanced.UpdateInstanceData_Partial( std::span( cube_instance_data_array.data() + dirty_begin, dirty_end - dirty_begin ),
+														dirty_begin * sizeof( Matrix4x4 ) );
 	}
 
 	/* Parallax cube's transform: */
@@ -1022,9 +1036,9 @@ void SandboxApplication::ResetLightingData()
 			.is_enabled = true,
 			.data =
 			{
-				.ambient_and_attenuation_constant = { .color = {},			 .scalar = 0.06f	},
-				.diffuse_and_attenuation_linear   = { .color = random_color, .scalar = 0.001f	},
-				.specular_attenuation_quadratic   = { .color = random_color, .scalar = 0.0375f	},
+				.ambient_and_attenuation_constant   = { .color = {},			 .scalar = 0.06f	},
+				.diffuse_and_attenuation_linear     = { .color = random_color, .scalar = 0.001f	},
+				.specular_and_attenuation_quadratic = { .color = random_color, .scalar = 0.0375f	},
 			},
 			.transform = &light_point_transform_array[ i ]
 		};
@@ -1236,6 +1250,9 @@ void SandboxApplication::UnloadModel( ModelInfo& model_info_to_be_loaded )
 		renderer.RemoveRenderable( &renderable_to_remove );
 
 	model_info_to_be_loaded.model_instance = {};
+
+	/* The Model's Shader may not be used by any other Renderable; Its program is freed until it is needed again. */
+	Engine::ShaderVariantCache::EvictUnused( renderer );
 }
 
 void SandboxApplication::ReplaceMeteoriteAndCubeRenderables( bool use_meteorites )
@@ -9,6 +9,7 @@
 #include "Engine/Graphics/Texture.h"
 #include "Engine/Scene/Camera.h"
 #include "Engine/Scene/CameraController_Flight.h"
+#include "Engine/Scene/TransformArray.h"
 
 #include "Engine/DefineMathTypes.h"
 
@@ -205,7 +206,7 @@ private:
 	Engine::Transform light_spot_transform;
 
 	/* GameObjects: */
-	std::vector< Engine::Transform > cube_transform_array;
+	Engine::TransformArray cube_transform_array;
 	std::vector< Engine::Transform > cube_reflected_transform_array;
 
 	Engine::Transform cube_parallax_transform;
@@ -0,0 +1,92 @@
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Builds & runs the headless tests in this directory: Plain executables checking engine code that does not need a GL context, mostly against reference implementations.
+# They are run from Engine/Engine (so that they can reach the engine's assets the same way the engine does) & fail by returning non-zero.
+#   python RunTests.py [--benchmark] [test names...]
+# --benchmark also takes the measurements quoted in the commit messages; Only meaningful for optimized builds, which is what this script makes.
+# Uses the compiler in CXX if it is defined, MSVC's cl if it is in PATH (i.e., a developer command prompt), g++ or clang++ otherwise.
+
+root_directory_path   = os.path.dirname( os.path.realpath( __file__ ) )
+engine_directory_path = os.path.realpath( os.path.join( root_directory_path, '..', 'Engine', 'Engine' ) )
+
+# Test source -> engine translation units it needs (relative to Engine/Engine).
+tests = {
+    'Test_ShaderSourceScanner.cpp'       : [ 'Graphics/ShaderSourceScanner.cpp' ],
+    'Test_MatrixSIMD.cpp'                : [],
+    'Test_MatrixInverse.cpp'             : [],
+    'Test_QuaternionBatch.cpp'           : [ 'Math/QuaternionBatch.cpp' ],
+    'Test_FastMath.cpp'                  : [ 'Math/FastMath.cpp' ],
+    'Test_MeshUtility_WriteVertices.cpp' : [ 'Graphics/MeshUtility.cpp', 'Graphics/VertexCompression.cpp' ],
+    'Test_MeshUtility_Tangents.cpp'      : [ 'Graphics/MeshUtility.cpp' ],
+    'Test_MeshOptimization.cpp'          : [ 'Graphics/MeshOptimization.cpp' ],
+    'Test_VertexCompression.cpp'         : [ 'Graphics/VertexCompression.cpp', 'Math/Matrix.cpp' ],
+    'Test_Random.cpp'                    : [ 'Math/Random.cpp' ],
+    'Test_TransformArray.cpp'            : [ 'Scene/TransformArray.cpp', 'Scene/Transform.cpp', 'Math/Matrix.cpp' ],
+    'Test_ModelCache.cpp'                : [ 'Graphics/ModelCache.cpp', 'Core/Serialization.cpp', 'Core/Platform_FileMapping.cpp', 'Graphics/MeshOptimization.cpp', 'Graphics/VertexCompression.cpp' ],
+}
+
+# Tests whose engine code uses the std::execution::par algorithms; libstdc++ implements those on top of TBB, which has to be linked explicitly (MSVC needs nothing).
+tests_using_parallel_algorithms = { 'Test_MeshUtility_WriteVertices.cpp', 'Test_MeshUtility_Tangents.cpp', 'Test_TransformArray.cpp' }
+
+def FindCompiler():
+    for compiler in [ os.environ.get( 'CXX' ), 'cl', 'g++', 'clang++' ]:
+        if compiler != None and shutil.which( compiler ) != None:
+            return compiler
+
+    return None
+
+def IsMSVC( compiler ):
+    return os.path.splitext( os.path.basename( compiler ) )[ 0 ].lower() == 'cl'
+
+def CompileCommand( compiler, source_file_paths, executable_path, object_directory_path, uses_parallel_algorithms ):
+    if IsMSVC( compiler ):
+        return [ compiler, '/nologo', '/std:c++20', '/O2', '/EHsc', '/permissive-', '/DNDEBUG', '/I' + engine_directory_path, '/I' + root_directory_path,
+                 '/Fe' + executable_path, '/Fo' + object_directory_path + os.sep ] + source_file_paths
+
+    return [ compiler, '-std=c++20', '-O2', '-DNDEBUG', '-I' + engine_directory_path, '-I' + root_directory_path, '-o', executable_path ] + source_file_paths + [ '-pthread' ] + ( [ '-ltbb' ] if uses_parallel_algorithms else [] )
+
+def Main():
+    arguments = sys.argv[ 1: ]
+    benchmark = '--benchmark' in arguments
+    selection = [ argument for argument in arguments if argument != '--benchmark' ]
+
+    compiler = FindCompiler()
+    if compiler == None:
+        print( 'RunTests.py: No C++ compiler could be found (tried CXX, cl, g++ & clang++).' )
+        return 1
+
+    failed_tests = []
+    with tempfile.TemporaryDirectory() as build_directory_path:
+        for test_file, engine_source_files in tests.items():
+            test_name = os.path.splitext( test_file )[ 0 ]
+            if selection and test_name not in selection:
+                continue
+
+            print( test_name + ':' )
+
+            source_file_paths = [ os.path.join( root_directory_path, test_file ) ] + [ os.path.join( engine_directory_path, file ) for file in engine_source_files ]
+            executable_path   = os.path.join( build_directory_path, test_name + ( '.exe' if os.name == 'nt' else '' ) )
+
+            result = subprocess.run( CompileCommand( compiler, source_file_paths, executable_path, build_directory_path, test_file in tests_using_parallel_algorithms ), capture_output = True, text = True )
+            if result.returncode != 0:
+                print( result.stdout + result.stderr )
+                print( '\tFAILED to compile.' )
+                failed_tests.append( test_name )
+                continue
+
+            if subprocess.run( [ executable_path ] + ( [ '--benchmark' ] if benchmark else [] ), cwd = engine_directory_path ).returncode != 0:
+                failed_tests.append( test_name )
+
+    if failed_tests:
+        print( '\nRunTests.py: ' + str( len( failed_tests ) ) + ' test(s) FAILED: ' + ', '.join( failed_tests ) + '.' )
+        return 1
+
+    print( '\nRunTests.py: All tests passed.' )
+    return 0
+
+if __name__ == '__main__':
+    sys.exit( Main() )
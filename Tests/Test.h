@@ -0,0 +1,81 @@
+#pragma once
+
+// std Includes.
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+/* Shared by the headless tests in this directory; See RunTests.py for how they are built & run.
+ * Tests are plain executables: They report every failed check & return non-zero if there were any. Measurements are only taken when asked for (--benchmark),
+ * as they take a while & their numbers are only meaningful for optimized builds anyway. */
+namespace Test
+{
+	inline int failure_count = 0;
+	inline bool benchmarks_are_enabled = false;
+
+	inline void ParseArguments( const int argument_count, char** arguments )
+	{
+		for( auto i = 1; i < argument_count; i++ )
+			if( std::string_view( arguments[ i ] ) == "--benchmark" )
+				benchmarks_are_enabled = true;
+	}
+
+	/* Returns the condition, so that callers can print more details about the failure. */
+	inline bool Check( const bool condition, const std::string_view description )
+	{
+		if( not condition )
+		{
+			failure_count++;
+			std::cout << "\tFAILED: " << description << "\n";
+		}
+
+		return condition;
+	}
+
+	template< typename Type >
+	bool CheckBitwiseEqual( const Type* lhs, const Type* rhs, const std::size_t count, const std::string_view description )
+	{
+		return Check( std::memcmp( lhs, rhs, sizeof( Type ) * count ) == 0, description );
+	}
+
+	/* Best (i.e., least disturbed) of repeat_count runs. */
+	template< typename Function >
+	double MeasureMilliseconds( Function&& function, const int repeat_count = 7 )
+	{
+		double best = std::numeric_limits< double >::max();
+		for( auto repeat = 0; repeat < repeat_count; repeat++ )
+		{
+			const auto start_time = std::chrono::steady_clock::now();
+			function();
+			best = std::min( best, std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start_time ).count() );
+		}
+
+		return best;
+	}
+
+	inline void Report( const std::string_view name, const double milliseconds )
+	{
+		std::cout << "\t" << name << ": " << milliseconds << " ms\n";
+	}
+
+	/* Keeps the compiler from optimizing away work whose result is not used otherwise. */
+	template< typename Type >
+	void DoNotOptimizeAway( const Type& value )
+	{
+		static volatile char sink;
+		sink = *reinterpret_cast< const volatile char* >( &value );
+	}
+
+	inline int Result()
+	{
+		if( failure_count == 0 )
+			std::cout << "\tAll checks passed.\n";
+		else
+			std::cout << "\t" << failure_count << " check(s) FAILED.\n";
+
+		return failure_count == 0 ? 0 : 1;
+	}
+}
@@ -0,0 +1,124 @@
+// Engine Includes.
+#include "Math/FastMath.hpp"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <cmath>
+#include <vector>
+
+using namespace Engine;
+
+/* Checks the error bounds documented in FastMath.hpp against the double-precision std functions. */
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	{
+		double sin_error = 0.0, cos_error = 0.0, sincos_error = 0.0;
+		for( double angle = -1e4; angle <= 1e4; angle += 0.00137 )
+		{
+			const float angle_float = ( float )angle;
+			const double sin = std::sin( ( double )angle_float ), cos = std::cos( ( double )angle_float );
+
+			sin_error = std::max( sin_error, std::abs( Math::Fast::Sin( Radians( angle_float ) ) - sin ) );
+			cos_error = std::max( cos_error, std::abs( Math::Fast::Cos( Radians( angle_float ) ) - cos ) );
+
+			float fast_sin, fast_cos;
+			Math::Fast::SinCos( Radians( angle_float ), fast_sin, fast_cos );
+			sincos_error = std::max( { sincos_error, std::abs( fast_sin - sin ), std::abs( fast_cos - cos ) } );
+		}
+
+		std::cout << "\tMax. absolute error for |angle| <= 10^4: Sin " << sin_error << ", Cos " << cos_error << ", SinCos " << sincos_error << "\n";
+		Test::Check( sin_error	  <= 1e-7, "Fast::Sin() is within 1e-7." );
+		Test::Check( cos_error	  <= 1e-7, "Fast::Cos() is within 1e-7." );
+		Test::Check( sincos_error <= 1e-7, "Fast::SinCos() is within 1e-7." );
+	}
+
+	{
+		double atan2_error = 0.0;
+		for( double y = -3.0; y <= 3.0; y += 0.0037 )
+			for( double x = -3.0; x <= 3.0; x += 0.0041 )
+				atan2_error = std::max( atan2_error, std::abs( ( double )Math::Fast::Atan2( ( float )y, ( float )x ).Value() - std::atan2( ( double )( float )y, ( double )( float )x ) ) );
+
+		double acos_error = 0.0;
+		for( double cosine = -1.0; cosine <= 1.0; cosine += 1e-6 )
+			acos_error = std::max( acos_error, std::abs( ( double )Math::Fast::Acos( ( float )cosine ).Value() - std::acos( ( double )( float )cosine ) ) );
+
+		std::cout << "\tMax. absolute error: Atan2 " << atan2_error << ", Acos " << acos_error << "\n";
+		Test::Check( atan2_error <= 1.2e-5, "Fast::Atan2() is within 1.2e-5." );
+		Test::Check( Math::Fast::Atan2( 0.0f, 0.0f ).Value() == 0.0f, "Fast::Atan2( 0, 0 ) is 0." );
+		Test::Check( acos_error <= 7e-5, "Fast::Acos() is within 7e-5." );
+	}
+
+	{
+		double inverse_sqrt_error = 0.0, sqrt_error = 0.0;
+		for( double value = 1e-20; value < 1e20; value *= 1.0001 )
+		{
+			const float value_float = ( float )value;
+			inverse_sqrt_error = std::max( inverse_sqrt_error, std::abs( Math::Fast::InverseSqrt( value_float ) * std::sqrt( ( double )value_float ) - 1.0 ) );
+			sqrt_error		   = std::max( sqrt_error,		   std::abs( Math::Fast::Sqrt( value_float ) / std::sqrt( ( double )value_float ) - 1.0 ) );
+		}
+
+		std::cout << "\tMax. relative error: InverseSqrt " << inverse_sqrt_error << ", Sqrt " << sqrt_error << "\n";
+#ifdef ENGINE_MATH_SIMD
+		Test::Check( inverse_sqrt_error <= 3e-7, "Fast::InverseSqrt() is within 3e-7." );
+		Test::Check( sqrt_error			<= 3e-7, "Fast::Sqrt() is within 3e-7." );
+#else
+		Test::Check( inverse_sqrt_error <= 5e-6, "Fast::InverseSqrt() is within 5e-6." );
+		Test::Check( sqrt_error			<= 5e-6, "Fast::Sqrt() is within 5e-6." );
+#endif
+		Test::Check( Math::Fast::Sqrt( 0.0f ) == 0.0f, "Fast::Sqrt( 0 ) is exactly 0." );
+	}
+
+	/* Arrays; Odd count, so that the scalar remainder is exercised too: */
+	constexpr int count = 1'000'003;
+	std::vector< float > angles( count ), positives( count ), result( count );
+	for( auto i = 0; i < count; i++ )
+	{
+		angles[ i ]	   = ( i - count / 2 ) * 0.0173f;
+		positives[ i ] = 1e-10f + i * 1.7f;
+	}
+
+	{
+		double sin_error = 0.0, cos_error = 0.0, inverse_sqrt_error = 0.0;
+
+		Math::Fast::Sin( angles, result );
+		for( auto i = 0; i < count; i++ )
+			sin_error = std::max( sin_error, std::abs( result[ i ] - std::sin( ( double )angles[ i ] ) ) );
+
+		Math::Fast::Cos( angles, result );
+		for( auto i = 0; i < count; i++ )
+			cos_error = std::max( cos_error, std::abs( result[ i ] - std::cos( ( double )angles[ i ] ) ) );
+
+		Math::Fast::InverseSqrt( positives, result );
+		for( auto i = 0; i < count; i++ )
+			inverse_sqrt_error = std::max( inverse_sqrt_error, std::abs( result[ i ] * std::sqrt( ( double )positives[ i ] ) - 1.0 ) );
+
+		std::cout << "\tArrays: Sin " << sin_error << ", Cos " << cos_error << ", InverseSqrt (relative) " << inverse_sqrt_error << "\n";
+		Test::Check( sin_error			<= 1e-7, "Fast::Sin( span ) is within 1e-7." );
+		Test::Check( cos_error			<= 1e-7, "Fast::Cos( span ) is within 1e-7." );
+		Test::Check( inverse_sqrt_error <= 3e-7, "Fast::InverseSqrt( span ) is within 3e-7." );
+	}
+
+	if( Test::benchmarks_are_enabled )
+	{
+		std::cout << "\t" << count << " elements:\n";
+
+		Test::Report( "std::sin                 ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < count; i++ ) result[ i ] = std::sin( angles[ i ] ); } ) );
+		Test::Report( "Fast::Sin                ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < count; i++ ) result[ i ] = Math::Fast::Sin( Radians( angles[ i ] ) ); } ) );
+		Test::Report( "Fast::Sin( span )        ", Test::MeasureMilliseconds( [ & ]() { Math::Fast::Sin( angles, result ); } ) );
+		Test::DoNotOptimizeAway( result[ 0 ] );
+
+		Test::Report( "1 / std::sqrt            ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < count; i++ ) result[ i ] = 1.0f / std::sqrt( positives[ i ] ); } ) );
+		Test::Report( "Fast::InverseSqrt( span )", Test::MeasureMilliseconds( [ & ]() { Math::Fast::InverseSqrt( positives, result ); } ) );
+		Test::DoNotOptimizeAway( result[ 0 ] );
+
+		Test::Report( "std::atan2               ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < count; i++ ) result[ i ] = std::atan2( angles[ i ], positives[ i ] ); } ) );
+		Test::Report( "Fast::Atan2              ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < count; i++ ) result[ i ] = Math::Fast::Atan2( angles[ i ], positives[ i ] ).Value(); } ) );
+		Test::DoNotOptimizeAway( result[ 0 ] );
+	}
+
+	return Test::Result();
+}
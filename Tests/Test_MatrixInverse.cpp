@@ -0,0 +1,137 @@
+// Engine Includes.
+#include "Math/Matrix.hpp"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <cmath>
+#include <random>
+
+using namespace Engine;
+
+using Matrix4x4_Double = Math::Matrix< double, 4, 4 >;
+
+/* All three have to stay usable in constant expressions (the SIMD kernel is skipped then): */
+constexpr bool InversesAreConstexpr()
+{
+	Matrix4x4 matrix;
+	matrix.SetTranslation( Vector3( 1.0f, 2.0f, 3.0f ) );
+
+	return matrix.Inverse()[ 3 ][ 0 ] == -1.0f && matrix.InverseAffine()[ 3 ][ 1 ] == -2.0f && matrix.InverseRigid()[ 3 ][ 2 ] == -3.0f && matrix.Determinant() == 1.0f;
+}
+static_assert( InversesAreConstexpr() );
+
+/* Max. absolute deviation of matrix * inverse from identity. */
+double ErrorFromIdentity( const Matrix4x4& matrix, const Matrix4x4& inverse )
+{
+	const auto product = matrix * inverse;
+
+	double error = 0.0;
+	for( auto i = 0; i < 4; i++ )
+		for( auto j = 0; j < 4; j++ )
+			error = std::max( error, ( double )std::abs( product[ i ][ j ] - ( i == j ? 1.0f : 0.0f ) ) );
+
+	return error;
+}
+
+/* Row-major, counter-clockwise rotation around the given unit axis; Built by hand to keep the test independent of the rest of the math library. */
+Matrix3x3 RotationAroundAxis( const Vector3& axis, const float angle )
+{
+	const float c = std::cos( angle ), s = std::sin( angle ), t = 1.0f - c;
+	const float x = axis.X(), y = axis.Y(), z = axis.Z();
+
+	return Matrix3x3( Vector3( t * x * x + c,		t * x * y + s * z,	t * x * z - s * y ),
+					  Vector3( t * x * y - s * z,	t * y * y + c,		t * y * z + s * x ),
+					  Vector3( t * x * z + s * y,	t * y * z - s * x,	t * z * z + c ) );
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	std::mt19937 generator( 1 );
+	std::uniform_real_distribution< float > distribution( -2.0f, 2.0f );
+
+	double general_error = 0.0, general_vs_double_error = 0.0, affine_error = 0.0, rigid_error = 0.0;
+	int determinant_mismatch_count = 0;
+
+	for( auto iteration = 0; iteration < 20'000; iteration++ )
+	{
+		/* General: */
+		Matrix4x4 matrix;
+		Matrix4x4_Double matrix_double;
+		for( auto i = 0; i < 4; i++ )
+			for( auto j = 0; j < 4; j++ )
+				matrix_double[ i ][ j ] = matrix[ i ][ j ] = distribution( generator );
+
+		/* Skip (nearly) singular matrices; Their inverses are legitimately inaccurate. */
+		const double determinant_double = matrix_double.Determinant();
+		if( std::abs( determinant_double ) >= 0.1 )
+		{
+			const auto inverse        = matrix.Inverse();
+			const auto inverse_double = matrix_double.Inverse(); // Scalar path.
+
+			general_error = std::max( general_error, ErrorFromIdentity( matrix, inverse ) );
+			for( auto i = 0; i < 4; i++ )
+				for( auto j = 0; j < 4; j++ )
+					general_vs_double_error = std::max( general_vs_double_error, std::abs( inverse[ i ][ j ] - inverse_double[ i ][ j ] ) / ( 1.0 + std::abs( inverse_double[ i ][ j ] ) ) );
+
+			determinant_mismatch_count += std::abs( matrix.Determinant() - determinant_double ) > 1e-3 * std::max( 1.0, std::abs( determinant_double ) );
+		}
+
+		/* Rigid & SRT: */
+		const Vector3 axis( Vector3( distribution( generator ), distribution( generator ), distribution( generator ) ).Normalized() );
+		const auto rotation = RotationAroundAxis( axis, distribution( generator ) );
+		const Vector3 translation( distribution( generator ) * 10.0f, distribution( generator ) * 10.0f, distribution( generator ) * 10.0f );
+
+		const Matrix4x4 rotation_translation( rotation, translation );
+
+		Matrix4x4 scaling;
+		scaling.SetDiagonals( Vector3( 0.2f + std::abs( distribution( generator ) ), 0.2f + std::abs( distribution( generator ) ), 0.2f + std::abs( distribution( generator ) ) ) );
+		const auto scaling_rotation_translation = scaling * rotation_translation;
+
+		affine_error = std::max( affine_error, ErrorFromIdentity( scaling_rotation_translation, scaling_rotation_translation.InverseAffine() ) );
+		rigid_error  = std::max( rigid_error,  ErrorFromIdentity( rotation_translation, rotation_translation.InverseRigid() ) );
+	}
+
+	std::cout << "\tMax. error from identity: general " << general_error << ", affine " << affine_error << ", rigid " << rigid_error
+			  << "; Max. relative deviation of the general inverse from the double-precision one: " << general_vs_double_error << "\n";
+
+	Test::Check( general_error			 < 1e-4, "Inverse() * matrix is close to identity." );
+	Test::Check( general_vs_double_error < 1e-4, "Inverse() matches the double-precision scalar path." );
+	Test::Check( affine_error			 < 1e-5, "InverseAffine() * matrix is close to identity." );
+	Test::Check( rigid_error			 < 1e-5, "InverseRigid() * matrix is close to identity." );
+	Test::Check( determinant_mismatch_count == 0, "Determinant() matches the double-precision one." );
+
+	if( Test::benchmarks_are_enabled )
+	{
+		Matrix4x4 matrix;
+		for( auto i = 0; i < 4; i++ )
+			for( auto j = 0; j < 4; j++ )
+				matrix[ i ][ j ] = distribution( generator );
+
+		constexpr int repeat_count = 1'000'000;
+		std::cout << "\tInverting a matrix " << repeat_count << " times (chained):\n";
+
+		Test::Report( "Inverse()", Test::MeasureMilliseconds( [ & ]()
+		{
+			auto inverse = matrix;
+			for( auto repeat = 0; repeat < repeat_count; repeat++ )
+				inverse = inverse.Inverse();
+
+			Test::DoNotOptimizeAway( inverse );
+		}, 3 ) );
+
+		Test::Report( "InverseAffine()", Test::MeasureMilliseconds( [ & ]()
+		{
+			auto inverse = Matrix4x4( RotationAroundAxis( Vector3( 0.0f, 1.0f, 0.0f ), 0.5f ), Vector3( 1.0f, 2.0f, 3.0f ) );
+			for( auto repeat = 0; repeat < repeat_count; repeat++ )
+				inverse = inverse.InverseAffine();
+
+			Test::DoNotOptimizeAway( inverse );
+		}, 3 ) );
+	}
+
+	return Test::Result();
+}
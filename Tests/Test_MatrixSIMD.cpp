@@ -0,0 +1,118 @@
+// Engine Includes.
+#include "Math/Matrix.hpp"
+#include "Math/SIMD.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <random>
+#include <vector>
+
+using namespace Engine;
+
+/* The scalar loops Matrix used before the SIMD kernels; Same order of operations (& no FMA), so results have to match bit for bit. */
+template< typename MatrixType >
+MatrixType Multiply_Scalar( const MatrixType& lhs, const MatrixType& rhs )
+{
+	MatrixType result( ZERO_INITIALIZATION );
+	for( auto i = 0; i < 4; i++ )
+		for( auto j = 0; j < 4; j++ )
+			for( auto k = 0; k < 4; k++ )
+				result[ i ][ j ] += lhs[ i ][ k ] * rhs[ k ][ j ];
+
+	return result;
+}
+
+template< typename VectorType, typename MatrixType >
+VectorType Multiply_Scalar( const VectorType& lhs, const MatrixType& rhs )
+{
+	VectorType result;
+	for( auto j = 0; j < VectorType::Dimension(); j++ )
+		for( auto k = 0; k < VectorType::Dimension(); k++ )
+			result[ j ] += lhs[ k ] * rhs[ k ][ j ];
+
+	return result;
+}
+
+/* Constant-evaluated products have to keep using the scalar path: */
+constexpr Matrix4x4 CONSTANT_MATRIX_PRODUCT = Matrix4x4() * Matrix4x4();
+static_assert( CONSTANT_MATRIX_PRODUCT[ 1 ][ 1 ] == 1.0f && CONSTANT_MATRIX_PRODUCT[ 0 ][ 1 ] == 0.0f );
+constexpr Vector4 CONSTANT_VECTOR_PRODUCT = Vector4( 1.0f, 2.0f, 3.0f, 4.0f ) * Matrix4x4();
+static_assert( CONSTANT_VECTOR_PRODUCT[ 3 ] == 4.0f );
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+#ifdef ENGINE_MATH_SIMD
+	std::cout << "\tSIMD kernels are enabled.\n";
+#else
+	std::cout << "\tSIMD kernels are NOT enabled; Testing the scalar path against itself.\n";
+#endif
+
+	std::mt19937 generator( 1 );
+	std::uniform_real_distribution< float > distribution( -10.0f, 10.0f );
+
+	std::vector< Matrix4x4 > matrices( 1024 );
+	for( auto& matrix : matrices )
+		for( auto i = 0; i < 4; i++ )
+			for( auto j = 0; j < 4; j++ )
+				matrix[ i ][ j ] = distribution( generator );
+
+	int matrix_mismatch_count = 0, vector4_mismatch_count = 0, vector3_mismatch_count = 0;
+	for( auto index = 0; index + 1 < matrices.size(); index++ )
+	{
+		const auto product           = matrices[ index ] * matrices[ index + 1 ];
+		const auto product_reference = Multiply_Scalar( matrices[ index ], matrices[ index + 1 ] );
+		matrix_mismatch_count += std::memcmp( &product, &product_reference, sizeof( Matrix4x4 ) ) != 0;
+
+		const Vector4 vector4( distribution( generator ), distribution( generator ), distribution( generator ), distribution( generator ) );
+		const auto vector4_product           = vector4 * matrices[ index ];
+		const auto vector4_product_reference = Multiply_Scalar( vector4, matrices[ index ] );
+		vector4_mismatch_count += std::memcmp( &vector4_product, &vector4_product_reference, sizeof( Vector4 ) ) != 0;
+
+		Matrix3x3 matrix3x3;
+		for( auto i = 0; i < 3; i++ )
+			for( auto j = 0; j < 3; j++ )
+				matrix3x3[ i ][ j ] = distribution( generator );
+
+		const Vector3 vector3( distribution( generator ), distribution( generator ), distribution( generator ) );
+		const auto vector3_product           = vector3 * matrix3x3;
+		const auto vector3_product_reference = Multiply_Scalar( vector3, matrix3x3 );
+		vector3_mismatch_count += std::memcmp( &vector3_product, &vector3_product_reference, sizeof( Vector3 ) ) != 0;
+	}
+
+	Test::Check( matrix_mismatch_count  == 0, "Matrix4x4 * Matrix4x4 matches the scalar loops bit for bit." );
+	Test::Check( vector4_mismatch_count == 0, "Vector4 * Matrix4x4 matches the scalar loops bit for bit." );
+	Test::Check( vector3_mismatch_count == 0, "Vector3 * Matrix3x3 matches the scalar loops bit for bit." );
+
+	if( Test::benchmarks_are_enabled )
+	{
+		/* Chained, so that every product depends on the previous one (latency, rather than throughput). */
+		constexpr int repeat_count = 2'000;
+		std::cout << "\tChaining " << repeat_count * matrices.size() << " Matrix4x4 products:\n";
+
+		Test::Report( "SIMD  ", Test::MeasureMilliseconds( [ & ]()
+		{
+			Matrix4x4 accumulator;
+			for( auto repeat = 0; repeat < repeat_count; repeat++ )
+				for( const auto& matrix : matrices )
+					accumulator = matrix * accumulator;
+
+			Test::DoNotOptimizeAway( accumulator );
+		}, 3 ) );
+
+		Test::Report( "scalar", Test::MeasureMilliseconds( [ & ]()
+		{
+			Matrix4x4 accumulator;
+			for( auto repeat = 0; repeat < repeat_count; repeat++ )
+				for( const auto& matrix : matrices )
+					accumulator = Multiply_Scalar( matrix, accumulator );
+
+			Test::DoNotOptimizeAway( accumulator );
+		}, 3 ) );
+	}
+
+	return Test::Result();
+}
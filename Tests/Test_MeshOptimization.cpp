@@ -0,0 +1,205 @@
+// Engine Includes.
+#include "Graphics/MeshOptimization.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+
+/* ( quad_count + 1 )^2 vertices in the XY plane; Quads are emitted row by row, as 2 triangles each. */
+struct Grid
+{
+	std::vector< Vector3 > positions;
+	std::vector< std::uint32_t > indices;
+};
+
+Grid GenerateGrid( const std::uint32_t quad_count )
+{
+	Grid grid;
+	for( std::uint32_t y = 0; y <= quad_count; y++ )
+		for( std::uint32_t x = 0; x <= quad_count; x++ )
+			grid.positions.emplace_back( ( float )x, ( float )y, 0.0f );
+
+	for( std::uint32_t y = 0; y < quad_count; y++ )
+	{
+		for( std::uint32_t x = 0; x < quad_count; x++ )
+		{
+			const std::uint32_t bottom_left = y * ( quad_count + 1 ) + x, bottom_right = bottom_left + 1, top_left = bottom_left + quad_count + 1, top_right = top_left + 1;
+			grid.indices.insert( grid.indices.end(), { bottom_left, top_left, bottom_right, bottom_right, top_left, top_right } );
+		}
+	}
+
+	return grid;
+}
+
+void ShuffleTriangles( std::vector< std::uint32_t >& indices )
+{
+	std::vector< std::array< std::uint32_t, 3 > > triangles( indices.size() / 3 );
+	std::memcpy( triangles.data(), indices.data(), indices.size() * sizeof( std::uint32_t ) );
+
+	std::shuffle( triangles.begin(), triangles.end(), std::mt19937( 7 ) );
+
+	std::memcpy( indices.data(), triangles.data(), indices.size() * sizeof( std::uint32_t ) );
+}
+
+/* Triangles rotated so that their smallest index comes first (which keeps the winding) & then sorted; Equal for index buffers holding the same triangles in any order. */
+template< typename IndexType >
+std::vector< std::array< std::uint32_t, 3 > > CanonicalTriangles( const std::vector< IndexType >& indices )
+{
+	std::vector< std::array< std::uint32_t, 3 > > triangles;
+	triangles.reserve( indices.size() / 3 );
+
+	for( std::size_t base_index = 0; base_index < indices.size(); base_index += 3 )
+	{
+		std::array< std::uint32_t, 3 > triangle{ indices[ base_index ], indices[ base_index + 1 ], indices[ base_index + 2 ] };
+		std::rotate( triangle.begin(), std::min_element( triangle.begin(), triangle.end() ), triangle.end() );
+		triangles.push_back( triangle );
+	}
+
+	std::sort( triangles.begin(), triangles.end() );
+	return triangles;
+}
+
+bool IsClose( const float value, const float expected ) { return std::abs( value - expected ) <= 1e-4f; }
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* Known values: */
+	{
+		const std::vector< std::uint32_t > triangle{ 0, 1, 2 };
+		const auto triangle_statistics = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( triangle ), 3 );
+		Test::Check( IsClose( triangle_statistics.acmr, 3.0f ) && IsClose( triangle_statistics.atvr, 1.0f ), "A single triangle has ACMR 3 & ATVR 1." );
+
+		const std::vector< std::uint32_t > quad{ 0, 2, 1, 1, 2, 3 };
+		const auto quad_statistics = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( quad ), 4 );
+		Test::Check( IsClose( quad_statistics.acmr, 2.0f ) && IsClose( quad_statistics.atvr, 1.0f ), "A quad has ACMR 2 & ATVR 1." );
+
+		/* Row by row, with rows longer than the cache: Every row loads its own 2 * ( W + 1 ) vertices, as the previous row's are evicted by then.
+		 * ACMR = 2 * ( W + 1 ) / 2W & ATVR = 2 * H * ( W + 1 ) / ( ( W + 1 ) * ( H + 1 ) ). */
+		const auto grid = GenerateGrid( 100 );
+		const auto grid_statistics = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( grid.indices ), grid.positions.size() );
+		std::cout << "\t100x100 quads, row by row: ACMR " << grid_statistics.acmr << ", ATVR " << grid_statistics.atvr << "\n";
+		Test::Check( IsClose( grid_statistics.acmr, 101.0f / 100.0f ) && IsClose( grid_statistics.atvr, 200.0f / 101.0f ), "Row by row grid has ACMR ( W + 1 ) / W & ATVR 2H / ( H + 1 )." );
+	}
+
+	/* Optimization of a shuffled grid: */
+	{
+		auto grid = GenerateGrid( 400 );
+		ShuffleTriangles( grid.indices );
+
+		const auto original_triangles = CanonicalTriangles( grid.indices );
+		const std::size_t triangle_count = grid.indices.size() / 3;
+
+		const auto statistics_before = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( grid.indices ), grid.positions.size() );
+
+		auto indices = grid.indices;
+		const auto cluster_starts = MeshOptimization::OptimizeVertexCache( std::span< std::uint32_t >( indices ), grid.positions.size() );
+
+		const auto statistics_after = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( indices ), grid.positions.size() );
+
+		std::cout << "\t400x400 quads, shuffled: ACMR " << statistics_before.acmr << " -> " << statistics_after.acmr << ", ATVR " << statistics_before.atvr << " -> " << statistics_after.atvr
+				  << " (" << cluster_starts.size() << " clusters)\n";
+		Test::Check( statistics_before.acmr > 2.5f, "Shuffled grid has a poor ACMR to begin with." );
+		Test::Check( statistics_after.acmr < 0.7f, "OptimizeVertexCache() brings the ACMR below 0.7." );
+		Test::Check( statistics_after.atvr < 1.4f, "OptimizeVertexCache() brings the ATVR below 1.4." );
+		Test::Check( CanonicalTriangles( indices ) == original_triangles, "OptimizeVertexCache() keeps the triangles & their winding." );
+
+		Test::Check( not cluster_starts.empty() && cluster_starts.front() == 0 && std::is_sorted( cluster_starts.cbegin(), cluster_starts.cend() ) &&
+					 std::adjacent_find( cluster_starts.cbegin(), cluster_starts.cend() ) == cluster_starts.cend() && cluster_starts.back() < triangle_count,
+					 "Cluster starts are strictly increasing triangle indices, starting at 0." );
+
+		{
+			auto indices_32 = GenerateGrid( 100 ).indices;
+			ShuffleTriangles( indices_32 );
+			std::vector< std::uint16_t > indices_16( indices_32.cbegin(), indices_32.cend() );
+
+			MeshOptimization::OptimizeVertexCache( std::span< std::uint32_t >( indices_32 ), 101 * 101 );
+			MeshOptimization::OptimizeVertexCache( std::span< std::uint16_t >( indices_16 ), 101 * 101 );
+			Test::Check( std::equal( indices_16.cbegin(), indices_16.cend(), indices_32.cbegin() ), "16-bit indices are reordered the same as 32-bit ones." );
+		}
+
+		MeshOptimization::OptimizeOverdraw( std::span< std::uint32_t >( indices ), grid.positions, cluster_starts );
+		Test::Check( CanonicalTriangles( indices ) == original_triangles, "OptimizeOverdraw() keeps the triangles & their winding." );
+
+		const auto statistics_after_overdraw = MeshOptimization::AnalyzeVertexCache( std::span< const std::uint32_t >( indices ), grid.positions.size() );
+		std::cout << "\tAfter OptimizeOverdraw(): ACMR " << statistics_after_overdraw.acmr << "\n";
+		Test::Check( statistics_after_overdraw.acmr <= MeshOptimization::DEFAULT_CLUSTER_ACMR_THRESHOLD + 0.01f, "OptimizeOverdraw() keeps the ACMR around the cluster threshold." );
+
+		if( Test::benchmarks_are_enabled )
+		{
+			std::cout << "\t" << triangle_count << " triangles:\n";
+
+			Test::Report( "OptimizeVertexCache()", Test::MeasureMilliseconds( [ & ]()
+			{
+				indices = grid.indices;
+				MeshOptimization::OptimizeVertexCache( std::span< std::uint32_t >( indices ), grid.positions.size() );
+			}, 3 ) );
+			Test::Report( "OptimizeOverdraw()   ", Test::MeasureMilliseconds( [ & ]()
+			{
+				MeshOptimization::OptimizeOverdraw( std::span< std::uint32_t >( indices ), grid.positions, cluster_starts );
+			}, 3 ) );
+			Test::Report( "OptimizeVertexFetch()", Test::MeasureMilliseconds( [ & ]()
+			{
+				auto fetch_indices = indices;
+				std::size_t new_vertex_count;
+				Test::DoNotOptimizeAway( MeshOptimization::OptimizeVertexFetch( std::span< std::uint32_t >( fetch_indices ), grid.positions.size(), new_vertex_count )[ 0 ] );
+			}, 3 ) );
+		}
+	}
+
+	/* Vertex fetch: */
+	{
+		auto grid = GenerateGrid( 50 );
+		ShuffleTriangles( grid.indices );
+
+		/* A vertex no triangle refers to, which has to be dropped: */
+		grid.positions.emplace_back( -1.0f, -1.0f, -1.0f );
+		const std::size_t vertex_count = grid.positions.size();
+
+		auto indices = grid.indices;
+		std::size_t new_vertex_count = 0;
+		const auto remap = MeshOptimization::OptimizeVertexFetch( std::span< std::uint32_t >( indices ), vertex_count, new_vertex_count );
+
+		Test::Check( new_vertex_count == vertex_count - 1, "OptimizeVertexFetch() drops unreferenced vertices." );
+		Test::Check( remap.size() == vertex_count && remap.back() == MeshOptimization::UNUSED_VERTEX, "Unreferenced vertices map to UNUSED_VERTEX." );
+
+		bool indices_follow_remap = true;
+		for( std::size_t index = 0; index < indices.size(); index++ )
+			indices_follow_remap &= indices[ index ] == remap[ grid.indices[ index ] ];
+
+		Test::Check( indices_follow_remap, "OptimizeVertexFetch() rewrites the indices through the returned remap." );
+
+		/* First-use order: Every vertex is first referenced right after all the ones numbered lower than it. */
+		std::uint32_t next_new_vertex = 0;
+		bool is_first_use_order = true;
+		for( const auto index : indices )
+		{
+			if( index == next_new_vertex )
+				next_new_vertex++;
+			else
+				is_first_use_order &= index < next_new_vertex;
+		}
+
+		Test::Check( is_first_use_order && next_new_vertex == new_vertex_count, "OptimizeVertexFetch() numbers vertices in first-use order." );
+
+		auto positions = grid.positions;
+		MeshOptimization::RemapVertexAttribute( positions, remap, new_vertex_count );
+
+		bool attributes_follow_remap = positions.size() == new_vertex_count;
+		for( std::size_t index = 0; attributes_follow_remap && index < indices.size(); index++ )
+			attributes_follow_remap &= positions[ indices[ index ] ] == grid.positions[ grid.indices[ index ] ];
+
+		Test::Check( attributes_follow_remap, "RemapVertexAttribute() moves attributes along with their vertices." );
+	}
+
+	return Test::Result();
+}
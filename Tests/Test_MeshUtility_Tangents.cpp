@@ -0,0 +1,242 @@
+// Engine Includes.
+#include "Graphics/MeshUtility.hpp"
+#include "Graphics/Primitive/Primitive_Cube.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+
+struct Mesh
+{
+	std::vector< Vector3 > positions, normals;
+	std::vector< Vector2 > uvs;
+	std::vector< std::uint32_t > indices;
+};
+
+/* ( grid_size + 1 )^2 vertices in the XY plane, facing -Z (as the engine's cube's front face does); u is mirrored on the left half. */
+Mesh GenerateMirroredGrid( const int grid_size )
+{
+	Mesh mesh;
+	for( auto y = 0; y <= grid_size; y++ )
+	{
+		for( auto x = 0; x <= grid_size; x++ )
+		{
+			const float u = x / ( float )grid_size;
+
+			mesh.positions.emplace_back( x * 0.001f, y * 0.001f, 0.0f );
+			mesh.normals.emplace_back( 0.0f, 0.0f, -1.0f );
+			mesh.uvs.emplace_back( x < grid_size / 2 ? -u : u, y / ( float )grid_size );
+		}
+	}
+
+	for( std::uint32_t y = 0; y < ( std::uint32_t )grid_size; y++ )
+	{
+		for( std::uint32_t x = 0; x < ( std::uint32_t )grid_size; x++ )
+		{
+			const std::uint32_t bottom_left = y * ( grid_size + 1 ) + x, bottom_right = bottom_left + 1, top_left = bottom_left + grid_size + 1, top_right = top_left + 1;
+
+			/* cross( p1 - p0, p2 - p0 ) points along -Z. */
+			mesh.indices.insert( mesh.indices.end(), { bottom_left, top_left, bottom_right, bottom_right, top_left, top_right } );
+		}
+	}
+
+	return mesh;
+}
+
+/* A UV sphere with jittered positions & normals, so that every vertex averages triangles with differing tangents. */
+Mesh GenerateJitteredSphere( const int ring_count, const int segment_count )
+{
+	std::mt19937 generator( 3 );
+	std::uniform_real_distribution< float > jitter( -0.02f, 0.02f );
+
+	Mesh mesh;
+	for( auto ring = 0; ring <= ring_count; ring++ )
+	{
+		for( auto segment = 0; segment <= segment_count; segment++ )
+		{
+			const float v = ring / ( float )ring_count, u = segment / ( float )segment_count;
+			const float polar = 0.01f + v * 3.12f, azimuth = u * 6.2831853f;
+
+			const Vector3 direction( std::sin( polar ) * std::cos( azimuth ), std::cos( polar ), std::sin( polar ) * std::sin( azimuth ) );
+			mesh.positions.push_back( direction + Vector3( jitter( generator ), jitter( generator ), jitter( generator ) ) );
+			mesh.normals.push_back( ( direction + Vector3( jitter( generator ), jitter( generator ), jitter( generator ) ) ).Normalized() );
+			mesh.uvs.emplace_back( u, v );
+		}
+	}
+
+	for( std::uint32_t ring = 0; ring < ( std::uint32_t )ring_count; ring++ )
+	{
+		for( std::uint32_t segment = 0; segment < ( std::uint32_t )segment_count; segment++ )
+		{
+			const std::uint32_t a = ring * ( segment_count + 1 ) + segment, b = a + 1, c = a + segment_count + 1, d = c + 1;
+			mesh.indices.insert( mesh.indices.end(), { a, b, c, b, d, c } );
+		}
+	}
+
+	return mesh;
+}
+
+/* The per-triangle loop Mesh used before GenerateTangents() (no per-vertex accumulation, orthonormalization or handedness); For the benchmark only. */
+std::vector< Vector3 > GenerateTangents_Reference( const Mesh& mesh )
+{
+	std::vector< Vector3 > tangents;
+	tangents.reserve( mesh.indices.size() / 3 );
+
+	for( std::size_t base_index = 0; base_index < mesh.indices.size(); base_index += 3 )
+	{
+		const auto index_0 = mesh.indices[ base_index ], index_1 = mesh.indices[ base_index + 1 ], index_2 = mesh.indices[ base_index + 2 ];
+
+		const auto edge_1 = mesh.positions[ index_1 ] - mesh.positions[ index_0 ];
+		const auto edge_2 = mesh.positions[ index_2 ] - mesh.positions[ index_0 ];
+
+		const auto delta_uv_1 = mesh.uvs[ index_1 ] - mesh.uvs[ index_0 ];
+		const auto delta_uv_2 = mesh.uvs[ index_2 ] - mesh.uvs[ index_0 ];
+
+		const float f = 1.0f / ( delta_uv_1.X() * delta_uv_2.Y() - delta_uv_2.X() * delta_uv_1.Y() );
+
+		tangents.push_back( ( edge_1 * delta_uv_2.Y() - edge_2 * delta_uv_1.Y() ) * f );
+	}
+
+	return tangents;
+}
+
+/* Unit length, orthogonal to the (given or face-averaged) normal & w = +-1 for every vertex. */
+void CheckTangentFrames( const std::vector< Vector4 >& tangents, const std::vector< Vector3 >& normals, const std::string& description )
+{
+	float max_length_error = 0.0f, max_normal_dot = 0.0f;
+	bool handedness_is_valid = true;
+	for( std::size_t vertex = 0; vertex < tangents.size(); vertex++ )
+	{
+		const Vector3 tangent( tangents[ vertex ].X(), tangents[ vertex ].Y(), tangents[ vertex ].Z() );
+
+		max_length_error     = std::max( max_length_error, std::abs( tangent.Magnitude() - 1.0f ) );
+		max_normal_dot       = std::max( max_normal_dot, std::abs( Math::Dot( tangent, normals[ vertex ] ) ) );
+		handedness_is_valid &= tangents[ vertex ].W() == +1.0f || tangents[ vertex ].W() == -1.0f;
+	}
+
+	std::cout << "\t" << description << ": Max. |length - 1| " << max_length_error << ", max. |dot( tangent, normal )| " << max_normal_dot << "\n";
+	Test::Check( max_length_error <= 1e-5f, description + ": Tangents are unit length." );
+	Test::Check( max_normal_dot   <= 1e-5f, description + ": Tangents are orthogonal to the normals." );
+	Test::Check( handedness_is_valid,	   description + ": Handedness is +1 or -1." );
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	{
+		namespace Cube = Primitive::Indexed::Cube;
+
+		const auto tangents = MeshUtility::GenerateTangents( std::span< const std::uint32_t >( Cube::Indices ), std::span< const Vector3 >( Cube::Positions ),
+															 std::span< const Vector3 >( Cube::Normals ), std::span< const Vector2 >( Cube::UVs ) );
+
+		/* The hand-authored tangents & bitangents of the cube primitive, with w from the same convention (see GenerateTangents()): */
+		int mismatch_count = 0;
+		for( std::size_t vertex = 0; vertex < tangents.size(); vertex++ )
+		{
+			const auto& expected = Cube::Tangents[ vertex ];
+			const float expected_handedness = Math::Dot( Math::Cross( expected, Cube::Normals[ vertex ] ), Cube::Bitangents[ vertex ] ) < 0.0f ? -1.0f : +1.0f;
+
+			mismatch_count += std::abs( tangents[ vertex ].X() - expected.X() ) > 1e-4f || std::abs( tangents[ vertex ].Y() - expected.Y() ) > 1e-4f ||
+							  std::abs( tangents[ vertex ].Z() - expected.Z() ) > 1e-4f || tangents[ vertex ].W() != expected_handedness;
+		}
+
+		Test::Check( tangents.size() == Cube::Positions.size() && mismatch_count == 0, "Cube: Matches Primitive::Indexed::Cube's hand-authored tangents." );
+	}
+
+	{
+		constexpr int grid_size = 1000;
+		const auto grid     = GenerateMirroredGrid( grid_size );
+		const auto tangents = MeshUtility::GenerateTangents( std::span< const std::uint32_t >( grid.indices ), grid.positions, grid.normals, grid.uvs );
+
+		Test::Check( tangents.size() == grid.positions.size(), "Grid: One tangent per vertex." );
+		CheckTangentFrames( tangents, grid.normals, "Grid" );
+
+		/* Tangents follow +u: +X with w = +1 on the right half; -X with w = -1 on the mirrored left half (the bitangent, +v = +Y, is -cross( tangent, normal ) there).
+		 * Vertices on the border & around the seam average both halves, so they are skipped. */
+		int unexpected_tangent_count = 0;
+		for( auto y = 1; y < grid_size; y++ )
+		{
+			for( auto x = 1; x < grid_size; x++ )
+			{
+				if( x >= grid_size / 2 - 1 && x <= grid_size / 2 + 1 )
+					continue;
+
+				const auto& tangent = tangents[ y * ( grid_size + 1 ) + x ];
+				const float expected = x < grid_size / 2 ? -1.0f : +1.0f;
+
+				unexpected_tangent_count += std::abs( tangent.X() - expected ) > 1e-4f || std::abs( tangent.Y() ) > 1e-4f || std::abs( tangent.Z() ) > 1e-4f || tangent.W() != expected;
+			}
+		}
+
+		Test::Check( unexpected_tangent_count == 0, "Grid: Tangents point along +u & w flips with mirrored uvs." );
+
+		const std::vector< std::uint16_t > indices_16( grid.indices.cbegin(), grid.indices.cbegin() + 60'000 );
+		const std::vector< std::uint32_t > indices_32( grid.indices.cbegin(), grid.indices.cbegin() + 60'000 );
+		const auto tangents_16 = MeshUtility::GenerateTangents( std::span< const std::uint16_t >( indices_16 ), std::span< const Vector3 >( grid.positions ).first( 65'536 ),
+																std::span< const Vector3 >( grid.normals ).first( 65'536 ), std::span< const Vector2 >( grid.uvs ).first( 65'536 ) );
+		const auto tangents_32 = MeshUtility::GenerateTangents( std::span< const std::uint32_t >( indices_32 ), std::span< const Vector3 >( grid.positions ).first( 65'536 ),
+																std::span< const Vector3 >( grid.normals ).first( 65'536 ), std::span< const Vector2 >( grid.uvs ).first( 65'536 ) );
+
+		Test::CheckBitwiseEqual( tangents_16.data(), tangents_32.data(), tangents_16.size(), "16-bit indices give the same tangents as 32-bit ones." );
+
+		/* No usable uvs anywhere: Any unit tangent on the tangent plane. */
+		const std::vector< Vector2 > degenerate_uvs( grid.uvs.size(), Vector2( 0.0f, 0.0f ) );
+		CheckTangentFrames( MeshUtility::GenerateTangents( std::span< const std::uint32_t >( grid.indices ), grid.positions, grid.normals, degenerate_uvs ), grid.normals, "Grid, degenerate uvs" );
+	}
+
+	{
+		const auto sphere = GenerateJitteredSphere( 300, 600 );
+		const std::span< const std::uint32_t > indices( sphere.indices );
+
+		const auto tangents = MeshUtility::GenerateTangents( indices, sphere.positions, sphere.normals, sphere.uvs );
+		Test::Check( tangents.size() == sphere.positions.size(), "Sphere: One tangent per vertex." );
+		CheckTangentFrames( tangents, sphere.normals, "Sphere" );
+
+		/* The result must not depend on how the parallel loops got scheduled. */
+		bool is_deterministic = true;
+		for( auto repeat = 0; repeat < 4; repeat++ )
+		{
+			const auto repeated_tangents = MeshUtility::GenerateTangents( indices, sphere.positions, sphere.normals, sphere.uvs );
+			is_deterministic &= std::memcmp( repeated_tangents.data(), tangents.data(), tangents.size() * sizeof( Vector4 ) ) == 0;
+		}
+
+		Test::Check( is_deterministic, "Sphere: Repeated runs give the same tangents bit for bit." );
+
+		/* Without normals, the tangents have to be orthogonal to the face-averaged ones. */
+		std::vector< Vector3 > face_normals( sphere.positions.size(), Vector3::Zero() );
+		for( std::size_t base_index = 0; base_index < sphere.indices.size(); base_index += 3 )
+		{
+			const auto& position_0 = sphere.positions[ sphere.indices[ base_index ] ];
+			const auto face_normal = Math::Cross( sphere.positions[ sphere.indices[ base_index + 1 ] ] - position_0, sphere.positions[ sphere.indices[ base_index + 2 ] ] - position_0 );
+
+			for( auto corner = 0; corner < 3; corner++ )
+				face_normals[ sphere.indices[ base_index + corner ] ] += face_normal;
+		}
+
+		for( auto& normal : face_normals )
+			normal = normal.Normalized();
+
+		CheckTangentFrames( MeshUtility::GenerateTangents( indices, sphere.positions, std::span< const Vector3 >(), sphere.uvs ), face_normals, "Sphere, no normals" );
+
+		if( Test::benchmarks_are_enabled )
+		{
+			std::cout << "\t" << sphere.positions.size() << " vertices, " << sphere.indices.size() / 3 << " triangles:\n";
+
+			Test::Report( "Per-triangle (old, no accumulation)", Test::MeasureMilliseconds( [ & ]() { Test::DoNotOptimizeAway( GenerateTangents_Reference( sphere )[ 0 ] ); }, 5 ) );
+			Test::Report( "GenerateTangents()                 ", Test::MeasureMilliseconds( [ & ]()
+			{
+				Test::DoNotOptimizeAway( MeshUtility::GenerateTangents( indices, sphere.positions, sphere.normals, sphere.uvs )[ 0 ] );
+			}, 5 ) );
+		}
+	}
+
+	return Test::Result();
+}
@@ -0,0 +1,142 @@
+// Engine Includes.
+#include "Graphics/MeshUtility.hpp"
+#include "Graphics/VertexCompression.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+
+/* The per-vertex loop of the variadic MeshUtility::Interleave() that WriteInterleaved() replaced (a memcpy per attribute per vertex, into a freshly allocated vector),
+ * with element sizes in bytes instead of float counts so that it covers the compressed formats too. */
+std::vector< std::byte > Interleave_Reference( const std::size_t vertex_count, std::span< const MeshUtility::VertexStream > streams )
+{
+	std::vector< std::byte > interleaved( vertex_count * MeshUtility::VertexSize( streams ) );
+
+	for( std::size_t vertex_index = 0, byte_index = 0; vertex_index < vertex_count; vertex_index++ )
+	{
+		for( const auto& stream : streams )
+		{
+			if( stream.Empty() )
+				continue;
+
+			std::memcpy( interleaved.data() + byte_index, stream.data + vertex_index * stream.element_size, stream.element_size );
+			byte_index += stream.element_size;
+		}
+	}
+
+	return interleaved;
+}
+
+struct Attributes
+{
+	std::vector< Vector3 > positions, normals, tangents;
+	std::vector< Vector2 > uvs;
+
+	std::vector< VertexCompression::QuantizedPosition > quantized_positions;
+	std::vector< VertexCompression::PackedVector3 > packed_normals, packed_tangents;
+	std::vector< VertexCompression::HalfVector2 > half_uvs;
+
+	std::vector< Vector3 > empty;
+};
+
+Attributes GenerateAttributes( const std::size_t vertex_count )
+{
+	std::mt19937 generator( 1 );
+	std::uniform_real_distribution< float > distribution( -1.0f, 1.0f );
+
+	const auto RandomVector3 = [ & ]() { return Vector3( distribution( generator ), distribution( generator ), distribution( generator ) ); };
+
+	Attributes attributes;
+	attributes.positions.resize( vertex_count );
+	attributes.normals.resize( vertex_count );
+	attributes.tangents.resize( vertex_count );
+	attributes.uvs.resize( vertex_count );
+	for( std::size_t index = 0; index < vertex_count; index++ )
+	{
+		attributes.positions[ index ] = RandomVector3();
+		attributes.normals[ index ]	  = RandomVector3();
+		attributes.tangents[ index ]  = RandomVector3();
+		attributes.uvs[ index ]		  = Vector2( distribution( generator ), distribution( generator ) );
+	}
+
+	attributes.quantized_positions.resize( vertex_count );
+	attributes.packed_normals.resize( vertex_count );
+	attributes.packed_tangents.resize( vertex_count );
+	attributes.half_uvs.resize( vertex_count );
+	VertexCompression::QuantizePositions( attributes.positions, attributes.quantized_positions );
+	VertexCompression::PackUnitVectors( attributes.normals, attributes.packed_normals );
+	VertexCompression::PackUnitVectors( attributes.tangents, attributes.packed_tangents );
+	VertexCompression::ConvertToHalf( attributes.uvs, attributes.half_uvs );
+
+	return attributes;
+}
+
+void CheckLayouts( const std::size_t vertex_count, std::span< const MeshUtility::VertexStream > streams, const std::string& description )
+{
+	const auto size = vertex_count * MeshUtility::VertexSize( streams );
+
+	const auto reference = Interleave_Reference( vertex_count, streams );
+
+	std::vector< std::byte > interleaved( size );
+	MeshUtility::WriteInterleaved( interleaved, vertex_count, streams );
+	Test::Check( interleaved == reference, "WriteInterleaved() matches the reference for " + description + "." );
+
+	std::vector< std::byte > planar( size );
+	MeshUtility::WritePlanar( planar, vertex_count, streams );
+
+	bool planar_matches = true;
+	std::size_t offset  = 0;
+	for( const auto& stream : streams )
+	{
+		if( stream.Empty() )
+			continue;
+
+		planar_matches &= std::memcmp( planar.data() + offset, stream.data, vertex_count * stream.element_size ) == 0;
+		offset += vertex_count * stream.element_size;
+	}
+
+	Test::Check( planar_matches, "WritePlanar() writes the streams back to back for " + description + "." );
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* Counts not divisible by 4 & tiny ones exercise the exact-size tail (the SIMD path writes 16 bytes at a time & relies on the next element to overwrite the excess). */
+	for( const std::size_t vertex_count : { 1'000'000, 1'000'003, 7, 3, 1 } )
+	{
+		const auto attributes = GenerateAttributes( vertex_count );
+
+		const std::array< MeshUtility::VertexStream, 5 > float_streams{ attributes.positions, attributes.normals, attributes.empty, attributes.uvs, attributes.tangents };
+		const std::array< MeshUtility::VertexStream, 4 > compressed_streams{ attributes.quantized_positions, attributes.packed_normals, attributes.half_uvs, attributes.packed_tangents };
+
+		CheckLayouts( vertex_count, float_streams,		std::to_string( vertex_count ) + " float vertices (with an empty stream)" );
+		CheckLayouts( vertex_count, compressed_streams, std::to_string( vertex_count ) + " compressed vertices" );
+
+		if( Test::benchmarks_are_enabled && vertex_count == 1'000'000 )
+		{
+			const auto Benchmark = [ & ]( std::span< const MeshUtility::VertexStream > streams, const char* name )
+			{
+				std::vector< std::byte > destination( vertex_count * MeshUtility::VertexSize( streams ) );
+
+				std::cout << "\t" << vertex_count << " " << name << " vertices (" << MeshUtility::VertexSize( streams ) << " bytes each):\n";
+				Test::Report( "Reference (incl. allocation)", Test::MeasureMilliseconds( [ & ]() { Test::DoNotOptimizeAway( Interleave_Reference( vertex_count, streams )[ 0 ] ); } ) );
+				Test::Report( "WriteInterleaved()          ", Test::MeasureMilliseconds( [ & ]() { MeshUtility::WriteInterleaved( destination, vertex_count, streams ); } ) );
+				Test::Report( "WritePlanar()               ", Test::MeasureMilliseconds( [ & ]() { MeshUtility::WritePlanar( destination, vertex_count, streams ); } ) );
+				Test::DoNotOptimizeAway( destination[ 0 ] );
+			};
+
+			Benchmark( float_streams,	   "float" );
+			Benchmark( compressed_streams, "compressed" );
+		}
+	}
+
+	return Test::Result();
+}
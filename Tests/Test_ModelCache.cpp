@@ -0,0 +1,343 @@
+// Engine Includes.
+#include "Graphics/MeshOptimization.h"
+#include "Graphics/ModelCache.h"
+#include "Graphics/VertexCompression.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+struct Values
+{
+	std::int32_t a;
+	float b;
+	double c;
+};
+
+bool operator==( const Values& lhs, const Values& rhs ) { return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c; }
+
+const Values VALUES{ -7, 0.5f, 1e100 };
+const std::array< std::byte, 3 > ODD_SIZED_BLOB{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 } };
+
+std::vector< Vector3 > MakeVectors( const std::size_t count )
+{
+	std::vector< Vector3 > vectors( count );
+	for( std::size_t index = 0; index < count; index++ )
+		vectors[ index ] = Vector3( float( index ), -float( index ), 0.25f * index );
+
+	return vectors;
+}
+
+Serialization::Writer WriteSample()
+{
+	const auto vectors = MakeVectors( 1000 );
+	const std::vector< std::uint16_t > indices{ 0, 1, 2, 2, 1, 3 };
+
+	Serialization::Writer writer;
+	writer.Write( std::uint32_t( 42 ) )
+		  .Write( VALUES )
+		  .WriteString( "" )
+		  .WriteString( "Mesh name" )
+		  .WriteBlob( std::span< const std::byte >( ODD_SIZED_BLOB ) )
+		  .WriteBlob( std::span< const Vector3 >( vectors ) )
+		  .WriteBlob( std::span< const std::byte >() )
+		  .WriteBlob( std::span< const std::uint16_t >( indices ) )
+		  .Write( true );
+
+	return writer;
+}
+
+/* Returns true if everything WriteSample() wrote is read back unchanged, with blobs aligned relative to blob_section (or in memory, if it is nullptr). */
+bool ReadSample( Serialization::Reader& reader, const std::byte* blob_section )
+{
+	std::uint32_t number;
+	Values values;
+	std::string empty_string, name;
+	std::span< const std::byte > odd_sized_blob, empty_blob;
+	std::span< const Vector3 > vectors;
+	std::span< const std::uint16_t > indices;
+	bool flag;
+
+	if( not ( reader.Read( number ) && reader.Read( values ) && reader.ReadString( empty_string ) && reader.ReadString( name ) &&
+			  reader.ReadBlob( odd_sized_blob ) && reader.ReadBlob( vectors ) && reader.ReadBlob( empty_blob ) && reader.ReadBlob( indices ) && reader.Read( flag ) ) )
+		return false;
+
+	const auto expected_vectors = MakeVectors( 1000 );
+
+	const auto IsAligned = [ & ]( const void* data )
+	{
+		return ( reinterpret_cast< std::uintptr_t >( data ) - reinterpret_cast< std::uintptr_t >( blob_section ) ) % Serialization::BLOB_ALIGNMENT == 0;
+	};
+
+	return number == 42 && values == VALUES && empty_string.empty() && name == "Mesh name" &&
+		   std::equal( odd_sized_blob.begin(), odd_sized_blob.end(), ODD_SIZED_BLOB.begin(), ODD_SIZED_BLOB.end() ) &&
+		   std::equal( vectors.begin(), vectors.end(), expected_vectors.begin(), expected_vectors.end() ) &&
+		   empty_blob.empty() &&
+		   std::equal( indices.begin(), indices.end(), std::array< std::uint16_t, 6 >{ 0, 1, 2, 2, 1, 3 }.begin() ) && indices.size() == 6 &&
+		   flag &&
+		   IsAligned( odd_sized_blob.data() ) && IsAligned( vectors.data() ) && IsAligned( indices.data() ) &&
+		   reader.IsAtEnd();
+}
+
+/* A Reader over metadata holding a single blob location, for checking ReadBlob()'s validation. */
+bool ReadBlobAt( const std::uint64_t offset, const std::uint64_t size, const std::span< const std::byte > blobs )
+{
+	Serialization::Writer writer;
+	writer.Write( offset ).Write( size );
+
+	Serialization::Reader reader( writer.Metadata(), blobs );
+	std::span< const std::byte > data;
+	return reader.ReadBlob( data );
+}
+
+void WriteFile( const std::filesystem::path& path, const std::string_view contents )
+{
+	std::ofstream file( path, std::ios::binary | std::ios::trunc );
+	file.write( contents.data(), contents.size() );
+}
+
+/* Flips one byte in place. */
+void CorruptByte( const std::filesystem::path& path, const std::streamoff offset )
+{
+	std::fstream file( path, std::ios::binary | std::ios::in | std::ios::out );
+	file.seekg( offset );
+	const char byte = ( char )file.get();
+	file.seekp( offset );
+	file.put( ~byte );
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* Serialization::Writer & Reader, in memory: */
+	{
+		const auto writer = WriteSample();
+
+		Serialization::Reader reader( writer.Metadata(), writer.Blobs() );
+		Test::Check( ReadSample( reader, writer.Blobs().data() ), "Reader reads back everything Writer wrote, with blobs at aligned offsets." );
+
+		/* Truncated metadata: Every prefix has to fail somewhere instead of reading past the end. */
+		bool truncations_fail = true;
+		for( std::size_t size = 0; size < writer.Metadata().size(); size++ )
+		{
+			Serialization::Reader truncated_reader( std::span( writer.Metadata() ).first( size ), writer.Blobs() );
+			truncations_fail &= not ReadSample( truncated_reader, writer.Blobs().data() );
+		}
+
+		Test::Check( truncations_fail, "Reader fails on truncated metadata." );
+
+		/* Truncated blobs: */
+		Serialization::Reader reader_without_blobs( writer.Metadata(), std::span( writer.Blobs() ).first( writer.Blobs().size() - 1 ) );
+		Test::Check( not ReadSample( reader_without_blobs, writer.Blobs().data() ), "Reader fails if the blob section is truncated." );
+
+		/* A string claiming to be longer than the remaining metadata: */
+		Serialization::Writer long_string_writer;
+		long_string_writer.Write( std::uint32_t( 100 ) ).Write( std::uint64_t( 0 ) );
+		Serialization::Reader long_string_reader( long_string_writer.Metadata() );
+		std::string string;
+		Test::Check( not long_string_reader.ReadString( string ), "ReadString() fails for sizes past the end of the metadata." );
+
+		const std::vector< std::byte > blobs( 256 );
+		Test::Check( ReadBlobAt( 64, 192, blobs ) && ReadBlobAt( 256, 0, blobs ), "ReadBlob() accepts blobs inside the blob section." );
+		Test::Check( not ReadBlobAt( 4, 8, blobs ), "ReadBlob() fails for unaligned offsets." );
+		Test::Check( not ReadBlobAt( 320, 0, blobs ), "ReadBlob() fails for offsets past the end of the blob section." );
+		Test::Check( not ReadBlobAt( 192, 65, blobs ), "ReadBlob() fails for sizes past the end of the blob section." );
+		Test::Check( not ReadBlobAt( 64, std::numeric_limits< std::uint64_t >::max() - 32, blobs ), "ReadBlob() fails for sizes that overflow the offset." );
+
+		Serialization::Writer odd_sized_writer;
+		odd_sized_writer.WriteBlob( std::span< const std::byte >( ODD_SIZED_BLOB ) );
+		Serialization::Reader odd_sized_reader( odd_sized_writer.Metadata(), odd_sized_writer.Blobs() );
+		std::span< const std::uint16_t > elements;
+		Test::Check( not odd_sized_reader.ReadBlob( elements ), "ReadBlob() fails if the blob's size is not a multiple of the element size." );
+	}
+
+	std::error_code error_code;
+	const auto directory_path = std::filesystem::temp_directory_path() / "Kakadu_Test_ModelCache";
+	std::filesystem::remove_all( directory_path, error_code );
+	std::filesystem::create_directories( directory_path );
+
+	/* Store() & Load(): */
+	{
+		const ModelCache::Entry entry{ directory_path / "Entries" / "sample.model", 0x0123'4567'89AB'CDEFull };
+
+		const unsigned int hit_count = ModelCache::HitCount(), miss_count = ModelCache::MissCount();
+
+		Test::Check( not ModelCache::Load( entry ).has_value(), "Load() misses when there is no entry." );
+
+		ModelCache::Store( entry, WriteSample() );
+		{
+			auto reader = ModelCache::Load( entry );
+			Test::Check( reader.has_value() && ReadSample( *reader, nullptr ), "Load() reads back a stored entry, with blobs aligned in memory." );
+		}
+
+		Test::Check( not ModelCache::Load( ModelCache::Entry{ entry.path, entry.content_hash + 1 } ).has_value(), "Load() misses for a different content hash." );
+		Test::Check( ModelCache::HitCount() - hit_count == 1 && ModelCache::MissCount() - miss_count == 2, "Every Load() counts as a hit or a miss." );
+
+		const auto file_size = std::filesystem::file_size( entry.path );
+
+		/* The metadata right after the header (which is 48 bytes) is covered by its hash: */
+		CorruptByte( entry.path, 48 + 6 );
+		Test::Check( not ModelCache::Load( entry ).has_value(), "Load() misses if the metadata is corrupt." );
+
+		ModelCache::Store( entry, WriteSample() );
+		std::filesystem::resize_file( entry.path, file_size - 1 );
+		Test::Check( not ModelCache::Load( entry ).has_value(), "Load() misses if the file is truncated." );
+
+		ModelCache::Store( entry, WriteSample() );
+		Test::Check( ModelCache::Load( entry ).has_value(), "Store() overwrites a broken entry." );
+		Test::Check( not std::filesystem::exists( std::filesystem::path( entry.path ) += ".tmp" ), "Store() leaves no temporary file behind." );
+	}
+
+	/* MakeEntry(): */
+	{
+		const auto source_path = directory_path / "model.glb";
+		WriteFile( source_path, "Model contents" );
+
+		const auto entry = ModelCache::MakeEntry( source_path, 1 );
+		Test::Check( entry.has_value() && entry->path.parent_path() == ModelCache::DIRECTORY && entry->path.extension() == ".model", "MakeEntry() names entries under DIRECTORY." );
+
+		const auto same_entry = ModelCache::MakeEntry( source_path, 1 );
+		Test::Check( same_entry && same_entry->path == entry->path && same_entry->content_hash == entry->content_hash, "MakeEntry() is deterministic." );
+
+		const auto other_settings_entry = ModelCache::MakeEntry( source_path, 2 );
+		Test::Check( other_settings_entry && other_settings_entry->path == entry->path && other_settings_entry->content_hash != entry->content_hash,
+					 "Import settings change the content hash only." );
+
+		WriteFile( source_path, "Modified model contents" );
+		const auto modified_entry = ModelCache::MakeEntry( source_path, 1 );
+		Test::Check( modified_entry && modified_entry->path == entry->path && modified_entry->content_hash != entry->content_hash,
+					 "Modifying the source changes the content hash only." );
+
+		Test::Check( not ModelCache::MakeEntry( directory_path / "missing.glb", 1 ).has_value(), "MakeEntry() fails for missing sources." );
+
+		/* .gltf files depend on the files their "uri"s name: */
+		const auto gltf_path = directory_path / "model.gltf";
+		WriteFile( gltf_path, R"({ "buffers": [ { "uri" : "model%20data.bin" } ], "images": [ { "uri": "data:image/png;base64,AAAA" } ] })" );
+		WriteFile( directory_path / "model data.bin", "1234" );
+
+		const auto gltf_entry = ModelCache::MakeEntry( gltf_path, 1 );
+		WriteFile( directory_path / "model data.bin", "12345" );
+		const auto gltf_modified_buffer_entry = ModelCache::MakeEntry( gltf_path, 1 );
+		Test::Check( gltf_entry && gltf_modified_buffer_entry && gltf_entry->content_hash != gltf_modified_buffer_entry->content_hash,
+					 "Modifying a buffer a .gltf refers to changes the content hash." );
+	}
+
+	/* Cold import vs. cached load, of a 512x512 quad grid with positions, normals & uvs. Only the CPU side of an import that runs headless is measured:
+	 * Vertex cache & fetch optimization, vertex compression & storing the results, vs. hashing the source & reading the results back (copying them out, as Model::Loader does).
+	 * glTF parsing & image decoding come on top of the cold import, GPU uploads on top of both. */
+	if( Test::benchmarks_are_enabled )
+	{
+		constexpr std::uint32_t QUAD_COUNT = 512;
+
+		std::vector< Vector3 > source_positions, source_normals;
+		std::vector< Vector2 > source_uvs;
+		std::vector< std::uint32_t > source_indices;
+		for( std::uint32_t y = 0; y <= QUAD_COUNT; y++ )
+		{
+			for( std::uint32_t x = 0; x <= QUAD_COUNT; x++ )
+			{
+				source_positions.emplace_back( ( float )x, ( float )y, std::sin( 0.1f * x ) );
+				source_normals.emplace_back( Vector3( -0.1f * std::cos( 0.1f * x ), 0.0f, 1.0f ).Normalized() );
+				source_uvs.emplace_back( ( float )x / QUAD_COUNT, ( float )y / QUAD_COUNT );
+			}
+		}
+
+		for( std::uint32_t y = 0; y < QUAD_COUNT; y++ )
+		{
+			for( std::uint32_t x = 0; x < QUAD_COUNT; x++ )
+			{
+				const std::uint32_t bottom_left = y * ( QUAD_COUNT + 1 ) + x, bottom_right = bottom_left + 1, top_left = bottom_left + QUAD_COUNT + 1, top_right = top_left + 1;
+				source_indices.insert( source_indices.end(), { bottom_left, top_left, bottom_right, bottom_right, top_left, top_right } );
+			}
+		}
+
+		/* Stands in for the source file, for MakeEntry() to hash. */
+		const auto source_path = directory_path / "grid.glb";
+		{
+			std::ofstream file( source_path, std::ios::binary | std::ios::trunc );
+			file.write( reinterpret_cast< const char* >( source_positions.data() ), source_positions.size() * sizeof( Vector3 ) );
+			file.write( reinterpret_cast< const char* >( source_normals.data() ),	source_normals.size() * sizeof( Vector3 ) );
+			file.write( reinterpret_cast< const char* >( source_uvs.data() ),		source_uvs.size() * sizeof( Vector2 ) );
+			file.write( reinterpret_cast< const char* >( source_indices.data() ),	source_indices.size() * sizeof( std::uint32_t ) );
+		}
+
+		const auto ToCacheDirectory = [ & ]( ModelCache::Entry entry ) { entry.path = directory_path / entry.path; return entry; };
+
+		std::size_t loaded_vertex_count = 0;
+
+		std::cout << "\t" << QUAD_COUNT * QUAD_COUNT * 2 << " triangles:\n";
+		Test::Report( "Cold import ", Test::MeasureMilliseconds( [ & ]()
+		{
+			const auto entry = ToCacheDirectory( *ModelCache::MakeEntry( source_path, 0 ) );
+
+			auto indices = source_indices;
+			auto positions = source_positions;
+			auto normals = source_normals;
+			auto uvs = source_uvs;
+
+			MeshOptimization::OptimizeVertexCache( std::span< std::uint32_t >( indices ), positions.size() );
+
+			std::size_t vertex_count;
+			const auto remap = MeshOptimization::OptimizeVertexFetch( std::span< std::uint32_t >( indices ), positions.size(), vertex_count );
+			MeshOptimization::RemapVertexAttribute( positions, remap, vertex_count );
+			MeshOptimization::RemapVertexAttribute( normals, remap, vertex_count );
+			MeshOptimization::RemapVertexAttribute( uvs, remap, vertex_count );
+
+			std::vector< VertexCompression::QuantizedPosition > quantized_positions( vertex_count );
+			std::vector< VertexCompression::PackedVector3 > packed_normals( vertex_count );
+			std::vector< VertexCompression::HalfVector2 > half_uvs( vertex_count );
+			const auto dequantization_transform = VertexCompression::QuantizePositions( positions, quantized_positions );
+			VertexCompression::PackUnitVectors( normals, packed_normals );
+			VertexCompression::ConvertToHalf( uvs, half_uvs );
+
+			Serialization::Writer writer;
+			writer.Write( dequantization_transform )
+				  .WriteBlob( std::span< const VertexCompression::QuantizedPosition >( quantized_positions ) )
+				  .WriteBlob( std::span< const VertexCompression::PackedVector3 >( packed_normals ) )
+				  .WriteBlob( std::span< const VertexCompression::HalfVector2 >( half_uvs ) )
+				  .WriteBlob( std::span< const Vector3 >( positions ) )
+				  .WriteBlob( std::span< const std::uint32_t >( indices ) );
+
+			ModelCache::Store( entry, writer );
+		}, 3 ) );
+		Test::Report( "Cached load ", Test::MeasureMilliseconds( [ & ]()
+		{
+			auto reader = ModelCache::Load( ToCacheDirectory( *ModelCache::MakeEntry( source_path, 0 ) ) );
+
+			Matrix4x4 dequantization_transform;
+			std::span< const VertexCompression::QuantizedPosition > quantized_positions;
+			std::span< const VertexCompression::PackedVector3 > packed_normals;
+			std::span< const VertexCompression::HalfVector2 > half_uvs;
+			std::span< const Vector3 > positions;
+			std::span< const std::uint32_t > indices;
+			if( not ( reader && reader->Read( dequantization_transform ) && reader->ReadBlob( quantized_positions ) && reader->ReadBlob( packed_normals ) &&
+					  reader->ReadBlob( half_uvs ) && reader->ReadBlob( positions ) && reader->ReadBlob( indices ) ) )
+				return;
+
+			/* Vertex data would be uploaded straight from the mapping; Only the CPU-side copies are made. */
+			const std::vector< Vector3 > position_copy( positions.begin(), positions.end() );
+			const std::vector< std::uint32_t > index_copy( indices.begin(), indices.end() );
+			loaded_vertex_count = position_copy.size();
+			Test::DoNotOptimizeAway( index_copy[ 0 ] );
+		}, 3 ) );
+
+		Test::Check( loaded_vertex_count == source_positions.size(), "The benchmark's cached load reads back the imported grid." );
+	}
+
+	std::filesystem::remove_all( directory_path, error_code );
+
+	return Test::Result();
+}
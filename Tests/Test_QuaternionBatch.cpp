@@ -0,0 +1,161 @@
+// Engine Includes.
+#include "Math/Math.hpp"
+#include "Math/QuaternionBatch.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Engine;
+
+/* Max. absolute difference between the components of the two (float-only) arrays. */
+template< typename Type >
+float MaxDifference( const std::vector< Type >& lhs, const std::vector< Type >& rhs )
+{
+	const auto* lhs_components = reinterpret_cast< const float* >( lhs.data() );
+	const auto* rhs_components = reinterpret_cast< const float* >( rhs.data() );
+
+	float difference = 0.0f;
+	for( std::size_t index = 0; index < lhs.size() * sizeof( Type ) / sizeof( float ); index++ )
+		difference = std::max( difference, std::abs( lhs_components[ index ] - rhs_components[ index ] ) );
+
+	return difference;
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* Odd count, so that the scalar remainder is exercised too. */
+	constexpr int count = 10'007;
+
+	std::mt19937 generator( 5 );
+	std::uniform_real_distribution< float > distribution( -1.0f, 1.0f );
+
+	std::vector< Quaternion > a( count ), b( count ), result( count ), reference( count );
+	std::vector< Vector3 > vectors( count ), vector_result( count ), vector_reference( count );
+	for( auto i = 0; i < count; i++ )
+	{
+		a[ i ]		 = Quaternion( distribution( generator ), distribution( generator ), distribution( generator ), distribution( generator ) ).Normalized();
+		b[ i ]		 = Quaternion( distribution( generator ), distribution( generator ), distribution( generator ), distribution( generator ) ).Normalized();
+		vectors[ i ] = Vector3( distribution( generator ), distribution( generator ), distribution( generator ) );
+	}
+
+	/* Identical & opposite quaternions take Slerp()'s Nlerp() fallback & sign flip, respectively: */
+	b[ 3 ] = a[ 3 ];
+	b[ 9 ] = -a[ 9 ];
+
+	{
+		result = a;
+		Math::Normalize( result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = a[ i ].Normalized();
+
+		Test::CheckBitwiseEqual( result.data(), reference.data(), count, "Normalize() matches Quaternion::Normalized()." );
+	}
+
+	{
+		Math::Multiply( std::span< const Quaternion >( a ), std::span< const Quaternion >( b ), result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = a[ i ] * b[ i ];
+
+		Test::CheckBitwiseEqual( result.data(), reference.data(), count, "Multiply( span, span ) matches Quaternion::operator*()." );
+
+		Math::Multiply( a[ 7 ], b, result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = a[ 7 ] * b[ i ];
+
+		Test::CheckBitwiseEqual( result.data(), reference.data(), count, "Multiply( quaternion, span ) matches Quaternion::operator*()." );
+
+		Math::Multiply( a, b[ 7 ], result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = a[ i ] * b[ 7 ];
+
+		Test::CheckBitwiseEqual( result.data(), reference.data(), count, "Multiply( span, quaternion ) matches Quaternion::operator*()." );
+
+		auto in_place = a;
+		Math::Multiply( std::span< const Quaternion >( in_place ), std::span< const Quaternion >( b ), in_place );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = a[ i ] * b[ i ];
+
+		Test::CheckBitwiseEqual( in_place.data(), reference.data(), count, "Multiply() works in-place." );
+	}
+
+	{
+		Math::Nlerp( a, b, 0.3f, result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = Math::Nlerp( a[ i ], b[ i ], 0.3f );
+
+		Test::CheckBitwiseEqual( result.data(), reference.data(), count, "Nlerp() matches the scalar Nlerp()." );
+
+		Math::Slerp( a, b, 0.3f, result );
+		for( auto i = 0; i < count; i++ )
+			reference[ i ] = Math::Slerp( a[ i ], b[ i ], 0.3f );
+
+		/* The per-lane trigonometry differs in the last bit or so (see QuaternionBatch.h). */
+		Test::Check( MaxDifference( result, reference ) <= 1e-6f, "Slerp() matches the scalar Slerp() within 1e-6." );
+	}
+
+	{
+		Math::Rotate( a, vectors, vector_result );
+		for( auto i = 0; i < count; i++ )
+			vector_reference[ i ] = a[ i ].Transform( vectors[ i ] );
+
+		Test::CheckBitwiseEqual( vector_result.data(), vector_reference.data(), count, "Rotate( span, span ) matches Quaternion::Transform()." );
+
+		Math::Rotate( a[ 1 ], vectors, vector_result );
+		for( auto i = 0; i < count; i++ )
+			vector_reference[ i ] = a[ 1 ].Transform( vectors[ i ] );
+
+		Test::CheckBitwiseEqual( vector_result.data(), vector_reference.data(), count, "Rotate( quaternion, span ) matches Quaternion::Transform()." );
+	}
+
+	{
+		std::vector< Matrix4x4 > matrices( count ), matrices_reference( count );
+		Math::QuaternionToMatrix( a, matrices );
+		for( auto i = 0; i < count; i++ )
+			matrices_reference[ i ] = Math::QuaternionToMatrix( a[ i ] );
+
+		Test::CheckBitwiseEqual( matrices.data(), matrices_reference.data(), count, "QuaternionToMatrix() matches the scalar QuaternionToMatrix()." );
+
+		std::vector< Matrix3x3 > matrices_3x3( count ), matrices_3x3_reference( count );
+		Math::QuaternionToMatrix3x3( a, matrices_3x3 );
+		for( auto i = 0; i < count; i++ )
+			matrices_3x3_reference[ i ] = Math::QuaternionToMatrix3x3( a[ i ] );
+
+		Test::CheckBitwiseEqual( matrices_3x3.data(), matrices_3x3_reference.data(), count, "QuaternionToMatrix3x3() matches the scalar QuaternionToMatrix3x3()." );
+	}
+
+	if( Test::benchmarks_are_enabled )
+	{
+		constexpr int benchmark_count = 1'000'000;
+		std::vector< Quaternion > lhs( benchmark_count ), rhs( benchmark_count ), output( benchmark_count );
+		for( auto i = 0; i < benchmark_count; i++ )
+		{
+			lhs[ i ] = a[ i % count ];
+			rhs[ i ] = b[ i % count ];
+		}
+
+		std::vector< Matrix4x4 > matrices( benchmark_count );
+
+		std::cout << "\t" << benchmark_count << " quaternions:\n";
+
+		Test::Report( "Multiply (batched)", Test::MeasureMilliseconds( [ & ]() { Math::Multiply( std::span< const Quaternion >( lhs ), std::span< const Quaternion >( rhs ), output ); } ) );
+		Test::Report( "Multiply (scalar) ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < benchmark_count; i++ ) output[ i ] = lhs[ i ] * rhs[ i ]; } ) );
+		Test::DoNotOptimizeAway( output[ 0 ] );
+
+		Test::Report( "Slerp (batched)   ", Test::MeasureMilliseconds( [ & ]() { Math::Slerp( lhs, rhs, 0.3f, output ); } ) );
+		Test::Report( "Slerp (scalar)    ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < benchmark_count; i++ ) output[ i ] = Math::Slerp( lhs[ i ], rhs[ i ], 0.3f ); } ) );
+		Test::DoNotOptimizeAway( output[ 0 ] );
+
+		Test::Report( "To 4x4 (batched)  ", Test::MeasureMilliseconds( [ & ]() { Math::QuaternionToMatrix( lhs, matrices ); } ) );
+		Test::Report( "To 4x4 (scalar)   ", Test::MeasureMilliseconds( [ & ]() { for( auto i = 0; i < benchmark_count; i++ ) matrices[ i ] = Math::QuaternionToMatrix( lhs[ i ] ); } ) );
+		Test::DoNotOptimizeAway( matrices[ 0 ] );
+	}
+
+	return Test::Result();
+}
@@ -0,0 +1,241 @@
+// Engine Includes.
+#include "Math/Random.hpp"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace Engine;
+
+/* RandomGenerator::Fill()'s scalar path, written out independently: 4 xoshiro128+ streams seeded from the generator's next 8 outputs through SplitMix64,
+ * with element i taken from stream i % 4. */
+std::vector< float > Fill_Reference( Math::RandomGenerator& generator, const std::size_t count, const float min, const float max )
+{
+	const auto SplitMix64 = []( std::uint64_t& state )
+	{
+		std::uint64_t result = ( state += 0x9E3779B97F4A7C15ull );
+		result = ( result ^ ( result >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		result = ( result ^ ( result >> 27 ) ) * 0x94D049BB133111EBull;
+		return result ^ ( result >> 31 );
+	};
+
+	std::array< std::array< std::uint32_t, 4 >, 4 > streams; // [ stream ][ word ].
+	for( auto& stream : streams )
+	{
+		std::uint64_t seed = ( std::uint64_t( generator.Next() ) << 32 ) | generator.Next();
+
+		const std::uint64_t low  = SplitMix64( seed );
+		const std::uint64_t high = SplitMix64( seed );
+
+		stream = { std::uint32_t( low ), std::uint32_t( low >> 32 ), std::uint32_t( high ), std::uint32_t( high >> 32 ) };
+	}
+
+	std::vector< float > values( count );
+	for( std::size_t index = 0; index < count; index++ )
+	{
+		auto& state = streams[ index % 4 ];
+
+		const std::uint32_t result = state[ 0 ] + state[ 3 ];
+		const std::uint32_t t      = state[ 1 ] << 9;
+
+		state[ 2 ] ^= state[ 0 ];
+		state[ 3 ] ^= state[ 1 ];
+		state[ 1 ] ^= state[ 2 ];
+		state[ 0 ] ^= state[ 3 ];
+		state[ 2 ] ^= t;
+		state[ 3 ] = ( state[ 3 ] << 11 ) | ( state[ 3 ] >> 21 );
+
+		values[ index ] = min + ( max - min ) * ( float( result >> 8 ) * 0x1.0p-24f );
+	}
+
+	return values;
+}
+
+std::vector< std::uint32_t > Sequence( Math::RandomGenerator generator, const std::size_t count )
+{
+	std::vector< std::uint32_t > sequence( count );
+	for( auto& value : sequence )
+		value = generator.Next();
+
+	return sequence;
+}
+
+template< typename Type >
+bool AllInRange( Math::RandomGenerator& generator, const Type min, const Type max, const bool max_is_inclusive, const int count = 100'000 )
+{
+	bool all_in_range = true;
+	for( auto i = 0; i < count; i++ )
+	{
+		const Type value = generator.Generate( min, max );
+		all_in_range &= value >= min && ( max_is_inclusive ? value <= max : value < max );
+	}
+
+	return all_in_range;
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* ForJob(): */
+	{
+		const std::uint64_t seed = 0x1234'5678'9ABC'DEF0ull;
+
+		Test::Check( Sequence( Math::RandomGenerator::ForJob( seed, 3 ), 1000 ) == Sequence( Math::RandomGenerator::ForJob( seed, 3 ), 1000 ),
+					 "ForJob() produces the same sequence for the same seed & job index." );
+		Test::Check( Sequence( Math::RandomGenerator::ForJob( seed, 3 ), 1000 ) != Sequence( Math::RandomGenerator::ForJob( seed, 4 ), 1000 ),
+					 "ForJob() produces different sequences for neighbouring job indices." );
+		Test::Check( Sequence( Math::RandomGenerator::ForJob( seed, 3 ), 1000 ) != Sequence( Math::RandomGenerator::ForJob( seed + 1, 3 ), 1000 ),
+					 "ForJob() produces different sequences for different seeds." );
+
+		/* Job 0 of one seed must not simply be a shifted copy of job 1's stream: */
+		const auto job_0 = Sequence( Math::RandomGenerator::ForJob( seed, 0 ), 4096 );
+		const auto job_1 = Sequence( Math::RandomGenerator::ForJob( seed, 1 ), 4096 );
+		Test::Check( std::search( job_0.cbegin(), job_0.cend(), job_1.cbegin(), job_1.cbegin() + 4 ) == job_0.cend() &&
+					 std::search( job_1.cbegin(), job_1.cend(), job_0.cbegin(), job_0.cbegin() + 4 ) == job_1.cend(),
+					 "Sequences of neighbouring jobs do not overlap." );
+
+		Math::RandomGenerator::SeedThreads( seed );
+		Test::Check( Sequence( Math::RandomGenerator::ThisThread(), 1000 ) == Sequence( Math::RandomGenerator::ForJob( seed, 0 ), 1000 ),
+					 "SeedThreads() reseeds the calling thread's generator as job 0." );
+	}
+
+	/* Fill(): */
+	{
+		/* Counts not divisible by 4 & tiny ones exercise the scalar tail after the SIMD loop. */
+		for( const std::size_t count : { 1'000'003, 4096, 7, 3, 1 } )
+		{
+			Math::RandomGenerator generator( 42 ), reference_generator( 42 );
+
+			std::vector< float > values( count );
+			generator.Fill( values, -2.0f, 5.0f );
+
+			const auto reference = Fill_Reference( reference_generator, count, -2.0f, 5.0f );
+			Test::CheckBitwiseEqual( values.data(), reference.data(), count, "Fill() matches the scalar path for " + std::to_string( count ) + " values." );
+			Test::Check( Sequence( generator, 16 ) == Sequence( reference_generator, 16 ), "Fill() advances the generator the same as the scalar path for " + std::to_string( count ) + " values." );
+		}
+
+		{
+			Math::RandomGenerator generator( 42 ), float_generator( 42 );
+
+			std::vector< Vector3 > vectors( 1001 );
+			const Vector3 min( -1.0f, 0.0f, 10.0f ), max( 1.0f, 0.5f, 20.0f );
+			generator.Fill( vectors, min, max );
+
+			std::vector< float > unit( vectors.size() * 3 );
+			float_generator.Fill( unit );
+
+			bool vectors_match = true, vectors_in_range = true;
+			for( std::size_t index = 0; index < vectors.size(); index++ )
+			{
+				const Vector3 expected( min + ( max - min ) * Vector3( unit[ index * 3 + 0 ], unit[ index * 3 + 1 ], unit[ index * 3 + 2 ] ) );
+				vectors_match &= vectors[ index ] == expected;
+
+				for( auto component = 0; component < 3; component++ )
+					vectors_in_range &= vectors[ index ][ component ] >= min[ component ] && vectors[ index ][ component ] < max[ component ];
+			}
+
+			Test::Check( vectors_match, "Fill( Vector3 ) scales the unit values Fill( float ) would produce." );
+			Test::Check( vectors_in_range, "Fill( Vector3 ) stays in [min, max) per component." );
+		}
+	}
+
+	/* Generate() ranges: */
+	{
+		Math::RandomGenerator generator( 7 );
+
+		Test::Check( AllInRange( generator, 0.0f, 1.0f, false ),			  "Generate< float >() is in [0, 1)." );
+		Test::Check( AllInRange( generator, -3.5f, -1.25f, false ),			  "Generate< float >( -3.5, -1.25 ) is in [-3.5, -1.25)." );
+		Test::Check( AllInRange( generator, 0.0, 1.0, false ),				  "Generate< double >() is in [0, 1)." );
+		Test::Check( AllInRange( generator, -10, 10, true ),				  "Generate< int >( -10, 10 ) is in [-10, 10]." );
+		Test::Check( AllInRange( generator, std::uint8_t( 200 ), std::uint8_t( 255 ), true ), "Generate< std::uint8_t >( 200, 255 ) is in [200, 255]." );
+		Test::Check( AllInRange( generator, std::int64_t( -5'000'000'000 ), std::int64_t( 5'000'000'000 ), true ),
+					 "Generate< std::int64_t >() with a range over 2^32 is in range." );
+
+		/* Both ends of integer ranges have to be reachable: */
+		std::array< int, 7 > histogram{};
+		for( auto i = 0; i < 70'000; i++ )
+			histogram[ generator.Generate( -3, 3 ) + 3 ]++;
+
+		Test::Check( std::all_of( histogram.cbegin(), histogram.cend(), []( const int count ) { return count > 9000 && count < 11000; } ),
+					 "Generate< int >( -3, 3 ) produces every value in the range, about equally often." );
+
+		Test::Check( generator.Generate( 5, 5 ) == 5, "Generate< int >( 5, 5 ) returns 5." );
+
+		/* Full 64-bit range (where max - min + 1 wraps around to 0): */
+		bool used_high_bits = false;
+		for( auto i = 0; i < 64; i++ )
+			used_high_bits |= generator.Generate( std::numeric_limits< std::uint64_t >::min(), std::numeric_limits< std::uint64_t >::max() ) > ( std::uint64_t( 1 ) << 32 );
+
+		Test::Check( used_high_bits, "Generate< std::uint64_t >() over the full range produces values above 2^32." );
+
+		bool angles_in_range = true;
+		for( auto i = 0; i < 10'000; i++ )
+		{
+			const Degrees angle = generator.Generate( Degrees( -45.0f ), Degrees( 45.0f ) );
+			angles_in_range &= angle.Value() >= -45.0f && angle.Value() < 45.0f;
+		}
+
+		Test::Check( angles_in_range, "Generate< Degrees >( -45, 45 ) is in [-45, 45)." );
+	}
+
+	/* Unit quaternions: */
+	{
+		Math::RandomGenerator generator( 1 );
+
+		std::vector< Quaternion > quaternions( 100'003 ); // Spans multiple batches of FillUnitQuaternions(), with a partial one at the end.
+		generator.FillUnitQuaternions( quaternions );
+
+		float worst_error = 0.0f;
+		Vector4 mean_squares( ZERO_INITIALIZATION );
+		for( const auto& quaternion : quaternions )
+		{
+			worst_error = std::max( worst_error, std::abs( quaternion.Magnitude() - 1.0f ) );
+			mean_squares += Vector4( quaternion.X() * quaternion.X(), quaternion.Y() * quaternion.Y(), quaternion.Z() * quaternion.Z(), quaternion.W() * quaternion.W() );
+		}
+
+		std::cout << "\tFillUnitQuaternions(): Worst |length - 1| is " << worst_error << "\n";
+		Test::Check( worst_error < 1e-5f, "FillUnitQuaternions() produces unit quaternions." );
+
+		/* Uniformly distributed rotations have every component's square average to 1/4. */
+		mean_squares /= float( quaternions.size() );
+
+		bool is_uniform = true;
+		for( auto component = 0; component < 4; component++ )
+			is_uniform &= std::abs( mean_squares[ component ] - 0.25f ) < 0.01f;
+
+		Test::Check( is_uniform, "FillUnitQuaternions() spreads the length evenly over the components." );
+
+		bool single_ones_are_unit = true;
+		for( auto i = 0; i < 10'000; i++ )
+			single_ones_are_unit &= std::abs( generator.GenerateUnitQuaternion().Magnitude() - 1.0f ) < 1e-5f;
+
+		Test::Check( single_ones_are_unit, "GenerateUnitQuaternion() produces unit quaternions." );
+	}
+
+	if( Test::benchmarks_are_enabled )
+	{
+		constexpr std::size_t count = 1'000'000;
+
+		Math::RandomGenerator generator;
+		std::vector< float > values( count );
+		std::vector< Quaternion > quaternions( count );
+
+		std::cout << "\t" << count << " values:\n";
+		Test::Report( "Generate< float >() loop   ", Test::MeasureMilliseconds( [ & ]() { for( auto& value : values ) value = generator.Generate< float >(); } ) );
+		Test::Report( "Fill()                     ", Test::MeasureMilliseconds( [ & ]() { generator.Fill( values ); } ) );
+		Test::Report( "GenerateUnitQuaternion loop", Test::MeasureMilliseconds( [ & ]() { for( auto& quaternion : quaternions ) quaternion = generator.GenerateUnitQuaternion(); } ) );
+		Test::Report( "FillUnitQuaternions()      ", Test::MeasureMilliseconds( [ & ]() { generator.FillUnitQuaternions( quaternions ); } ) );
+		Test::DoNotOptimizeAway( values[ 0 ] );
+		Test::DoNotOptimizeAway( quaternions[ 0 ] );
+	}
+
+	return Test::Result();
+}
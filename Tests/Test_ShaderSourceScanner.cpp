@@ -0,0 +1,169 @@
+// Engine Includes.
+#include "Graphics/ShaderSourceScanner.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Engine;
+
+/* What ShaderSourceScanner::Scan() extracts, in comparable form. */
+struct ScanResult
+{
+	std::vector< std::string > include_paths;
+	std::vector< std::string > feature_declarations;
+	std::vector< std::pair< std::string, std::string > > defines; // Value is "<none>" for defines without one.
+	std::vector< std::pair< std::size_t, std::size_t > > define_ranges;
+	std::vector< std::tuple< unsigned int, std::string, std::string > > vertex_inputs;
+
+	bool operator==( const ScanResult& ) const = default;
+};
+
+/* The std::regex based parsing Shader used before ShaderSourceScanner; Patterns are verbatim copies. */
+ScanResult ScanViaRegex( const std::string& source )
+{
+	ScanResult result;
+
+	const auto ForEachMatch = [ & ]( const char* pattern_string, auto&& callback )
+	{
+		const std::regex pattern( pattern_string );
+		std::smatch matches;
+
+		std::string remaining_source( source );
+		std::size_t remaining_source_offset = 0;
+		while( std::regex_search( remaining_source, matches, pattern ) )
+		{
+			callback( matches, remaining_source_offset );
+
+			remaining_source_offset += matches.position( 0 ) + matches.length( 0 );
+			remaining_source = matches.suffix();
+		}
+	};
+
+	ForEachMatch( R"(#include\s+"\s*(\S+)\s*")", [ & ]( const std::smatch& matches, std::size_t ) { result.include_paths.push_back( matches[ 1 ] ); } );
+
+	ForEachMatch( R"(#pragma\s+feature\s*(\S+))", [ & ]( const std::smatch& matches, std::size_t ) { result.feature_declarations.push_back( matches[ 1 ] ); } );
+
+	/* Feature parsing & define stripping used slightly different patterns (greedy vs. lazy whitespace before the new-line); The scanner reproduces both. */
+	ForEachMatch( R"(#define\s+([_[:alnum:]]+)\s*(\S+)?\s*\r?\n)", [ & ]( const std::smatch& matches, std::size_t )
+	{
+		result.defines.emplace_back( matches[ 1 ], matches[ 2 ].matched ? "=" + std::string( matches[ 2 ] ) : "<none>" );
+	} );
+
+	ForEachMatch( R"(#define\s+([_[:alnum:]]+)\s*(\S+)?\s*?\r?\n)", [ & ]( const std::smatch& matches, const std::size_t offset )
+	{
+		const std::size_t begin = offset + matches.position( 0 );
+		result.define_ranges.emplace_back( begin, begin + matches.length( 0 ) );
+	} );
+
+	ForEachMatch( R"(layout\s*\(\s*location\s*=\s*(\d+)\s*\)\s*in\s+(\w+)\s+(\w+)\s*;)", [ & ]( const std::smatch& matches, std::size_t )
+	{
+		result.vertex_inputs.emplace_back( ( unsigned int )std::stoi( matches[ 1 ] ), matches[ 2 ], matches[ 3 ] );
+	} );
+
+	return result;
+}
+
+ScanResult ScanViaScanner( const std::string& source )
+{
+	const auto scan = ShaderSourceScanner::Scan( source );
+
+	ScanResult result;
+
+	for( const auto& include_path : scan.include_paths )
+		result.include_paths.emplace_back( include_path );
+
+	for( const auto& feature_declaration : scan.feature_declarations )
+		result.feature_declarations.emplace_back( feature_declaration );
+
+	for( const auto& define : scan.defines )
+	{
+		result.defines.emplace_back( define.name, define.value ? "=" + std::string( *define.value ) : "<none>" );
+		result.define_ranges.emplace_back( define.begin, define.end );
+	}
+
+	for( const auto& vertex_input : scan.vertex_inputs )
+		result.vertex_inputs.emplace_back( vertex_input.location, vertex_input.type, vertex_input.name );
+
+	return result;
+}
+
+bool CheckScan( const std::string& source, const std::string& description )
+{
+	const auto via_regex   = ScanViaRegex( source );
+	const auto via_scanner = ScanViaScanner( source );
+
+	if( Test::Check( via_regex == via_scanner, description ) )
+		return true;
+
+	std::cout << "\t\tMatching parts: includes " << ( via_regex.include_paths == via_scanner.include_paths )
+			  << ", features "		<< ( via_regex.feature_declarations == via_scanner.feature_declarations )
+			  << ", defines "		<< ( via_regex.defines == via_scanner.defines )
+			  << ", define ranges " << ( via_regex.define_ranges == via_scanner.define_ranges )
+			  << ", vertex inputs " << ( via_regex.vertex_inputs == via_scanner.vertex_inputs ) << "\n";
+	return false;
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* The built-in shaders: */
+	std::string corpus;
+	int corpus_file_count = 0;
+	for( const auto& entry : std::filesystem::directory_iterator( "Asset/Shader" ) )
+	{
+		if( entry.path().extension() == ".h" )
+			continue;
+
+		std::ifstream file( entry.path(), std::ios::binary );
+		std::stringstream stream;
+		stream << file.rdbuf();
+
+		CheckScan( stream.str(), "Scanning " + entry.path().filename().string() + " matches the regex implementation." );
+
+		corpus += stream.str();
+		corpus_file_count++;
+	}
+
+	Test::Check( corpus_file_count > 0, "Built-in shaders are found (tests have to be run from Engine/Engine)." );
+
+	/* Random sources, built from tokens that exercise the corner cases (directives in comments, tokens split across lines, greedy quoting etc.): */
+	const char* tokens[] =
+	{
+		"#include", "#pragma", "feature", "#define", "layout", "location", "in", "(", ")", "=", ";", "\"", "\"a.glsl\"", "\"x\"", "FOO", "BAR_1", "12", "vec3", "pos",
+		" ", "\t", "\n", "\r\n", "\n\n", "//", "/*", "*/", "x(y)", "inout", "#", "l"
+	};
+
+	std::mt19937 generator( 1234 );
+	for( auto i = 0; i < 20'000; i++ )
+	{
+		std::string source;
+		for( auto token_count = generator() % 40; token_count > 0; token_count-- )
+			source += tokens[ generator() % std::size( tokens ) ];
+
+		if( not CheckScan( source, "Scanning random source #" + std::to_string( i ) + " matches the regex implementation." ) )
+		{
+			std::cout << "\t\tSource: [" << source << "]\n";
+			break;
+		}
+	}
+
+	if( Test::benchmarks_are_enabled )
+	{
+		std::cout << "\tScanning all " << corpus_file_count << " built-in shaders (" << corpus.size() << " bytes):\n";
+		Test::Report( "regex  ", Test::MeasureMilliseconds( [ & ]() { Test::DoNotOptimizeAway( ScanViaRegex( corpus ) ); } ) );
+		Test::Report( "scanner", Test::MeasureMilliseconds( [ & ]() { Test::DoNotOptimizeAway( ShaderSourceScanner::Scan( corpus ) ); } ) );
+	}
+
+	return Test::Result();
+}
@@ -0,0 +1,244 @@
+// Engine Includes.
+#include "Scene/Transform.h"
+#include "Scene/TransformArray.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <algorithm>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+/* Marks output elements that were not written to; Not a value any final matrix of the generated transforms can hold. */
+constexpr float UNWRITTEN = 1234.5f;
+
+struct Transforms
+{
+	std::vector< Vector3 > scales, translations;
+	std::vector< Quaternion > rotations;
+};
+
+Transforms GenerateTransforms( const std::size_t count, const unsigned int seed )
+{
+	std::mt19937 generator( seed );
+	std::uniform_real_distribution< float > scale_distribution( 0.1f, 4.0f ), unit_distribution( -1.0f, 1.0f ), translation_distribution( -100.0f, 100.0f );
+
+	Transforms transforms;
+	transforms.scales.resize( count );
+	transforms.translations.resize( count );
+	transforms.rotations.resize( count );
+	for( std::size_t index = 0; index < count; index++ )
+	{
+		transforms.scales[ index ]		 = Vector3( scale_distribution( generator ), scale_distribution( generator ), scale_distribution( generator ) );
+		transforms.translations[ index ] = Vector3( translation_distribution( generator ), translation_distribution( generator ), translation_distribution( generator ) );
+		transforms.rotations[ index ]	 = Quaternion( unit_distribution( generator ), unit_distribution( generator ), unit_distribution( generator ), unit_distribution( generator ) ).Normalized();
+	}
+
+	return transforms;
+}
+
+void Set( TransformArray& transform_array, const Transforms& transforms, const std::size_t index )
+{
+	transform_array
+		.SetScaling( index, transforms.scales[ index ] )
+		.SetRotation( index, transforms.rotations[ index ] )
+		.SetTranslation( index, transforms.translations[ index ] );
+}
+
+Matrix4x4 TransposedFinalMatrix_Reference( const Transforms& transforms, const std::size_t index )
+{
+	return Transform( transforms.scales[ index ], transforms.rotations[ index ], transforms.translations[ index ] ).GetFinalMatrix().Transposed();
+}
+
+/* Compares with ==, as the results only have to match Transform::GetFinalMatrix() barring the sign of zero. */
+bool Matches( const float* result, const Matrix4x4& reference, const std::size_t float_count )
+{
+	return std::equal( result, result + float_count, reference.Data() );
+}
+
+bool IsUnwritten( const float* result, const std::size_t float_count )
+{
+	return std::all_of( result, result + float_count, []( const float value ) { return value == UNWRITTEN; } );
+}
+
+/* Checks both overloads; expected_reference( index ) returns the reference matrix for elements expected to be written & nullopt for ones expected to be left alone. */
+template< typename ExpectedFunction >
+void CheckOutput( const TransformArray& transform_array, const bool dirty_only, ExpectedFunction&& expected_reference, const std::string& description )
+{
+	const std::size_t count = transform_array.Count();
+
+	/* 1 extra element, to catch writes past the end. */
+	std::vector< Matrix4x4 > output_4x4( count + 1 );
+	std::vector< Matrix3x4 > output_3x4( count + 1 );
+	std::fill_n( reinterpret_cast< float* >( output_4x4.data() ), output_4x4.size() * 16, UNWRITTEN );
+	std::fill_n( reinterpret_cast< float* >( output_3x4.data() ), output_3x4.size() * 12, UNWRITTEN );
+
+	transform_array.WriteTransposedFinalMatrices( std::span< Matrix4x4 >( output_4x4.data(), count ), dirty_only );
+	transform_array.WriteTransposedFinalMatrices( std::span< Matrix3x4 >( output_3x4.data(), count ), dirty_only );
+
+	bool matches_4x4 = true, matches_3x4 = true;
+	for( std::size_t index = 0; index < count; index++ )
+	{
+		const float* result_4x4 = output_4x4[ index ].Data();
+		const float* result_3x4 = output_3x4[ index ].Data();
+
+		if( const std::optional< Matrix4x4 > reference = expected_reference( index );
+			reference.has_value() )
+		{
+			matches_4x4 &= Matches( result_4x4, *reference, 16 );
+			matches_3x4 &= Matches( result_3x4, *reference, 12 );
+		}
+		else
+		{
+			matches_4x4 &= IsUnwritten( result_4x4, 16 );
+			matches_3x4 &= IsUnwritten( result_3x4, 12 );
+		}
+	}
+
+	Test::Check( matches_4x4, "WriteTransposedFinalMatrices( Matrix4x4 ) matches Transform::GetFinalMatrix().Transposed() for " + description + "." );
+	Test::Check( matches_3x4, "WriteTransposedFinalMatrices( Matrix3x4 ) matches the first 3 rows of Transform::GetFinalMatrix().Transposed() for " + description + "." );
+	Test::Check( IsUnwritten( output_4x4.back().Data(), 16 ) && IsUnwritten( output_3x4.back().Data(), 12 ),
+				 "WriteTransposedFinalMatrices() does not write past Count() for " + description + "." );
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	/* Counts that are not multiples of 4 or 64 exercise the partial groups & words. */
+	for( const std::size_t count : { 100'003, 4096, 65, 64, 63, 7, 1 } )
+	{
+		const std::string count_string = std::to_string( count ) + " elements";
+
+		const auto transforms = GenerateTransforms( count, unsigned( count ) );
+
+		TransformArray transform_array( count );
+		Test::Check( transform_array.Count() == count, "Count() is the count given to the constructor for " + count_string + "." );
+		Test::Check( transform_array.DirtyRange() == std::pair< std::size_t, std::size_t >( 0, count ), "New elements are dirty for " + count_string + "." );
+
+		for( std::size_t index = 0; index < count; index++ )
+			Set( transform_array, transforms, index );
+
+		const auto All = [ & ]( const std::size_t index ) { return std::optional( TransposedFinalMatrix_Reference( transforms, index ) ); };
+
+		CheckOutput( transform_array, true,  All, count_string + " (all dirty)" );
+		CheckOutput( transform_array, false, All, count_string + " (dirty_only = false)" );
+
+		/* Dirty flags: */
+		transform_array.ResetDirtyFlags();
+		Test::Check( not transform_array.IsAnyDirty() && transform_array.DirtyRange() == std::pair< std::size_t, std::size_t >( 0, 0 ),
+					 "ResetDirtyFlags() leaves no dirty elements for " + count_string + "." );
+
+		CheckOutput( transform_array, true, []( const std::size_t ) { return std::optional< Matrix4x4 >(); }, count_string + " (none dirty)" );
+		CheckOutput( transform_array, false, All, count_string + " (none dirty, dirty_only = false)" );
+
+		/* Sparse updates: Every 97th element & the last one. Elements are composed 4 at a time, so the clean ones sharing a group of 4 with a dirty one may be written too. */
+		const auto updated_transforms = GenerateTransforms( count, unsigned( count ) + 1 );
+
+		std::vector< bool > is_updated( count, false );
+		for( std::size_t index = 0; index < count; index += 97 )
+			is_updated[ index ] = true;
+		is_updated[ count - 1 ] = true;
+
+		for( std::size_t index = 0; index < count; index++ )
+			if( is_updated[ index ] )
+				Set( transform_array, updated_transforms, index );
+
+		bool dirty_flags_match = true;
+		for( std::size_t index = 0; index < count; index++ )
+			dirty_flags_match &= transform_array.IsDirty( index ) == is_updated[ index ];
+
+		Test::Check( dirty_flags_match, "IsDirty() is true for updated elements only for " + count_string + "." );
+		Test::Check( transform_array.DirtyRange() == std::pair< std::size_t, std::size_t >( 0, count ), "DirtyRange() covers the first to the last updated element for " + count_string + "." );
+
+		const auto Updated = [ & ]( const std::size_t index )
+		{
+			const std::size_t group_start = index / 4 * 4;
+			for( std::size_t group_index = group_start; group_index < std::min( group_start + 4, count ); group_index++ )
+				if( is_updated[ group_index ] )
+					return std::optional( TransposedFinalMatrix_Reference( is_updated[ index ] ? updated_transforms : transforms, index ) );
+
+			return std::optional< Matrix4x4 >();
+		};
+
+		CheckOutput( transform_array, true, Updated, count_string + " (sparse updates)" );
+
+		if( count > 2 )
+		{
+			transform_array.ResetDirtyFlags();
+			transform_array.SetTranslation( count / 2, Vector3::One() );
+			transform_array.SetTranslation( count - 2, Vector3::One() );
+			Test::Check( transform_array.DirtyRange() == std::pair< std::size_t, std::size_t >( count / 2, count - 1 ), "DirtyRange() is [first, last + 1) for " + count_string + "." );
+		}
+
+		if( Test::benchmarks_are_enabled && count == 100'003 )
+		{
+			std::vector< Transform > transform_objects( count );
+			std::vector< Matrix4x4 > output_4x4( count );
+			std::vector< Matrix3x4 > output_3x4( count );
+
+			std::cout << "\t" << count << " elements, all dirty:\n";
+			Test::Report( "Transform::GetFinalMatrix().Transposed() ", Test::MeasureMilliseconds( [ & ]()
+			{
+				for( std::size_t index = 0; index < count; index++ )
+				{
+					transform_objects[ index ].SetScaling( transforms.scales[ index ] ).SetRotation( transforms.rotations[ index ] ).SetTranslation( transforms.translations[ index ] );
+					output_4x4[ index ] = transform_objects[ index ].GetFinalMatrix().Transposed();
+				}
+			} ) );
+			Test::Report( "WriteTransposedFinalMatrices( Matrix4x4 )", Test::MeasureMilliseconds( [ & ]() { transform_array.WriteTransposedFinalMatrices( output_4x4, false ); } ) );
+			Test::Report( "WriteTransposedFinalMatrices( Matrix3x4 )", Test::MeasureMilliseconds( [ & ]() { transform_array.WriteTransposedFinalMatrices( output_3x4, false ); } ) );
+
+			transform_array.ResetDirtyFlags();
+			for( std::size_t index = 0; index < count; index += 97 )
+				transform_array.SetTranslation( index, Vector3::One() );
+
+			std::cout << "\t" << count << " elements, every 97th dirty:\n";
+			Test::Report( "WriteTransposedFinalMatrices( Matrix4x4 )", Test::MeasureMilliseconds( [ & ]() { transform_array.WriteTransposedFinalMatrices( output_4x4 ); } ) );
+			Test::DoNotOptimizeAway( output_4x4[ 0 ] );
+			Test::DoNotOptimizeAway( output_3x4[ 0 ] );
+		}
+	}
+
+	/* Resize(): */
+	{
+		const auto transforms = GenerateTransforms( 1000, 1 );
+
+		TransformArray transform_array( 1000 );
+		for( std::size_t index = 0; index < 1000; index++ )
+			Set( transform_array, transforms, index );
+
+		transform_array.ResetDirtyFlags();
+		transform_array.Resize( 601 );
+
+		Test::Check( transform_array.Count() == 601 && not transform_array.IsAnyDirty(), "Shrinking keeps the dirty flags of the remaining elements." );
+
+		/* Shrinking leaves the remaining elements alone: */
+		CheckOutput( transform_array, false, [ & ]( const std::size_t index ) { return std::optional( TransposedFinalMatrix_Reference( transforms, index ) ); }, "601 elements after shrinking" );
+
+		transform_array.SetTranslation( 600, Vector3::One() );
+		transform_array.Resize( 600 );
+		Test::Check( not transform_array.IsAnyDirty(), "Shrinking drops the dirty flags of the removed elements." );
+
+		transform_array.Resize( 1000 );
+		Test::Check( transform_array.DirtyRange() == std::pair< std::size_t, std::size_t >( 600, 1000 ), "Growing marks (only) the new elements as dirty." );
+
+		/* The new elements have to be identity, even though the ones at 600-639 were left in the padding with their old values by the shrink. */
+		CheckOutput( transform_array, true, [ & ]( const std::size_t index )
+		{
+			return index >= 600 ? std::optional( Matrix4x4::Identity() ) : std::optional< Matrix4x4 >();
+		}, "1000 elements after growing" );
+
+		CheckOutput( transform_array, false, [ & ]( const std::size_t index )
+		{
+			return index >= 600 ? std::optional( Matrix4x4::Identity() ) : std::optional( TransposedFinalMatrix_Reference( transforms, index ) );
+		}, "1000 elements after growing (dirty_only = false)" );
+	}
+
+	return Test::Result();
+}
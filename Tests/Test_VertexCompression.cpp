@@ -0,0 +1,325 @@
+// Engine Includes.
+#include "Graphics/VertexCompression.h"
+
+// Test Includes.
+#include "Test.h"
+
+// std Includes.
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Engine;
+
+/* Decoders, doing what the vertex fetch does with the normalized integer & half float formats (signed normalization as of GL 4.2: max( value / max_value, -1 )). */
+
+float DecodeSnorm16( const std::int16_t value )
+{
+	return std::max( value / 32767.0f, -1.0f );
+}
+
+Vector3 DecodePackedVector3( const VertexCompression::PackedVector3 packed )
+{
+	/* Moving each 10-bit field to the top & shifting it back down arithmetically sign-extends it. */
+	const auto Decode = [ & ]( const int shift ) { return std::max( float( std::int32_t( packed << ( 22 - shift ) ) >> 22 ) / 511.0f, -1.0f ); };
+
+	return Vector3( Decode( 0 ), Decode( 10 ), Decode( 20 ) );
+}
+
+float HalfToFloat( const std::uint16_t half )
+{
+	const float sign     = half & 0x8000 ? -1.0f : 1.0f;
+	const int   exponent = ( half >> 10 ) & 0x1F;
+	const int   mantissa = half & 0x3FF;
+
+	if( exponent == 0x1F )
+		return mantissa == 0 ? sign * std::numeric_limits< float >::infinity() : std::numeric_limits< float >::quiet_NaN();
+
+	if( exponent == 0 )
+		return sign * std::ldexp( float( mantissa ), -24 );
+
+	return sign * std::ldexp( float( 1024 + mantissa ), exponent - 25 );
+}
+
+/* Vector's operator== compares with a tolerance. */
+template< typename VectorType >
+bool IsExactly( const VectorType& value, const VectorType& expected )
+{
+	return std::equal( value.Data(), value.Data() + VectorType::Dimension(), expected.Data() );
+}
+
+/* Returns the largest error relative to the bound; Positions have to be within half a quantization step (of the largest extent) of the original. */
+float PositionErrorRatio( const std::vector< Vector3 >& positions )
+{
+	std::vector< VertexCompression::QuantizedPosition > quantized( positions.size() );
+	const Matrix4x4 dequantization_transform = VertexCompression::QuantizePositions( positions, quantized );
+
+	float largest_extent = 0.0f, largest_value = 0.0f;
+	for( auto axis = 0; axis < 3; axis++ )
+	{
+		const auto [ minimum, maximum ] = std::minmax_element( positions.cbegin(), positions.cend(),
+															   [ & ]( const Vector3& lhs, const Vector3& rhs ) { return lhs[ axis ] < rhs[ axis ]; } );
+
+		largest_extent = std::max( largest_extent, ( *maximum )[ axis ] - ( *minimum )[ axis ] );
+		largest_value  = std::max( largest_value, std::max( std::abs( ( *minimum )[ axis ] ), std::abs( ( *maximum )[ axis ] ) ) );
+	}
+
+	/* Plus a few float ulps of the values involved, for the arithmetic of the quantization & the transform. */
+	const float bound = 0.5f * largest_extent / 2.0f / 32767.0f + 4.0f * std::numeric_limits< float >::epsilon() * largest_value;
+
+	float worst_ratio = 0.0f;
+	for( std::size_t index = 0; index < positions.size(); index++ )
+	{
+		const auto& q = quantized[ index ];
+		const Vector4 dequantized( Vector4( DecodeSnorm16( q.x ), DecodeSnorm16( q.y ), DecodeSnorm16( q.z ), 1.0f ) * dequantization_transform );
+
+		for( auto axis = 0; axis < 3; axis++ )
+			worst_ratio = std::max( worst_ratio, std::abs( dequantized[ axis ] - positions[ index ][ axis ] ) / bound );
+
+		if( q.w != 0 )
+			return std::numeric_limits< float >::infinity();
+	}
+
+	return worst_ratio;
+}
+
+/* Returns the largest error (per component) of the packed directions. */
+float PackedVectorError( const std::vector< Vector3 >& vectors )
+{
+	std::vector< VertexCompression::PackedVector3 > packed( vectors.size() );
+	VertexCompression::PackUnitVectors( vectors, packed );
+
+	float worst_error = 0.0f;
+	for( std::size_t index = 0; index < vectors.size(); index++ )
+	{
+		const Vector3 expected( vectors[ index ].IsZero() ? Vector3::Zero() : vectors[ index ].Normalized() );
+		const Vector3 decoded( DecodePackedVector3( packed[ index ] ) );
+
+		for( auto axis = 0; axis < 3; axis++ )
+			worst_error = std::max( worst_error, std::abs( decoded[ axis ] - expected[ axis ] ) );
+
+		if( packed[ index ] >> 30 != 0 )
+			return std::numeric_limits< float >::infinity();
+	}
+
+	return worst_error;
+}
+
+std::vector< std::uint16_t > ToHalf( const std::vector< float >& values )
+{
+	std::vector< Vector2 > vectors( ( values.size() + 1 ) / 2 );
+	std::copy( values.cbegin(), values.cend(), reinterpret_cast< float* >( vectors.data() ) );
+
+	std::vector< VertexCompression::HalfVector2 > result( vectors.size() );
+	VertexCompression::ConvertToHalf( vectors, result );
+
+	std::vector< std::uint16_t > halves( values.size() );
+	std::copy_n( reinterpret_cast< const std::uint16_t* >( result.data() ), values.size(), halves.begin() );
+	return halves;
+}
+
+int main( int argument_count, char** arguments )
+{
+	Test::ParseArguments( argument_count, arguments );
+
+	std::mt19937 generator( 3 );
+
+	/* Positions: */
+	{
+		/* Odd counts exercise the scalar tail after the pairs handled with SIMD. */
+		for( const std::size_t count : { 100'001, 2, 1 } )
+		{
+			std::uniform_real_distribution< float > x_distribution( -3.0f, 5.0f ), y_distribution( 100.0f, 101.0f ), z_distribution( -0.01f, 0.0f );
+
+			std::vector< Vector3 > positions( count );
+			for( auto& position : positions )
+				position = Vector3( x_distribution( generator ), y_distribution( generator ), z_distribution( generator ) );
+
+			const float error_ratio = PositionErrorRatio( positions );
+			std::cout << "\t" << count << " positions: Worst error is " << error_ratio << " of the bound\n";
+			Test::Check( error_ratio <= 1.0f, "Dequantized positions are within half a quantization step for " + std::to_string( count ) + " positions." );
+		}
+
+		/* The corners of the bounding box map to the ends of the range on the largest axis: */
+		{
+			const std::vector< Vector3 > positions{ Vector3( -2.0f, 0.0f, 0.0f ), Vector3( 6.0f, 1.0f, 1.0f ), Vector3( 2.0f, 0.5f, 0.5f ) };
+			std::vector< VertexCompression::QuantizedPosition > quantized( positions.size() );
+			VertexCompression::QuantizePositions( positions, quantized );
+			Test::Check( quantized[ 0 ].x == -32767 && quantized[ 1 ].x == 32767 && quantized[ 2 ].x == 0, "The bounds of the largest axis map to -32767 & +32767." );
+			Test::Check( PositionErrorRatio( positions ) <= 1.0f, "Dequantized bounding box corners are within half a quantization step." );
+		}
+
+		/* Zero-extent bounds: */
+		{
+			const std::vector< Vector3 > same_positions( 7, Vector3( 1.5f, -2.0f, 1000.0f ) );
+			std::vector< VertexCompression::QuantizedPosition > quantized( same_positions.size() );
+			const Matrix4x4 dequantization_transform = VertexCompression::QuantizePositions( same_positions, quantized );
+
+			bool all_zero = true;
+			for( const auto& q : quantized )
+				all_zero &= q.x == 0 && q.y == 0 && q.z == 0 && q.w == 0;
+
+			const Vector4 dequantized( Vector4( 0.0f, 0.0f, 0.0f, 1.0f ) * dequantization_transform );
+			Test::Check( all_zero && IsExactly( dequantized, Vector4( 1.5f, -2.0f, 1000.0f, 1.0f ) ), "Identical positions quantize to zero & dequantize back exactly." );
+
+			Test::Check( PositionErrorRatio( { Vector3( 4.0f, 4.0f, 4.0f ) } ) <= 1.0f, "A single position round-trips." );
+
+			/* Flat along 2 axes; The largest extent is used for all of them. */
+			std::vector< Vector3 > line( 101 );
+			for( auto index = 0; index < line.size(); index++ )
+				line[ index ] = Vector3( 0.5f, index * 0.01f, -3.0f );
+
+			Test::Check( PositionErrorRatio( line ) <= 1.0f, "Positions with zero-extent axes round-trip." );
+		}
+	}
+
+	/* 2_10_10_10 unit vectors: */
+	{
+		const float bound = 1.0f / 1022.0f + 1e-5f; // Half a step, plus the error of the approximate inverse square root.
+
+		for( const std::size_t count : { 100'003, 3, 1 } )
+		{
+			std::normal_distribution< float > distribution;
+
+			std::vector< Vector3 > vectors( count );
+			for( auto& vector : vectors )
+				vector = Vector3( distribution( generator ), distribution( generator ), distribution( generator ) ) * 10.0f; // Not normalized on purpose.
+
+			const float error = PackedVectorError( vectors );
+			std::cout << "\t" << count << " vectors: Worst error per component is " << error << " (1/" << 1.0f / error << ")\n";
+			Test::Check( error <= bound, "PackUnitVectors() is within 1/1022 per component for " + std::to_string( count ) + " vectors." );
+		}
+
+		/* Exact +-1 axes & zero, 7 of them so that both the SIMD & the scalar path see them: */
+		const std::vector< Vector3 > axes
+		{
+			Vector3( 1.0f, 0.0f, 0.0f ), Vector3( -1.0f, 0.0f, 0.0f ), Vector3( 0.0f, 1.0f, 0.0f ), Vector3( 0.0f, -1.0f, 0.0f ),
+			Vector3( 0.0f, 0.0f, 1.0f ), Vector3( 0.0f, 0.0f, -1.0f ), Vector3( 0.0f, 0.0f, 0.0f )
+		};
+
+		std::vector< VertexCompression::PackedVector3 > packed( axes.size() );
+		VertexCompression::PackUnitVectors( axes, packed );
+
+		bool axes_are_exact = true;
+		for( std::size_t index = 0; index < axes.size(); index++ )
+			axes_are_exact &= IsExactly( DecodePackedVector3( packed[ index ] ), axes[ index ] );
+
+		Test::Check( axes_are_exact, "Exact +-1 axes & zero vectors decode back exactly." );
+
+		/* Scaled axes too, as they go through the normalization: */
+		std::vector< Vector3 > scaled_axes( axes );
+		for( auto& axis : scaled_axes )
+			axis *= 1e-3f;
+
+		VertexCompression::PackUnitVectors( scaled_axes, packed );
+
+		bool scaled_axes_are_exact = true;
+		for( std::size_t index = 0; index < axes.size(); index++ )
+			scaled_axes_are_exact &= IsExactly( DecodePackedVector3( packed[ index ] ), axes[ index ] );
+
+		Test::Check( scaled_axes_are_exact, "Scaled axes decode back to exact +-1." );
+	}
+
+	/* Half floats: */
+	{
+		/* Relative error of at most half an ulp (2^-11) for normal halves, absolute error of at most half the smallest subnormal (2^-25) below those. */
+		const auto IsWithinBound = []( const float value, const std::uint16_t half )
+		{
+			const float error = std::abs( HalfToFloat( half ) - value );
+			return std::abs( value ) < 0x1.0p-14f ? error <= 0x1.0p-25f : error <= std::abs( value ) * 0x1.0p-11f;
+		};
+
+		/* Log-uniform magnitudes over the whole half range, both signs; An odd count exercises the scalar tail after the blocks of 8. */
+		std::uniform_real_distribution< float > exponent_distribution( -26.0f, 15.99f );
+		std::vector< float > values( 200'001 );
+		for( auto index = 0; index < values.size(); index++ )
+			values[ index ] = ( index % 2 ? -1.0f : 1.0f ) * std::exp2( exponent_distribution( generator ) );
+
+		const auto halves = ToHalf( values );
+
+		bool all_within_bound = true;
+		for( std::size_t index = 0; index < values.size(); index++ )
+			all_within_bound &= IsWithinBound( values[ index ], halves[ index ] );
+
+		Test::Check( all_within_bound, "ConvertToHalf() is within half an ulp over the whole half range." );
+
+		/* The SIMD path has to produce the same bits as the scalar one, which handles single vectors: */
+		bool paths_match = true;
+		for( std::size_t index = 0; index < 4096; index += 2 )
+			paths_match &= ToHalf( { values[ index ], values[ index + 1 ] } ) == std::vector< std::uint16_t >{ halves[ index ], halves[ index + 1 ] };
+
+		Test::Check( paths_match, "ConvertToHalf()'s SIMD & scalar paths produce the same bits." );
+
+		/* Edge cases, in a block of 8 (SIMD) followed by the same values one pair at a time (scalar): */
+		const float infinity = std::numeric_limits< float >::infinity();
+		const std::vector< std::pair< float, std::uint16_t > > edge_cases
+		{
+			{ 1.0f,			0x3C00 },
+			{ -0.0f,		0x8000 },
+			{ 65504.0f,		0x7BFF }, // Largest half.
+			{ 65519.0f,		0x7BFF }, // Rounds down to the largest half.
+			{ 65520.0f,		0x7C00 }, // Rounds up, past the largest half.
+			{ -1e10f,		0xFC00 },
+			{ infinity,		0x7C00 },
+			{ 0x1.0p-24f,	0x0001 }, // Smallest subnormal.
+			{ 0x1.0p-26f,	0x0000 }, // Rounds down to zero.
+			{ 0x1.8p-24f,	0x0002 }, // Tie, rounds to even.
+			{ 0x1.002p0f,	0x3C00 }, // Tie, rounds to even.
+			{ 0x1.006p0f,	0x3C02 }  // Tie, rounds to even.
+		};
+
+		std::vector< float > edge_values;
+		for( const auto& [ value, expected ] : edge_cases )
+			edge_values.push_back( value );
+
+		const auto edge_halves = ToHalf( edge_values );
+
+		bool edge_cases_match = true;
+		for( std::size_t index = 0; index < edge_cases.size(); index++ )
+		{
+			const bool matches = edge_halves[ index ] == edge_cases[ index ].second && ToHalf( { edge_values[ index ] } )[ 0 ] == edge_cases[ index ].second;
+			if( not matches )
+				std::cout << "\t" << edge_values[ index ] << " converts to 0x" << std::hex << edge_halves[ index ] << " instead of 0x" << edge_cases[ index ].second << std::dec << "\n";
+
+			edge_cases_match &= matches;
+		}
+
+		Test::Check( edge_cases_match, "ConvertToHalf() rounds to nearest even, to infinity above the half range & keeps the sign of zero." );
+
+		const auto nan_halves = ToHalf( { std::numeric_limits< float >::quiet_NaN(), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, std::numeric_limits< float >::quiet_NaN() } );
+		Test::Check( std::isnan( HalfToFloat( nan_halves[ 0 ] ) ) && std::isnan( HalfToFloat( nan_halves[ 8 ] ) ), "ConvertToHalf() keeps NaNs NaN." );
+	}
+
+	if( Test::benchmarks_are_enabled )
+	{
+		constexpr std::size_t count = 1'000'000;
+
+		std::uniform_real_distribution< float > distribution( -1.0f, 1.0f );
+		std::vector< Vector3 > vectors( count );
+		std::vector< Vector2 > uvs( count );
+		for( std::size_t index = 0; index < count; index++ )
+		{
+			vectors[ index ] = Vector3( distribution( generator ), distribution( generator ), distribution( generator ) );
+			uvs[ index ]	 = Vector2( distribution( generator ), distribution( generator ) );
+		}
+
+		std::vector< VertexCompression::QuantizedPosition > quantized( count );
+		std::vector< VertexCompression::PackedVector3 > packed( count );
+		std::vector< VertexCompression::HalfVector2 > halves( count );
+
+		std::cout << "\t" << count << " vertices:\n";
+		Test::Report( "QuantizePositions()", Test::MeasureMilliseconds( [ & ]() { Test::DoNotOptimizeAway( VertexCompression::QuantizePositions( vectors, quantized ) ); } ) );
+		Test::Report( "PackUnitVectors()  ", Test::MeasureMilliseconds( [ & ]() { VertexCompression::PackUnitVectors( vectors, packed ); } ) );
+		Test::Report( "ConvertToHalf()    ", Test::MeasureMilliseconds( [ & ]() { VertexCompression::ConvertToHalf( uvs, halves ); } ) );
+		Test::DoNotOptimizeAway( quantized[ 0 ] );
+		Test::DoNotOptimizeAway( packed[ 0 ] );
+		Test::DoNotOptimizeAway( halves[ 0 ] );
+	}
+
+	return Test::Result();
+}